@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+
+#include <ddc/ddc.hpp>
+
+#include <similie/exterior/exterior.hpp>
+
+struct X
+{
+};
+
+struct Y
+{
+};
+
+struct Z
+{
+};
+
+struct DDimX : ddc::UniformPointSampling<X>
+{
+};
+
+struct DDimY : ddc::UniformPointSampling<Y>
+{
+};
+
+struct DDimZ : ddc::UniformPointSampling<Z>
+{
+};
+
+struct Mu3 : sil::tensor::TensorNaturalIndex<X, Y, Z>
+{
+};
+
+struct Nu3 : sil::tensor::TensorNaturalIndex<X, Y, Z>
+{
+};
+
+using OneFormIndex = sil::tensor::TensorAntisymmetricIndex<Mu3>;
+using TwoFormIndex = sil::tensor::TensorAntisymmetricIndex<Nu3, Mu3>;
+
+template <class Kernel>
+double time_kernel(Kernel&& kernel, int nb_repetitions)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+    kernel(exec_space);
+    exec_space.fence();
+    Kokkos::Timer timer;
+    for (int repetition = 0; repetition < nb_repetitions; ++repetition) {
+        kernel(exec_space);
+    }
+    exec_space.fence();
+    return timer.seconds() / nb_repetitions;
+}
+
+int main(int argc, char** argv)
+{
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+    ddc::ScopeGuard const ddc_scope(argc, argv);
+
+    std::size_t const nx = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 128;
+    std::size_t const ny = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 128;
+    std::size_t const nz = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 32;
+    int const nb_repetitions = argc > 4 ? std::atoi(argv[4]) : 10;
+
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ> const
+            mesh_xyz(ddc::DiscreteElement<DDimX, DDimY, DDimZ>(0, 0, 0),
+                     ddc::DiscreteVector<DDimX, DDimY, DDimZ>(nx, ny, nz));
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<OneFormIndex> tensor_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, OneFormIndex>
+            tensor_dom(mesh_xyz, tensor_accessor.domain());
+    ddc::Chunk tensor_alloc(tensor_dom, ddc::DeviceAllocator<double>());
+    sil::tensor::Tensor tensor(tensor_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            tensor_dom,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY, DDimZ, OneFormIndex> elem) {
+                tensor(elem) = static_cast<double>(
+                        (elem.uid<DDimX>() + 3 * elem.uid<DDimY>() + 7 * elem.uid<DDimZ>()
+                         + elem.uid<OneFormIndex>())
+                        % 11);
+            });
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<TwoFormIndex> derivative_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, TwoFormIndex>
+            derivative_dom(mesh_xyz, derivative_accessor.domain());
+    ddc::Chunk derivative_alloc(derivative_dom, ddc::DeviceAllocator<double>());
+    sil::tensor::Tensor derivative(derivative_alloc);
+
+    std::cout << "coboundary of a 1-form on " << nx << "x" << ny << "x" << nz << " nodes, "
+              << nb_repetitions << " repetitions\n";
+    std::cout << "  flat: "
+              << time_kernel(
+                         [&](auto const& exec_space) {
+                             sil::exterior::coboundary<Nu3, OneFormIndex>(
+                                     exec_space,
+                                     derivative,
+                                     tensor);
+                         },
+                         nb_repetitions)
+              << " s\n";
+    std::cout << "  flat transposed: "
+              << time_kernel(
+                         [&](auto const& exec_space) {
+                             sil::exterior::transposed_coboundary<Nu3, OneFormIndex>(
+                                     exec_space,
+                                     derivative,
+                                     tensor);
+                         },
+                         nb_repetitions)
+              << " s\n";
+    // The last dimension is contiguous in memory.
+    for (std::array<std::size_t, 3> const& tile_extents :
+         {std::array<std::size_t, 3> {2, 4, 32},
+          std::array<std::size_t, 3> {4, 4, 16},
+          std::array<std::size_t, 3> {4, 8, 8},
+          std::array<std::size_t, 3> {8, 8, 4},
+          std::array<std::size_t, 3> {1, 16, 16}}) {
+        std::cout << "  team tiled " << tile_extents[0] << "x" << tile_extents[1] << "x"
+                  << tile_extents[2] << ": "
+                  << time_kernel(
+                             [&](auto const& exec_space) {
+                                 sil::exterior::team_tiled_coboundary<Nu3, OneFormIndex>(
+                                         exec_space,
+                                         derivative,
+                                         tensor,
+                                         tile_extents);
+                             },
+                             nb_repetitions)
+                  << " s, transposed: "
+                  << time_kernel(
+                             [&](auto const& exec_space) {
+                                 sil::exterior::team_tiled_transposed_coboundary<
+                                         Nu3,
+                                         OneFormIndex>(
+                                         exec_space,
+                                         derivative,
+                                         tensor,
+                                         tile_extents);
+                             },
+                             nb_repetitions)
+                  << " s\n";
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+
+#include <ddc/ddc.hpp>
+
+#include <similie/exterior/exterior.hpp>
+#include <similie/misc/binomial_coefficient.hpp>
+
+struct X
+{
+};
+
+struct Y
+{
+};
+
+struct Z
+{
+};
+
+struct DDimX : ddc::UniformPointSampling<X>
+{
+};
+
+struct DDimY : ddc::UniformPointSampling<Y>
+{
+};
+
+struct DDimZ : ddc::UniformPointSampling<Z>
+{
+};
+
+struct Mu3 : sil::tensor::TensorNaturalIndex<X, Y, Z>
+{
+};
+
+struct Nu3 : sil::tensor::TensorNaturalIndex<X, Y, Z>
+{
+};
+
+using PositionIndex = sil::tensor::Contravariant<Mu3>;
+using OneFormIndex = sil::tensor::Covariant<Mu3>;
+using TwoFormIndex = sil::tensor::
+        TensorAntisymmetricIndex<sil::tensor::Covariant<Mu3>, sil::tensor::Covariant<Nu3>>;
+
+/*
+ * Loop-based combinatorics used before the compile-time combination tables, kept as the baseline
+ * of the table lookups.
+ */
+namespace reference {
+
+template <std::size_t N, std::size_t K>
+KOKKOS_FUNCTION std::array<std::size_t, K> combination_from_rank(std::size_t rank)
+{
+    std::array<std::size_t, K> ids {};
+    std::size_t next_candidate = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+        for (std::size_t candidate = next_candidate; candidate < N; ++candidate) {
+            std::size_t const remaining = K - i - 1;
+            std::size_t const count = (remaining == 0)
+                                              ? 1
+                                              : sil::misc::binomial_coefficient(
+                                                        N - candidate - 1,
+                                                        remaining);
+            if (rank < count) {
+                ids[i] = candidate;
+                next_candidate = candidate + 1;
+                break;
+            }
+            rank -= count;
+        }
+    }
+    return ids;
+}
+
+template <std::size_t N, std::size_t K>
+KOKKOS_FUNCTION std::size_t combination_rank(std::array<std::size_t, K> const& ids)
+{
+    std::size_t rank = 0;
+    std::size_t next_candidate = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+        for (std::size_t candidate = next_candidate; candidate < ids[i]; ++candidate) {
+            std::size_t const remaining = K - i - 1;
+            rank += (remaining == 0)
+                            ? 1
+                            : sil::misc::binomial_coefficient(N - candidate - 1, remaining);
+        }
+        next_candidate = ids[i] + 1;
+    }
+    return rank;
+}
+
+template <std::size_t N, std::size_t K>
+KOKKOS_FUNCTION std::array<std::size_t, N - K> hodge_complement_ids(
+        std::array<std::size_t, K> const& ids)
+{
+    std::array<std::size_t, N - K> complement_ids {};
+    std::size_t complement_id = 0;
+    for (std::size_t id = 0; id < N; ++id) {
+        bool found = false;
+        for (std::size_t i = 0; i < K; ++i) {
+            found = found || ids[i] == id;
+        }
+        if (!found) {
+            complement_ids[complement_id++] = id;
+        }
+    }
+    return complement_ids;
+}
+
+template <std::size_t N, std::size_t K>
+KOKKOS_FUNCTION int hodge_permutation_sign(
+        std::array<std::size_t, K> const& source_ids,
+        std::array<std::size_t, N - K> const& target_ids)
+{
+    std::array<std::size_t, N> permutation {};
+    for (std::size_t i = 0; i < K; ++i) {
+        permutation[i] = source_ids[i];
+    }
+    for (std::size_t i = 0; i < N - K; ++i) {
+        permutation[K + i] = target_ids[i];
+    }
+    int sign = 1;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = i + 1; j < N; ++j) {
+            if (permutation[i] > permutation[j]) {
+                sign = -sign;
+            }
+        }
+    }
+    return sign;
+}
+
+} // namespace reference
+
+/*
+ * Round trip rank -> ids -> (complement, sign) -> rank over every K-combination of N ids, once per
+ * point, with either the table lookups or the reference loops.
+ */
+template <std::size_t N, std::size_t K, bool UseTables>
+double time_combinatorics(std::size_t nb_points, int nb_repetitions)
+{
+    namespace detail = sil::exterior::detail;
+    std::size_t constexpr nb_combinations = sil::misc::binomial_coefficient(N, K);
+    Kokkos::DefaultExecutionSpace const exec_space;
+    double checksum = 0.;
+    Kokkos::Timer timer;
+    for (int repetition = 0; repetition <= nb_repetitions; ++repetition) {
+        if (repetition == 1) {
+            exec_space.fence();
+            timer.reset();
+        }
+        Kokkos::parallel_reduce(
+                "combinatorics_benchmark",
+                Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(exec_space, 0, nb_points),
+                KOKKOS_LAMBDA(std::size_t const point, double& sum) {
+                    std::size_t const rank = point % nb_combinations;
+                    if constexpr (UseTables) {
+                        std::array<std::size_t, K> const ids
+                                = detail::combination_from_rank<N, K>(rank);
+                        std::array<std::size_t, N - K> const complement_ids
+                                = detail::hodge_complement_ids<N>(ids);
+                        sum += detail::hodge_permutation_sign<N>(ids, complement_ids)
+                               * static_cast<double>(detail::combination_rank<N>(ids));
+                    } else {
+                        std::array<std::size_t, K> const ids
+                                = reference::combination_from_rank<N, K>(rank);
+                        std::array<std::size_t, N - K> const complement_ids
+                                = reference::hodge_complement_ids<N, K>(ids);
+                        sum += reference::hodge_permutation_sign<N, K>(ids, complement_ids)
+                               * static_cast<double>(reference::combination_rank<N, K>(ids));
+                    }
+                },
+                checksum);
+    }
+    exec_space.fence();
+    return timer.seconds() / nb_repetitions;
+}
+
+template <class FormIndex, sil::exterior::CellComplex Complex, class Position, class Mesh>
+double time_fill_reduction_operator(Position position, Mesh mesh, int nb_repetitions)
+{
+    using IndexSeq
+            = ddc::to_type_seq_t<typename sil::tensor::TensorAccessor<FormIndex>::natural_domain_t>;
+    [[maybe_unused]] sil::tensor::tensor_accessor_for_domain_t<
+            sil::exterior::reduction_domain_t<IndexSeq>> reduction_accessor;
+    ddc::cartesian_prod_t<Mesh, sil::exterior::reduction_domain_t<IndexSeq>>
+            reduction_dom(mesh, reduction_accessor.domain());
+    ddc::Chunk reduction_alloc(reduction_dom, ddc::DeviceAllocator<double>());
+    sil::tensor::Tensor reduction_operator(reduction_alloc);
+
+    Kokkos::DefaultExecutionSpace const exec_space;
+    sil::exterior::fill_reduction_operator<
+            IndexSeq,
+            decltype(reduction_operator),
+            Position,
+            Kokkos::DefaultExecutionSpace,
+            Complex>(exec_space, reduction_operator, position);
+    exec_space.fence();
+    Kokkos::Timer timer;
+    for (int repetition = 0; repetition < nb_repetitions; ++repetition) {
+        sil::exterior::fill_reduction_operator<
+                IndexSeq,
+                decltype(reduction_operator),
+                Position,
+                Kokkos::DefaultExecutionSpace,
+                Complex>(exec_space, reduction_operator, position);
+    }
+    exec_space.fence();
+    return timer.seconds() / nb_repetitions;
+}
+
+int main(int argc, char** argv)
+{
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+    ddc::ScopeGuard const ddc_scope(argc, argv);
+
+    std::size_t const nb_cells = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    int const nb_repetitions = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    ddc::DiscreteDomain<DDimX> const mesh_x = ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(
+            ddc::Coordinate<X>(0.),
+            ddc::Coordinate<X>(1.),
+            ddc::DiscreteVector<DDimX>(nb_cells)));
+    ddc::DiscreteDomain<DDimY> const mesh_y = ddc::init_discrete_space<DDimY>(DDimY::init<DDimY>(
+            ddc::Coordinate<Y>(0.),
+            ddc::Coordinate<Y>(1.),
+            ddc::DiscreteVector<DDimY>(nb_cells)));
+    ddc::DiscreteDomain<DDimZ> const mesh_z = ddc::init_discrete_space<DDimZ>(DDimZ::init<DDimZ>(
+            ddc::Coordinate<Z>(0.),
+            ddc::Coordinate<Z>(1.),
+            ddc::DiscreteVector<DDimZ>(nb_cells)));
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ> const mesh_xyz(mesh_x, mesh_y, mesh_z);
+
+    // Sheared grid, so that the reduction operator is not diagonal.
+    [[maybe_unused]] sil::tensor::TensorAccessor<PositionIndex> position_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, PositionIndex>
+            position_dom(mesh_xyz, position_accessor.domain());
+    ddc::Chunk position_alloc(position_dom, ddc::DeviceAllocator<double>());
+    sil::tensor::Tensor position(position_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            mesh_xyz,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY, DDimZ> elem) {
+                double const x = ddc::coordinate(ddc::DiscreteElement<DDimX>(elem));
+                double const y = ddc::coordinate(ddc::DiscreteElement<DDimY>(elem));
+                double const z = ddc::coordinate(ddc::DiscreteElement<DDimZ>(elem));
+                position(elem, position.accessor().access_element<X>()) = x + 0.2 * y;
+                position(elem, position.accessor().access_element<Y>()) = y + 0.1 * z;
+                position(elem, position.accessor().access_element<Z>()) = z + 0.3 * x;
+            });
+
+    std::cout << "fill_reduction_operator on " << nb_cells << "^3 nodes, " << nb_repetitions
+              << " repetitions\n";
+    std::cout << "  1-form, primal complex: "
+              << time_fill_reduction_operator<
+                         OneFormIndex,
+                         sil::exterior::CellComplex::Primal>(position, mesh_xyz, nb_repetitions)
+              << " s\n";
+    std::cout << "  2-form, primal complex: "
+              << time_fill_reduction_operator<
+                         TwoFormIndex,
+                         sil::exterior::CellComplex::Primal>(position, mesh_xyz, nb_repetitions)
+              << " s\n";
+    std::cout << "  2-form, circumcentric dual complex: "
+              << time_fill_reduction_operator<
+                         TwoFormIndex,
+                         sil::exterior::CellComplex::CircumcentricDual>(
+                         position,
+                         mesh_xyz,
+                         nb_repetitions)
+              << " s\n";
+
+    std::size_t const nb_points = nb_cells * nb_cells * nb_cells;
+    std::cout << "combination rank, complement and sign on " << nb_points << " points\n";
+    std::cout << "  (4, 2), compile-time tables: "
+              << time_combinatorics<4, 2, true>(nb_points, nb_repetitions) << " s\n";
+    std::cout << "  (4, 2), reference loops: "
+              << time_combinatorics<4, 2, false>(nb_points, nb_repetitions) << " s\n";
+    return EXIT_SUCCESS;
+}
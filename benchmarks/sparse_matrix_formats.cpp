@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <similie/solvers/minimize_strong_formulation_residual.hpp>
+
+#include <Kokkos_Core.hpp>
+
+using csr_type = gko::matrix::Csr<double, gko::int32>;
+using vector_type = gko::matrix::Dense<double>;
+
+/*
+ * Dirichlet Laplacian on a structured grid of extents.size() dimensions, discretized by the
+ * (2 * extents.size() + 1)-point stencil. Its nearly uniform row lengths are those of the assembled
+ * magnetostatics operators.
+ */
+gko::matrix_data<double, gko::int32> structured_laplacian(std::vector<std::size_t> const& extents)
+{
+    std::size_t size = 1;
+    for (std::size_t const extent : extents) {
+        size *= extent;
+    }
+    auto const index = [](std::size_t value) { return static_cast<gko::int32>(value); };
+    gko::matrix_data<double, gko::int32> data(gko::dim<2>(size, size));
+    for (std::size_t row = 0; row < size; ++row) {
+        data.nonzeros.emplace_back(index(row), index(row), 2.0 * extents.size());
+        std::size_t stride = 1;
+        for (std::size_t dimension = extents.size(); dimension-- > 0;) {
+            std::size_t const coordinate = (row / stride) % extents[dimension];
+            if (coordinate > 0) {
+                data.nonzeros.emplace_back(index(row), index(row - stride), -1.0);
+            }
+            if (coordinate + 1 < extents[dimension]) {
+                data.nonzeros.emplace_back(index(row), index(row + stride), -1.0);
+            }
+            stride *= extents[dimension];
+        }
+    }
+    data.sort_row_major();
+    return data;
+}
+
+void benchmark_formats(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        std::vector<std::size_t> const& extents,
+        int nb_repetitions)
+{
+    std::shared_ptr<csr_type> const csr = csr_type::create(gko_exec);
+    csr->read(structured_laplacian(extents));
+    gko::size_type const size = csr->get_size()[0];
+    auto const x = vector_type::create(gko_exec, gko::dim<2>(size, 1));
+    x->fill(1.0);
+    auto const y = vector_type::create(gko_exec, gko::dim<2>(size, 1));
+
+    std::cout << "Laplacian on " << extents.size() << "D grid of " << size << " nodes, "
+              << csr->get_num_stored_elements() << " nonzeros, " << nb_repetitions
+              << " repetitions\n";
+    std::shared_ptr<gko::LinOp const> const preconditioner
+            = gko::preconditioner::Jacobi<double>::build().with_max_block_size(1U).on(gko_exec)
+                      ->generate(csr);
+    for (similie::solvers::MatrixFormat const matrix_format :
+         {similie::solvers::MatrixFormat::Csr,
+          similie::solvers::MatrixFormat::Ell,
+          similie::solvers::MatrixFormat::Sellp,
+          similie::solvers::MatrixFormat::Hybrid}) {
+        similie::solvers::StrongFormulationSolverSettings settings;
+        settings.matrix_format = matrix_format;
+        Kokkos::Timer conversion_timer;
+        std::shared_ptr<gko::LinOp const> const matrix
+                = similie::solvers::detail::convert_matrix_format(csr, settings);
+        gko_exec->synchronize();
+        double const conversion_duration = conversion_timer.seconds();
+
+        matrix->apply(x.get(), y.get());
+        gko_exec->synchronize();
+        Kokkos::Timer spmv_timer;
+        for (int repetition = 0; repetition < nb_repetitions; ++repetition) {
+            matrix->apply(x.get(), y.get());
+        }
+        gko_exec->synchronize();
+        double const spmv_duration = spmv_timer.seconds() / nb_repetitions;
+
+        auto const solution = vector_type::create(gko_exec, gko::dim<2>(size, 1));
+        solution->fill(0.0);
+        auto const solver
+                = gko::solver::Cg<double>::build()
+                          .with_generated_preconditioner(preconditioner)
+                          .with_criteria(
+                                  gko::stop::ResidualNorm<double>::build()
+                                          .with_reduction_factor(1.0e-8)
+                                          .on(gko_exec),
+                                  gko::stop::Iteration::build().with_max_iters(10000U).on(
+                                          gko_exec))
+                          .on(gko_exec)
+                          ->generate(matrix);
+        std::shared_ptr<gko::log::Convergence<double>> const logger
+                = gko::log::Convergence<double>::create();
+        solver->add_logger(logger);
+        gko_exec->synchronize();
+        Kokkos::Timer solve_timer;
+        solver->apply(x.get(), solution.get());
+        gko_exec->synchronize();
+        double const solve_duration = solve_timer.seconds();
+
+        std::cout << "  " << similie::solvers::matrix_format_name(matrix_format)
+                  << ": conversion " << conversion_duration << " s, SpMV " << spmv_duration
+                  << " s, CG " << solve_duration << " s (" << logger->get_num_iterations()
+                  << " iterations)\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+
+    std::size_t const n2d = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1024;
+    std::size_t const n3d = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 96;
+    int const nb_repetitions = argc > 3 ? std::atoi(argv[3]) : 50;
+
+    std::shared_ptr<gko::Executor const> const gko_exec
+            = gko::ext::kokkos::create_executor(Kokkos::DefaultExecutionSpace());
+    benchmark_formats(gko_exec, {n2d, n2d}, nb_repetitions);
+    benchmark_formats(gko_exec, {n3d, n3d, n3d}, nb_repetitions);
+    return EXIT_SUCCESS;
+}
@@ -16,6 +16,7 @@
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <numbers>
 #include <optional>
 #include <sstream>
@@ -25,7 +26,9 @@
 #include <variant>
 #include <vector>
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <similie/exterior/coboundary.hpp>
 #include <similie/exterior/codifferential.hpp>
 #include <similie/exterior/hodge_star.hpp>
@@ -280,6 +283,11 @@ void publish_outputs(
             "Solver iterations",
             "Number of conjugate-gradient iterations performed by the stationary "
             "strong-formulation solver.");
+    publish_output_number(
+            "Preconditioner rebuilds",
+            static_cast<double>(result.solver_diagnostics.preconditioner_rebuilds),
+            "Preconditioner rebuilds",
+            "Number of preconditioners generated by the nonlinear strong-formulation solver.");
     publish_output_string(
             "Solver backend",
             solver_settings.use_matrix_free ? "matrix-free" : "assembled-matrix",
@@ -681,6 +689,125 @@ template <class RowIndex, class ColumnIndex, class Equations, class Elem>
     }
 }
 
+/*
+ * Equations of a grid whose nodes are a subset of the nodes of the grid the wrapped equations are
+ * defined on (the coarse grids of the geometric multigrid): the material is sampled at the fine
+ * node each coarse node lies on.
+ */
+template <class Equations, class MemorySpace, class... DDim>
+class NodeSubsampledEquations
+{
+public:
+    using fine_node_view_type = Kokkos::View<std::size_t*, MemorySpace>;
+    static constexpr bool IS_LINEAR = Equations::IS_LINEAR;
+
+private:
+    Equations m_equations;
+    std::array<fine_node_view_type, sizeof...(DDim)> m_fine_nodes;
+
+public:
+    NodeSubsampledEquations(
+            Equations equations,
+            std::array<fine_node_view_type, sizeof...(DDim)> fine_nodes)
+        : m_equations(std::move(equations))
+        , m_fine_nodes(std::move(fine_nodes))
+    {
+    }
+
+    [[nodiscard]] Equations const& fine_equations() const
+    {
+        return m_equations;
+    }
+
+    [[nodiscard]] std::array<fine_node_view_type, sizeof...(DDim)> const& fine_nodes() const
+    {
+        return m_fine_nodes;
+    }
+
+    template <class Elem>
+    [[nodiscard]] KOKKOS_FUNCTION ddc::DiscreteElement<DDim...> fine_element(Elem elem) const
+    {
+        return ddc::DiscreteElement<DDim...>(ddc::DiscreteElement<DDim>(
+                m_fine_nodes[ddc::type_seq_rank_v<DDim, ddc::detail::TypeSeq<DDim...>>](
+                        elem.template uid<DDim>()))...);
+    }
+
+    template <class Index, class Elem>
+    [[nodiscard]] KOKKOS_FUNCTION double dpotential_dt(MagneticMoments moments, Elem elem) const
+    {
+        return dpotential_dt_component<Index>(m_equations, moments, fine_element(elem));
+    }
+
+    template <class RowIndex, class ColumnIndex, class Elem>
+    [[nodiscard]] KOKKOS_FUNCTION double jacobian(MagneticMoments moments, Elem elem) const
+    {
+        return jacobian_component<RowIndex, ColumnIndex>(m_equations, moments, fine_element(elem));
+    }
+};
+
+template <class Equations, class MemorySpace, class... DDim>
+struct NodeSubsampled
+{
+    using type = NodeSubsampledEquations<Equations, MemorySpace, DDim...>;
+};
+
+// Subsampling already subsampled equations composes the node maps instead of nesting wrappers.
+template <class Equations, class MemorySpace, class... DDim>
+struct NodeSubsampled<
+        NodeSubsampledEquations<Equations, MemorySpace, DDim...>,
+        MemorySpace,
+        DDim...>
+{
+    using type = NodeSubsampledEquations<Equations, MemorySpace, DDim...>;
+};
+
+/*
+ * Equations and node coordinates of the grid made of the nodes coarse_to_fine_node(I, n) of the
+ * grid described by equations and coords.
+ */
+template <class ExecSpace, class MemorySpace, class... DDim, class Equations, std::size_t Rank>
+auto subsample_nodes(
+        ExecSpace exec_space,
+        Equations const& equations,
+        std::array<coord_view_type<MemorySpace>, Rank> const& coords)
+{
+    static_assert(sizeof...(DDim) == Rank);
+    using subsampled_type = typename NodeSubsampled<Equations, MemorySpace, DDim...>::type;
+    using fine_node_view_type = typename subsampled_type::fine_node_view_type;
+    std::array<fine_node_view_type, Rank> fine_nodes;
+    std::array<coord_view_type<MemorySpace>, Rank> coarse_coords;
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+        std::size_t const fine_extent = coords[dim].extent(0);
+        std::size_t const coarse_extent = solvers::coarsened_extent(fine_extent);
+        fine_node_view_type const nodes("similie_multigrid_fine_nodes", coarse_extent);
+        Kokkos::View<double*, MemorySpace> const coarse_coord(
+                "similie_multigrid_coarse_coords",
+                coarse_extent);
+        auto const fine_coord = coords[dim];
+        fine_node_view_type previous_nodes;
+        if constexpr (std::is_same_v<subsampled_type, Equations>) {
+            previous_nodes = equations.fine_nodes()[dim];
+        }
+        Kokkos::parallel_for(
+                "similie_multigrid_subsample_nodes",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, coarse_extent),
+                KOKKOS_LAMBDA(std::size_t coarse_node) {
+                    std::size_t const node = solvers::coarse_to_fine_node(coarse_node, fine_extent);
+                    nodes(coarse_node) = previous_nodes.extent(0) == 0 ? node
+                                                                        : previous_nodes(node);
+                    coarse_coord(coarse_node) = fine_coord(node);
+                });
+        fine_nodes[dim] = nodes;
+        coarse_coords[dim] = coarse_coord;
+    }
+    exec_space.fence();
+    if constexpr (std::is_same_v<subsampled_type, Equations>) {
+        return std::pair(subsampled_type(equations.fine_equations(), fine_nodes), coarse_coords);
+    } else {
+        return std::pair(subsampled_type(equations, fine_nodes), coarse_coords);
+    }
+}
+
 struct DDimX
 {
     using continuous_dimension_type = X;
@@ -1263,6 +1390,38 @@ public:
         return m_nx * m_ny;
     }
 
+    // Nodal scalar potential, coupled to the nodes of the neighbouring cells' moments.
+    [[nodiscard]] solvers::StructuredCochainLayout<2, 1> multigrid_layout() const
+    {
+        return {.extents = {m_nx, m_ny}, .directions = {0U}, .stencil_radius = 2};
+    }
+
+    // Same discretization on every other node, for the geometric multigrid preconditioner.
+    template <class ExecSpace>
+    auto coarsen(ExecSpace exec_space) const
+    {
+        using coarse_equations_type =
+                typename NodeSubsampled<Equations, MemorySpace, DDimX, DDimY>::type;
+        using coarse_type = MagnetostaticsOperator2D<
+                MemorySpace,
+                coarse_equations_type,
+                MagneticVectorPotentialToMagneticInduction>;
+        if (!solvers::can_coarsen(multigrid_layout())) {
+            return std::optional<coarse_type>();
+        }
+        auto [coarse_equations, coarse_coords] = subsample_nodes<
+                ExecSpace,
+                MemorySpace,
+                DDimX,
+                DDimY>(exec_space, m_equations, std::array {m_x_coords, m_y_coords});
+        return std::optional<coarse_type>(
+                std::in_place,
+                std::move(coarse_equations),
+                coarse_coords[0],
+                coarse_coords[1],
+                m_criterion);
+    }
+
     [[nodiscard]] KOKKOS_INLINE_FUNCTION bool is_boundary_node(std::size_t i, std::size_t j) const
     {
         return i == 0 || j == 0 || i + 1 == m_nx || j + 1 == m_ny;
@@ -2013,6 +2172,44 @@ public:
         return 3 * m_nx * m_ny * m_nz;
     }
 
+    // Edge cochain with one component per direction, coupled through the cells' inductions.
+    [[nodiscard]] solvers::StructuredCochainLayout<3, 3> multigrid_layout() const
+    {
+        return {.extents = {m_nx, m_ny, m_nz}, .directions = {1U, 2U, 4U}, .stencil_radius = 2};
+    }
+
+    /*
+     * Same discretization (with the same gauge penalty) on every other node, for the geometric
+     * multigrid preconditioner.
+     */
+    template <class ExecSpace>
+    auto coarsen(ExecSpace exec_space) const
+    {
+        using coarse_equations_type =
+                typename NodeSubsampled<Equations, MemorySpace, DDimX, DDimY, DDimZ>::type;
+        using coarse_type = MagnetostaticsOperator3D<
+                MemorySpace,
+                coarse_equations_type,
+                MagneticVectorPotentialToMagneticInduction>;
+        if (!solvers::can_coarsen(multigrid_layout())) {
+            return std::optional<coarse_type>();
+        }
+        auto [coarse_equations, coarse_coords] = subsample_nodes<
+                ExecSpace,
+                MemorySpace,
+                DDimX,
+                DDimY,
+                DDimZ>(exec_space, m_equations, std::array {m_x_coords, m_y_coords, m_z_coords});
+        return std::optional<coarse_type>(
+                std::in_place,
+                std::move(coarse_equations),
+                coarse_coords[0],
+                coarse_coords[1],
+                coarse_coords[2],
+                m_gauge_penalty,
+                m_has_precomputed_stencils);
+    }
+
     [[nodiscard]] bool has_precomputed_stencils() const
     {
         return m_has_precomputed_stencils;
@@ -3112,39 +3309,33 @@ void apply_jacobian(
             });
 }
 
+inline constexpr int magnetostatics_3d_matrix_row_max_size = 128;
+
+/*
+ * Accumulates every row of the 3D magnetostatics Jacobian at state in local arrays, then hands
+ * them to write_row(row, count, columns, coefficients). Boundary rows hold the unit diagonal.
+ * The operator must have precomputed stencils.
+ */
 template <
         class MemorySpace,
         class Equations,
         class MagneticVectorPotentialToMagneticInduction,
-        class StateView>
-gko::matrix_data<double, gko::int32> assemble_matrix_data(
+        class StateView,
+        class RowWriter>
+void for_each_3d_magnetostatics_jacobian_row(
+        std::string const& label,
+        Kokkos::DefaultExecutionSpace exec_space,
         MagnetostaticsOperator3D<
                 MemorySpace,
                 Equations,
                 MagneticVectorPotentialToMagneticInduction> const& operator_model,
-        StateView state)
+        StateView state,
+        RowWriter write_row)
 {
-    if (!operator_model.has_precomputed_stencils()) {
-        auto const stencil_operator = MagnetostaticsOperator3D<
-                MemorySpace,
-                Equations,
-                MagneticVectorPotentialToMagneticInduction>(
-                operator_model.equations(),
-                operator_model.x_coords(),
-                operator_model.y_coords(),
-                operator_model.z_coords(),
-                operator_model.gauge_penalty(),
-                true);
-        return assemble_matrix_data(stencil_operator, state);
-    }
     std::size_t const size = operator_model.size();
     std::size_t const nx = operator_model.x_coords().extent(0);
     std::size_t const ny = operator_model.y_coords().extent(0);
     std::size_t const nz = operator_model.z_coords().extent(0);
-    Kokkos::DefaultExecutionSpace exec_space;
-    static constexpr int MATRIX_ROW_MAX_SIZE = 128;
-    Kokkos::View<int*> counts("similie_3d_magnetostatics_matrix_counts", size);
-
     auto const equations = operator_model.equations();
     auto const moment_columns = operator_model.moment_columns();
     auto const moment_coefficients = operator_model.moment_coefficients();
@@ -3169,26 +3360,29 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
     bool const use_divergence_gauge = use_divergence_gauge_3d();
 
     Kokkos::parallel_for(
-            "similie_count_3d_magnetostatics_jacobian",
+            label,
             Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
                     exec_space,
                     0,
                     static_cast<Kokkos::DefaultExecutionSpace::size_type>(size)),
             KOKKOS_LAMBDA(std::size_t row) {
-                int local_columns[MATRIX_ROW_MAX_SIZE] {};
+                int local_columns[magnetostatics_3d_matrix_row_max_size] {};
+                double local_coefficients[magnetostatics_3d_matrix_row_max_size] {};
                 auto add_entry = [&](int& count, std::size_t column, double value) {
                     if (value == 0.0) {
                         return;
                     }
                     for (int slot = 0; slot < count; ++slot) {
                         if (local_columns[slot] == static_cast<int>(column)) {
+                            local_coefficients[slot] += value;
                             return;
                         }
                     }
-                    if (count >= MATRIX_ROW_MAX_SIZE) {
+                    if (count >= magnetostatics_3d_matrix_row_max_size) {
                         Kokkos::abort("3D magnetostatics matrix row capacity exceeded");
                     }
                     local_columns[count] = static_cast<int>(column);
+                    local_coefficients[count] = value;
                     ++count;
                 };
 
@@ -3197,7 +3391,9 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
                 std::size_t const j = (node / nx) % ny;
                 std::size_t const k = node / (nx * ny);
                 if (i == 0 || j == 0 || k == 0 || i + 1 == nx || j + 1 == ny || k + 1 == nz) {
-                    counts(row) = 1;
+                    local_columns[0] = static_cast<int>(row);
+                    local_coefficients[0] = 1.0;
+                    write_row(row, 1, local_columns, local_coefficients);
                     return;
                 }
 
@@ -3318,9 +3514,207 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
                         }
                     }
                 }
-                counts(row) = count;
+                write_row(row, count, local_columns, local_coefficients);
             });
     exec_space.fence();
+}
+
+// Stores the number of nonzeros of every row.
+struct MatrixRowCounter
+{
+    Kokkos::View<int*> counts;
+
+    KOKKOS_FUNCTION void operator()(std::size_t row, int count, int const*, double const*) const
+    {
+        counts(row) = count;
+    }
+};
+
+// Packs the rows contiguously, starting at row_offsets(row).
+struct MatrixRowPacker
+{
+    Kokkos::View<std::size_t*> row_offsets;
+    Kokkos::View<int*> columns;
+    Kokkos::View<double*> coefficients;
+
+    KOKKOS_FUNCTION void operator()(
+            std::size_t row,
+            int count,
+            int const* local_columns,
+            double const* local_coefficients) const
+    {
+        std::size_t const offset = row_offsets(row);
+        for (int slot = 0; slot < count; ++slot) {
+            columns(offset + static_cast<std::size_t>(slot)) = local_columns[slot];
+            coefficients(offset + static_cast<std::size_t>(slot)) = local_coefficients[slot];
+        }
+    }
+};
+
+/*
+ * Overwrites the values of the rows of an existing CSR matrix, whose columns may be unsorted.
+ * Entries missing from the sparsity pattern are counted in mismatches.
+ */
+template <class RowPtrsView, class ColumnsView, class ValuesView>
+struct MatrixRowValueRefiller
+{
+    RowPtrsView row_ptrs;
+    ColumnsView columns;
+    ValuesView values;
+    Kokkos::View<int> mismatches;
+
+    KOKKOS_FUNCTION void operator()(
+            std::size_t row,
+            int count,
+            int const* local_columns,
+            double const* local_coefficients) const
+    {
+        for (auto entry = row_ptrs(row); entry < row_ptrs(row + 1); ++entry) {
+            values(entry) = 0.0;
+        }
+        for (int slot = 0; slot < count; ++slot) {
+            auto entry = row_ptrs(row);
+            while (entry < row_ptrs(row + 1) && columns(entry) != local_columns[slot]) {
+                ++entry;
+            }
+            if (entry == row_ptrs(row + 1)) {
+                Kokkos::atomic_inc(&mismatches());
+            } else {
+                values(entry) += local_coefficients[slot];
+            }
+        }
+    }
+};
+
+/*
+ * Writes the rows into the arrays of a CSR matrix whose row pointers are already known, sorting
+ * every row by column (insertion sort, rows being short) so that the result does not depend on the
+ * order in which the entries were accumulated.
+ */
+struct MatrixRowCsrWriter
+{
+    Kokkos::View<gko::int32*, Kokkos::MemoryUnmanaged> row_ptrs;
+    Kokkos::View<gko::int32*, Kokkos::MemoryUnmanaged> columns;
+    Kokkos::View<double*, Kokkos::MemoryUnmanaged> values;
+    bool skip_zeros;
+
+    KOKKOS_FUNCTION void operator()(
+            std::size_t row,
+            int count,
+            int const* local_columns,
+            double const* local_coefficients) const
+    {
+        gko::int32 const offset = row_ptrs(row);
+        gko::int32 length = 0;
+        for (int slot = 0; slot < count; ++slot) {
+            if (skip_zeros && local_coefficients[slot] == 0.0) {
+                continue;
+            }
+            gko::int32 position = length;
+            while (position > 0 && columns(offset + position - 1) > local_columns[slot]) {
+                columns(offset + position) = columns(offset + position - 1);
+                values(offset + position) = values(offset + position - 1);
+                --position;
+            }
+            columns(offset + position) = local_columns[slot];
+            values(offset + position) = local_coefficients[slot];
+            ++length;
+        }
+    }
+};
+
+/*
+ * Builds a Ginkgo CSR matrix directly in device arrays it owns: count_rows(counts) stores the
+ * number of entries of every row, which are scanned into the row pointers, then
+ * write_rows(writer) hands every row to a MatrixRowCsrWriter. gko_exec must address the memory of
+ * Kokkos::DefaultExecutionSpace.
+ */
+template <class CountRows, class WriteRows>
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> build_device_csr(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        std::size_t size,
+        bool skip_zeros,
+        CountRows&& count_rows,
+        WriteRows&& write_rows)
+{
+    Kokkos::DefaultExecutionSpace exec_space;
+    Kokkos::View<int*> counts("similie_magnetostatics_csr_counts", size);
+    count_rows(counts);
+
+    gko::array<gko::int32> row_ptrs(gko_exec, size + 1);
+    Kokkos::View<gko::int32*, Kokkos::MemoryUnmanaged> const
+            row_ptrs_view(row_ptrs.get_data(), size + 1);
+    Kokkos::parallel_scan(
+            "similie_scan_magnetostatics_csr_row_ptrs",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(exec_space, 0, size + 1),
+            KOKKOS_LAMBDA(std::size_t row, gko::int32 & partial_sum, bool is_final) {
+                if (is_final) {
+                    row_ptrs_view(row) = partial_sum;
+                }
+                if (row < size) {
+                    partial_sum += counts(row);
+                }
+            });
+    gko::int32 nonzeros = 0;
+    Kokkos::deep_copy(exec_space, nonzeros, Kokkos::subview(row_ptrs_view, size));
+    exec_space.fence();
+
+    gko::array<gko::int32> columns(gko_exec, static_cast<gko::size_type>(nonzeros));
+    gko::array<double> values(gko_exec, static_cast<gko::size_type>(nonzeros));
+    write_rows(MatrixRowCsrWriter {
+            row_ptrs_view,
+            Kokkos::View<gko::int32*, Kokkos::MemoryUnmanaged>(
+                    columns.get_data(),
+                    static_cast<std::size_t>(nonzeros)),
+            Kokkos::View<double*, Kokkos::MemoryUnmanaged>(
+                    values.get_data(),
+                    static_cast<std::size_t>(nonzeros)),
+            skip_zeros});
+    return std::shared_ptr<gko::matrix::Csr<double, gko::int32>>(
+            gko::matrix::Csr<double, gko::int32>::
+                    create(gko_exec,
+                           gko::dim<2>(size, size),
+                           std::move(values),
+                           std::move(columns),
+                           std::move(row_ptrs))
+                            .release());
+}
+
+template <
+        class MemorySpace,
+        class Equations,
+        class MagneticVectorPotentialToMagneticInduction,
+        class StateView>
+gko::matrix_data<double, gko::int32> assemble_matrix_data(
+        MagnetostaticsOperator3D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model,
+        StateView state)
+{
+    if (!operator_model.has_precomputed_stencils()) {
+        auto const stencil_operator = MagnetostaticsOperator3D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction>(
+                operator_model.equations(),
+                operator_model.x_coords(),
+                operator_model.y_coords(),
+                operator_model.z_coords(),
+                operator_model.gauge_penalty(),
+                true);
+        return assemble_matrix_data(stencil_operator, state);
+    }
+    std::size_t const size = operator_model.size();
+    Kokkos::DefaultExecutionSpace exec_space;
+    Kokkos::View<int*> counts("similie_3d_magnetostatics_matrix_counts", size);
+
+    for_each_3d_magnetostatics_jacobian_row(
+            "similie_count_3d_magnetostatics_jacobian",
+            exec_space,
+            operator_model,
+            state,
+            MatrixRowCounter {counts});
 
     auto counts_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
 
@@ -3338,169 +3732,12 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
     Kokkos::deep_copy(row_offsets_device, row_offsets_device_host);
     Kokkos::View<double*> coefficients("similie_3d_magnetostatics_matrix_coefficients", nonzeros);
     Kokkos::View<int*> columns("similie_3d_magnetostatics_matrix_columns", nonzeros);
-    Kokkos::parallel_for(
+    for_each_3d_magnetostatics_jacobian_row(
             "similie_fill_3d_magnetostatics_jacobian",
-            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
-                    exec_space,
-                    0,
-                    static_cast<Kokkos::DefaultExecutionSpace::size_type>(size)),
-            KOKKOS_LAMBDA(std::size_t row) {
-                int local_columns[MATRIX_ROW_MAX_SIZE] {};
-                double local_coefficients[MATRIX_ROW_MAX_SIZE] {};
-                auto add_entry = [&](int& count, std::size_t column, double value) {
-                    if (value == 0.0) {
-                        return;
-                    }
-                    for (int slot = 0; slot < count; ++slot) {
-                        if (local_columns[slot] == static_cast<int>(column)) {
-                            local_coefficients[slot] += value;
-                            return;
-                        }
-                    }
-                    if (count >= MATRIX_ROW_MAX_SIZE) {
-                        Kokkos::abort("3D magnetostatics matrix row capacity exceeded");
-                    }
-                    local_columns[count] = static_cast<int>(column);
-                    local_coefficients[count] = value;
-                    ++count;
-                };
-
-                std::size_t const node = row / 3;
-                std::size_t const i = node % nx;
-                std::size_t const j = (node / nx) % ny;
-                std::size_t const k = node / (nx * ny);
-                if (i == 0 || j == 0 || k == 0 || i + 1 == nx || j + 1 == ny || k + 1 == nz) {
-                    std::size_t const offset = row_offsets_device(row);
-                    columns(offset) = static_cast<int>(row);
-                    coefficients(offset) = 1.0;
-                    return;
-                }
-
-                int count = 0;
-                if (use_divergence_gauge) {
-                    for (int transposed_slot = 0;
-                         transposed_slot < transposed_codifferential_counts(row);
-                         ++transposed_slot) {
-                        std::size_t const codifferential_row = static_cast<std::size_t>(
-                                transposed_codifferential_rows(row, transposed_slot));
-                        double const row_coefficient
-                                = transposed_codifferential_coefficients(row, transposed_slot);
-                        for (int column_slot = 0;
-                             column_slot < codifferential_counts(codifferential_row);
-                             ++column_slot) {
-                            add_entry(
-                                    count,
-                                    static_cast<std::size_t>(codifferential_columns(
-                                            codifferential_row,
-                                            column_slot)),
-                                    divergence_gauge_factor
-                                            * codifferential_weights(codifferential_row)
-                                            * row_coefficient
-                                            * codifferential_coefficients(
-                                                    codifferential_row,
-                                                    column_slot));
-                        }
-                    }
-                } else {
-                    add_entry(
-                            count,
-                            row,
-                            gauge_penalty
-                                    * vector_potential_hodge_factor(
-                                            static_cast<int>(row % 3),
-                                            x_coords,
-                                            y_coords,
-                                            z_coords,
-                                            i,
-                                            j,
-                                            k));
-                }
-                for (int slot = 0; slot < transposed_moment_counts(row); ++slot) {
-                    std::size_t const moment_row
-                            = static_cast<std::size_t>(transposed_moment_rows(row, slot));
-                    double const row_coefficient = transposed_moment_coefficients(row, slot);
-                    std::size_t const sampled_node = moment_row / 3;
-                    std::size_t const sampled_i = sampled_node % nx;
-                    std::size_t const sampled_j = (sampled_node / nx) % ny;
-                    std::size_t const sampled_k = sampled_node / (nx * ny);
-                    auto const sampled_elem = ddc::
-                            DiscreteElement<DDimX, DDimY, DDimZ>(sampled_i, sampled_j, sampled_k);
-                    std::array<double, 3> state_moments {};
-                    for (int moment_component = 0; moment_component < 3; ++moment_component) {
-                        std::size_t const current_moment_row
-                                = 3 * sampled_node + static_cast<std::size_t>(moment_component);
-                        for (int moment_slot = 0; moment_slot < moment_counts(current_moment_row);
-                             ++moment_slot) {
-                            state_moments[moment_component]
-                                    += moment_coefficients(current_moment_row, moment_slot)
-                                       * state(static_cast<std::size_t>(moment_columns(
-                                                       current_moment_row,
-                                                       moment_slot)),
-                                               0);
-                        }
-                    }
-                    MagneticMoments const moments {
-                            state_moments[0],
-                            state_moments[1],
-                            state_moments[2],
-                    };
-                    std::array<double, 3> jacobian_row {};
-                    double hodge_factor = 1.0;
-                    if (moment_row % 3 == 0) {
-                        jacobian_row
-                                = {jacobian_component<X, X>(equations, moments, sampled_elem),
-                                   jacobian_component<X, Y>(equations, moments, sampled_elem),
-                                   jacobian_component<X, Z>(equations, moments, sampled_elem)};
-                        hodge_factor = magnetic_induction_hodge_factor<
-                                X>(x_coords, y_coords, z_coords, sampled_i, sampled_j, sampled_k);
-                    } else if (moment_row % 3 == 1) {
-                        jacobian_row
-                                = {jacobian_component<Y, X>(equations, moments, sampled_elem),
-                                   jacobian_component<Y, Y>(equations, moments, sampled_elem),
-                                   jacobian_component<Y, Z>(equations, moments, sampled_elem)};
-                        hodge_factor = magnetic_y_response_sign
-                                       * magnetic_induction_hodge_factor<Y>(
-                                               x_coords,
-                                               y_coords,
-                                               z_coords,
-                                               sampled_i,
-                                               sampled_j,
-                                               sampled_k);
-                    } else {
-                        jacobian_row
-                                = {jacobian_component<Z, X>(equations, moments, sampled_elem),
-                                   jacobian_component<Z, Y>(equations, moments, sampled_elem),
-                                   jacobian_component<Z, Z>(equations, moments, sampled_elem)};
-                        hodge_factor = magnetic_induction_hodge_factor<
-                                Z>(x_coords, y_coords, z_coords, sampled_i, sampled_j, sampled_k);
-                    }
-                    for (int moment_component = 0; moment_component < 3; ++moment_component) {
-                        double const jacobian_coefficient
-                                = hodge_factor * jacobian_row[moment_component];
-                        if (jacobian_coefficient == 0.0) {
-                            continue;
-                        }
-                        std::size_t const current_moment_row
-                                = 3 * sampled_node + static_cast<std::size_t>(moment_component);
-                        for (int moment_slot = 0; moment_slot < moment_counts(current_moment_row);
-                             ++moment_slot) {
-                            add_entry(
-                                    count,
-                                    static_cast<std::size_t>(
-                                            moment_columns(current_moment_row, moment_slot)),
-                                    row_coefficient * jacobian_coefficient
-                                            * moment_coefficients(current_moment_row, moment_slot));
-                        }
-                    }
-                }
-                std::size_t const offset = row_offsets_device(row);
-                for (int slot = 0; slot < count; ++slot) {
-                    columns(offset + static_cast<std::size_t>(slot)) = local_columns[slot];
-                    coefficients(offset + static_cast<std::size_t>(slot))
-                            = local_coefficients[slot];
-                }
-            });
-    exec_space.fence();
+            exec_space,
+            operator_model,
+            state,
+            MatrixRowPacker {row_offsets_device, columns, coefficients});
 
     auto coefficients_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), coefficients);
     auto columns_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), columns);
@@ -3534,6 +3771,58 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
     return matrix_data;
 }
 
+/*
+ * Refills in place the values of a Jacobian previously assembled at another state, keeping its
+ * sparsity pattern. Returns false if the Jacobian at state has entries outside of the pattern, in
+ * which case the matrix must be reassembled.
+ */
+template <
+        class MemorySpace,
+        class Equations,
+        class MagneticVectorPotentialToMagneticInduction,
+        class StateView,
+        class RowPtrsView,
+        class ColumnsView,
+        class ValuesView>
+bool refill_matrix_values(
+        MagnetostaticsOperator3D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model,
+        StateView state,
+        RowPtrsView row_ptrs,
+        ColumnsView columns,
+        ValuesView values)
+{
+    if (!operator_model.has_precomputed_stencils()) {
+        auto const stencil_operator = MagnetostaticsOperator3D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction>(
+                operator_model.equations(),
+                operator_model.x_coords(),
+                operator_model.y_coords(),
+                operator_model.z_coords(),
+                operator_model.gauge_penalty(),
+                true);
+        return refill_matrix_values(stencil_operator, state, row_ptrs, columns, values);
+    }
+    Kokkos::View<int> mismatches("similie_3d_magnetostatics_matrix_pattern_mismatches");
+    for_each_3d_magnetostatics_jacobian_row(
+            "similie_refill_3d_magnetostatics_jacobian",
+            Kokkos::DefaultExecutionSpace(),
+            operator_model,
+            state,
+            MatrixRowValueRefiller<RowPtrsView, ColumnsView, ValuesView> {
+                    row_ptrs,
+                    columns,
+                    values,
+                    mismatches});
+    int mismatches_host = 0;
+    Kokkos::deep_copy(mismatches_host, mismatches);
+    return mismatches_host == 0;
+}
+
 template <class MemorySpace, class Equations, class MagneticVectorPotentialToMagneticInduction>
 gko::matrix_data<double, gko::int32> assemble_matrix_data(
         MagnetostaticsOperator3D<
@@ -3546,23 +3835,96 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
     return assemble_matrix_data(operator_model, state);
 }
 
+/*
+ * Same Jacobian as assemble_matrix_data, written by the device straight into the arrays of a Ginkgo
+ * CSR matrix (see build_device_csr).
+ */
 template <
         class MemorySpace,
         class Equations,
         class MagneticVectorPotentialToMagneticInduction,
         class StateView>
-gko::matrix_data<double, gko::int32> assemble_matrix_data(
-        MagnetostaticsOperator2D<
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> assemble_csr_matrix(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        MagnetostaticsOperator3D<
                 MemorySpace,
                 Equations,
                 MagneticVectorPotentialToMagneticInduction> const& operator_model,
         StateView state)
+{
+    if (!operator_model.has_precomputed_stencils()) {
+        auto const stencil_operator = MagnetostaticsOperator3D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction>(
+                operator_model.equations(),
+                operator_model.x_coords(),
+                operator_model.y_coords(),
+                operator_model.z_coords(),
+                operator_model.gauge_penalty(),
+                true);
+        return assemble_csr_matrix(gko_exec, stencil_operator, state);
+    }
+    Kokkos::DefaultExecutionSpace exec_space;
+    return build_device_csr(
+            gko_exec,
+            operator_model.size(),
+            false,
+            [&](Kokkos::View<int*> counts) {
+                for_each_3d_magnetostatics_jacobian_row(
+                        "similie_count_3d_magnetostatics_csr",
+                        exec_space,
+                        operator_model,
+                        state,
+                        MatrixRowCounter {counts});
+            },
+            [&](MatrixRowCsrWriter const& writer) {
+                for_each_3d_magnetostatics_jacobian_row(
+                        "similie_fill_3d_magnetostatics_csr",
+                        exec_space,
+                        operator_model,
+                        state,
+                        writer);
+            });
+}
+
+template <class MemorySpace, class Equations, class MagneticVectorPotentialToMagneticInduction>
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> assemble_csr_matrix(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        MagnetostaticsOperator3D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model)
+{
+    Kokkos::View<double**, MemorySpace> state("similie_3d_linear_state", operator_model.size(), 1);
+    Kokkos::deep_copy(state, 0.0);
+    return assemble_csr_matrix(gko_exec, operator_model, state);
+}
+
+inline constexpr int magnetostatics_2d_matrix_row_max_size = 64;
+
+/*
+ * Accumulates every row of the 2D magnetostatics Jacobian at state in the padded arrays
+ * coefficients and columns, counts holding the number of slots used by every row (zero
+ * coefficients included). Boundary rows hold the unit diagonal.
+ */
+template <
+        class MemorySpace,
+        class Equations,
+        class MagneticVectorPotentialToMagneticInduction,
+        class StateView>
+void fill_2d_magnetostatics_jacobian_rows(
+        MagnetostaticsOperator2D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model,
+        StateView state,
+        Kokkos::View<double* [magnetostatics_2d_matrix_row_max_size]> coefficients,
+        Kokkos::View<int* [magnetostatics_2d_matrix_row_max_size]> columns,
+        Kokkos::View<int*> counts)
 {
     std::size_t const size = operator_model.size();
     Kokkos::DefaultExecutionSpace exec_space;
-    Kokkos::View<double* [64]> coefficients("similie_magnetostatics_matrix_coefficients", size);
-    Kokkos::View<int* [64]> columns("similie_magnetostatics_matrix_columns", size);
-    Kokkos::View<int*> counts("similie_magnetostatics_matrix_counts", size);
 
     auto equations = operator_model.equations();
     auto const criterion = operator_model.criterion();
@@ -3612,7 +3974,7 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
                             return;
                         }
                     }
-                    if (count >= 64) {
+                    if (count >= magnetostatics_2d_matrix_row_max_size) {
                         Kokkos::abort("magnetostatics matrix row capacity exceeded");
                     }
                     columns(row, count) = static_cast<int>(column);
@@ -3620,7 +3982,7 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
                     ++count;
                 };
 
-                for (int slot = 0; slot < 64; ++slot) {
+                for (int slot = 0; slot < magnetostatics_2d_matrix_row_max_size; ++slot) {
                     set_entry(slot, row, 0.0);
                 }
 
@@ -3714,13 +4076,35 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
                 counts(row) = count;
             });
     exec_space.fence();
+}
+
+template <
+        class MemorySpace,
+        class Equations,
+        class MagneticVectorPotentialToMagneticInduction,
+        class StateView>
+gko::matrix_data<double, gko::int32> assemble_matrix_data(
+        MagnetostaticsOperator2D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model,
+        StateView state)
+{
+    std::size_t const size = operator_model.size();
+    Kokkos::View<double* [magnetostatics_2d_matrix_row_max_size]>
+            coefficients("similie_magnetostatics_matrix_coefficients", size);
+    Kokkos::View<int* [magnetostatics_2d_matrix_row_max_size]>
+            columns("similie_magnetostatics_matrix_columns", size);
+    Kokkos::View<int*> counts("similie_magnetostatics_matrix_counts", size);
+
+    fill_2d_magnetostatics_jacobian_rows(operator_model, state, coefficients, columns, counts);
 
     auto coefficients_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), coefficients);
     auto columns_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), columns);
     auto counts_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
 
     gko::matrix_data<double, gko::int32> matrix_data(gko::dim<2>(size, size));
-    matrix_data.nonzeros.reserve(size * 64);
+    matrix_data.nonzeros.reserve(size * magnetostatics_2d_matrix_row_max_size);
     for (std::size_t row = 0; row < size; ++row) {
         for (int slot = 0; slot < counts_host(row); ++slot) {
             double const coefficient = coefficients_host(row, slot);
@@ -3748,6 +4132,76 @@ gko::matrix_data<double, gko::int32> assemble_matrix_data(
     return assemble_matrix_data(operator_model, state);
 }
 
+// Same Jacobian as assemble_matrix_data, written by the device straight into a Ginkgo CSR matrix.
+template <
+        class MemorySpace,
+        class Equations,
+        class MagneticVectorPotentialToMagneticInduction,
+        class StateView>
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> assemble_csr_matrix(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        MagnetostaticsOperator2D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model,
+        StateView state)
+{
+    std::size_t const size = operator_model.size();
+    Kokkos::DefaultExecutionSpace exec_space;
+    Kokkos::View<double* [magnetostatics_2d_matrix_row_max_size]>
+            coefficients("similie_magnetostatics_matrix_coefficients", size);
+    Kokkos::View<int* [magnetostatics_2d_matrix_row_max_size]>
+            columns("similie_magnetostatics_matrix_columns", size);
+    Kokkos::View<int*> slot_counts("similie_magnetostatics_matrix_slot_counts", size);
+    fill_2d_magnetostatics_jacobian_rows(operator_model, state, coefficients, columns, slot_counts);
+    auto const row_policy = Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(exec_space, 0, size);
+    return build_device_csr(
+            gko_exec,
+            size,
+            true,
+            [&](Kokkos::View<int*> counts) {
+                Kokkos::parallel_for(
+                        "similie_count_magnetostatics_csr",
+                        row_policy,
+                        KOKKOS_LAMBDA(std::size_t row) {
+                            int count = 0;
+                            for (int slot = 0; slot < slot_counts(row); ++slot) {
+                                count += coefficients(row, slot) != 0.0 ? 1 : 0;
+                            }
+                            counts(row) = count;
+                        });
+                exec_space.fence();
+            },
+            [&](MatrixRowCsrWriter const& writer) {
+                Kokkos::parallel_for(
+                        "similie_fill_magnetostatics_csr",
+                        row_policy,
+                        KOKKOS_LAMBDA(std::size_t row) {
+                            int local_columns[magnetostatics_2d_matrix_row_max_size] {};
+                            double local_coefficients[magnetostatics_2d_matrix_row_max_size] {};
+                            for (int slot = 0; slot < slot_counts(row); ++slot) {
+                                local_columns[slot] = columns(row, slot);
+                                local_coefficients[slot] = coefficients(row, slot);
+                            }
+                            writer(row, slot_counts(row), local_columns, local_coefficients);
+                        });
+                exec_space.fence();
+            });
+}
+
+template <class MemorySpace, class Equations, class MagneticVectorPotentialToMagneticInduction>
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> assemble_csr_matrix(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        MagnetostaticsOperator2D<
+                MemorySpace,
+                Equations,
+                MagneticVectorPotentialToMagneticInduction> const& operator_model)
+{
+    Kokkos::View<double**> state("similie_2d_linear_state", operator_model.size(), 1);
+    Kokkos::deep_copy(state, 0.0);
+    return assemble_csr_matrix(gko_exec, operator_model, state);
+}
+
 } // namespace magnetostatics_local
 
 using magnetostatics_local::X;
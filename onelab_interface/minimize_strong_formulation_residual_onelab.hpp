@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <stdexcept>
@@ -60,6 +63,12 @@ inline double preconditioner_to_control_value(solvers::PreconditionerType precon
         return 6.0;
     case solvers::PreconditionerType::GeneralIsai:
         return 7.0;
+    case solvers::PreconditionerType::GeometricMultigrid:
+        return 8.0;
+    case solvers::PreconditionerType::Fourier:
+        return 9.0;
+    case solvers::PreconditionerType::AlgebraicMultigrid:
+        return 10.0;
     }
     return 1.0;
 }
@@ -84,6 +93,12 @@ inline solvers::PreconditionerType preconditioner_from_control_value(double valu
         return solvers::PreconditionerType::IrJacobi;
     case 7:
         return solvers::PreconditionerType::GeneralIsai;
+    case 8:
+        return solvers::PreconditionerType::GeometricMultigrid;
+    case 9:
+        return solvers::PreconditionerType::Fourier;
+    case 10:
+        return solvers::PreconditionerType::AlgebraicMultigrid;
     default:
         throw std::runtime_error("invalid strong-formulation preconditioner control value");
     }
@@ -150,9 +165,9 @@ void synchronize_controls(
             "Ginkgo preconditioner used by the stationary strong-formulation solver.",
             preconditioner_to_control_value(solver_settings.preconditioner),
             0.0,
-            7.0,
+            10.0,
             1.0,
-            std::vector<double> {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0},
+            std::vector<double> {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0},
             std::map<double, std::string> {
                     {0.0, "Identity"},
                     {1.0, "Jacobi"},
@@ -162,6 +177,9 @@ void synchronize_controls(
                     {5.0, "ChebyshevJacobi"},
                     {6.0, "IrJacobi"},
                     {7.0, "GeneralIsai"},
+                    {8.0, "GeometricMultigrid"},
+                    {9.0, "Fourier"},
+                    {10.0, "AlgebraicMultigrid"},
             });
     publish_or_sync_number(
             problem_parameter_name("1Solver", "6SOR relaxation factor"),
@@ -219,6 +237,150 @@ void synchronize_controls(
             1.e-12,
             2.0,
             0.1);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "13Multigrid cycle"),
+            "Multigrid cycle",
+            "Cycle used by the multigrid preconditioners.",
+            solver_settings.multigrid_cycle == solvers::MultigridCycle::W ? 1.0 : 0.0,
+            0.0,
+            1.0,
+            1.0,
+            std::vector<double> {0.0, 1.0},
+            std::map<double, std::string> {{0.0, "V"}, {1.0, "W"}});
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "14Multigrid levels"),
+            "Multigrid levels",
+            "Maximum number of grid levels used by the multigrid preconditioners.",
+            static_cast<double>(solver_settings.multigrid_max_levels),
+            1.0,
+            64.0,
+            1.0);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "15Multigrid smoothing steps"),
+            "Multigrid smoothing steps",
+            "Smoothing steps before and after each coarse-grid correction of the multigrid "
+            "preconditioners.",
+            static_cast<double>(solver_settings.multigrid_smoothing_steps),
+            1.0,
+            1.e6,
+            1.0);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "16Preconditioner reuse iterations"),
+            "Preconditioner reuse iterations",
+            "Maximum number of nonlinear iterations sharing a preconditioner (0 or 1 rebuilds it "
+            "at every iteration).",
+            static_cast<double>(solver_settings.preconditioner_reuse_iterations),
+            0.0,
+            1.e6,
+            1.0);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "17Preconditioner reuse iterations growth"),
+            "Preconditioner reuse iterations growth",
+            "Relative growth of the inner Krylov iterations triggering an early preconditioner "
+            "rebuild.",
+            solver_settings.preconditioner_reuse_iterations_growth,
+            0.0,
+            1.e6,
+            0.1);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "18Use Jacobian-free Newton"),
+            "Use Jacobian-free Newton",
+            "Approximate the Jacobian of nonlinear problems by finite differences instead of "
+            "assembling it.",
+            solver_settings.use_jacobian_free ? 1.0 : 0.0,
+            0.0,
+            1.0,
+            1.0,
+            std::vector<double> {0.0, 1.0},
+            std::map<double, std::string> {{0.0, "No"}, {1.0, "Yes"}});
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "19Newton forcing"),
+            "Newton forcing",
+            "Relative tolerance of the inner Krylov solves of nonlinear problems.",
+            static_cast<double>(solver_settings.newton_forcing),
+            0.0,
+            2.0,
+            1.0,
+            std::vector<double> {0.0, 1.0, 2.0},
+            std::map<double, std::string> {
+                    {0.0, "Constant"},
+                    {1.0, "EisenstatWalker1"},
+                    {2.0, "EisenstatWalker2"},
+            });
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "20Matrix format"),
+            "Matrix format",
+            "Storage of the assembled matrix in the Krylov iterations.",
+            static_cast<double>(solver_settings.matrix_format),
+            0.0,
+            3.0,
+            1.0,
+            std::vector<double> {0.0, 1.0, 2.0, 3.0},
+            std::map<double, std::string> {
+                    {0.0, "Csr"},
+                    {1.0, "Ell"},
+                    {2.0, "Sellp"},
+                    {3.0, "Hybrid"},
+            });
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "22Multigrid smoother"),
+            "Multigrid smoother",
+            "Smoother of the levels of the algebraic multigrid preconditioner.",
+            static_cast<double>(solver_settings.multigrid_smoother),
+            0.0,
+            2.0,
+            1.0,
+            std::vector<double> {0.0, 1.0, 2.0},
+            std::map<double, std::string> {
+                    {0.0, "Jacobi"},
+                    {1.0, "SymmetricGaussSeidel"},
+                    {2.0, "Chebyshev"},
+            });
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "23Multigrid relaxation factor"),
+            "Multigrid relaxation factor",
+            "Damping of the Jacobi smoother of the algebraic multigrid preconditioner.",
+            solver_settings.multigrid_relaxation_factor,
+            1.e-12,
+            2.0,
+            0.1);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "24Multigrid coarse solver"),
+            "Multigrid coarse solver",
+            "Solver of the coarsest level of the algebraic multigrid preconditioner.",
+            static_cast<double>(solver_settings.multigrid_coarse_solver),
+            0.0,
+            1.0,
+            1.0,
+            std::vector<double> {0.0, 1.0},
+            std::map<double, std::string> {{0.0, "Cg"}, {1.0, "Smoother"}});
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "25Multigrid coarse size"),
+            "Multigrid coarse size",
+            "Number of rows below which the multigrid preconditioners stop coarsening.",
+            static_cast<double>(solver_settings.multigrid_coarse_size),
+            1.0,
+            1.e9,
+            1.0);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "26Multigrid coarse iterations"),
+            "Multigrid coarse iterations",
+            "Iterations of the solver of the coarsest level of the multigrid preconditioners.",
+            static_cast<double>(solver_settings.multigrid_coarse_iterations),
+            1.0,
+            1.e6,
+            1.0);
+    publish_or_sync_number(
+            problem_parameter_name("1Solver", "21Use mixed precision"),
+            "Use mixed precision",
+            "Refine in double precision the solutions of a single-precision Krylov solver of "
+            "linear problems.",
+            solver_settings.use_mixed_precision ? 1.0 : 0.0,
+            0.0,
+            1.0,
+            1.0,
+            std::vector<double> {0.0, 1.0},
+            std::map<double, std::string> {{0.0, "No"}, {1.0, "Yes"}});
 }
 
 template <class SolverSettings, class ProblemParameterName, class GetFirstNumberValue>
@@ -268,6 +430,70 @@ SolverSettings apply_control_overrides(
     solver_settings.ir_relaxation_factor = get_first_number_value(
             problem_parameter_name("1Solver", "12IR relaxation factor"),
             solver_settings.ir_relaxation_factor);
+    solver_settings.multigrid_cycle
+            = get_first_number_value(
+                      problem_parameter_name("1Solver", "13Multigrid cycle"),
+                      solver_settings.multigrid_cycle == solvers::MultigridCycle::W ? 1.0 : 0.0)
+                              > 0.5
+                      ? solvers::MultigridCycle::W
+                      : solvers::MultigridCycle::V;
+    solver_settings.multigrid_max_levels = static_cast<unsigned int>(get_first_number_value(
+            problem_parameter_name("1Solver", "14Multigrid levels"),
+            static_cast<double>(solver_settings.multigrid_max_levels)));
+    solver_settings.multigrid_smoothing_steps = static_cast<unsigned int>(get_first_number_value(
+            problem_parameter_name("1Solver", "15Multigrid smoothing steps"),
+            static_cast<double>(solver_settings.multigrid_smoothing_steps)));
+    solver_settings.preconditioner_reuse_iterations = static_cast<unsigned int>(
+            get_first_number_value(
+                    problem_parameter_name("1Solver", "16Preconditioner reuse iterations"),
+                    static_cast<double>(solver_settings.preconditioner_reuse_iterations)));
+    solver_settings.preconditioner_reuse_iterations_growth = get_first_number_value(
+            problem_parameter_name("1Solver", "17Preconditioner reuse iterations growth"),
+            solver_settings.preconditioner_reuse_iterations_growth);
+    solver_settings.use_jacobian_free
+            = (get_first_number_value(
+                       problem_parameter_name("1Solver", "18Use Jacobian-free Newton"),
+                       solver_settings.use_jacobian_free ? 1.0 : 0.0)
+               != 0.0);
+    solver_settings.newton_forcing = static_cast<solvers::NewtonForcing>(std::clamp(
+            static_cast<int>(std::lround(get_first_number_value(
+                    problem_parameter_name("1Solver", "19Newton forcing"),
+                    static_cast<double>(solver_settings.newton_forcing)))),
+            0,
+            2));
+    solver_settings.matrix_format = static_cast<solvers::MatrixFormat>(std::clamp(
+            static_cast<int>(std::lround(get_first_number_value(
+                    problem_parameter_name("1Solver", "20Matrix format"),
+                    static_cast<double>(solver_settings.matrix_format)))),
+            0,
+            3));
+    solver_settings.use_mixed_precision
+            = (get_first_number_value(
+                       problem_parameter_name("1Solver", "21Use mixed precision"),
+                       solver_settings.use_mixed_precision ? 1.0 : 0.0)
+               != 0.0);
+    solver_settings.multigrid_smoother = static_cast<solvers::MultigridSmoother>(std::clamp(
+            static_cast<int>(std::lround(get_first_number_value(
+                    problem_parameter_name("1Solver", "22Multigrid smoother"),
+                    static_cast<double>(solver_settings.multigrid_smoother)))),
+            0,
+            2));
+    solver_settings.multigrid_relaxation_factor = get_first_number_value(
+            problem_parameter_name("1Solver", "23Multigrid relaxation factor"),
+            solver_settings.multigrid_relaxation_factor);
+    solver_settings.multigrid_coarse_solver
+            = get_first_number_value(
+                      problem_parameter_name("1Solver", "24Multigrid coarse solver"),
+                      static_cast<double>(solver_settings.multigrid_coarse_solver))
+                              > 0.5
+                      ? solvers::MultigridCoarseSolver::Smoother
+                      : solvers::MultigridCoarseSolver::Cg;
+    solver_settings.multigrid_coarse_size = static_cast<std::size_t>(get_first_number_value(
+            problem_parameter_name("1Solver", "25Multigrid coarse size"),
+            static_cast<double>(solver_settings.multigrid_coarse_size)));
+    solver_settings.multigrid_coarse_iterations = static_cast<unsigned int>(get_first_number_value(
+            problem_parameter_name("1Solver", "26Multigrid coarse iterations"),
+            static_cast<double>(solver_settings.multigrid_coarse_iterations)));
     return solver_settings;
 }
 
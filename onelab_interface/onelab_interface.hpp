@@ -108,6 +108,9 @@ struct MinimizeStrongFormulationResidualProblem
     double chebyshev_upper_bound = 1.5;
     unsigned int ir_iterations = 8U;
     double ir_relaxation_factor = 1.0;
+    solvers::MultigridCycle multigrid_cycle = solvers::MultigridCycle::V;
+    unsigned int multigrid_max_levels = 10U;
+    unsigned int multigrid_smoothing_steps = 2U;
 };
 
 struct SingleElectricalConductorMaterialWithSingleLinearMagneticMaterialPreprocess
@@ -441,6 +444,17 @@ inline solvers::Criterion parse_solver_criterion(std::string const& value)
     throw std::runtime_error("unsupported solver criterion '" + value + "' in .silpro file");
 }
 
+inline solvers::MultigridCycle parse_multigrid_cycle(std::string const& value)
+{
+    if (value == "V") {
+        return solvers::MultigridCycle::V;
+    }
+    if (value == "W") {
+        return solvers::MultigridCycle::W;
+    }
+    throw std::runtime_error("unsupported multigrid cycle '" + value + "' in .silpro file");
+}
+
 inline SilproProblem parse_silpro_problem(std::filesystem::path const& file)
 {
     SilproSection const root = parse_silpro_tree(file);
@@ -527,6 +541,16 @@ inline SilproProblem parse_silpro_problem(std::filesystem::path const& file)
             solver_section,
             "IrRelaxationFactor",
             std::to_string(problem.solver_settings.ir_relaxation_factor)));
+    problem.solver_settings.multigrid_cycle
+            = parse_multigrid_cycle(get_value_or(solver_section, "MultigridCycle", "V"));
+    problem.solver_settings.multigrid_max_levels = parse_number<unsigned int>(get_value_or(
+            solver_section,
+            "MultigridMaxLevels",
+            std::to_string(problem.solver_settings.multigrid_max_levels)));
+    problem.solver_settings.multigrid_smoothing_steps = parse_number<unsigned int>(get_value_or(
+            solver_section,
+            "MultigridSmoothingSteps",
+            std::to_string(problem.solver_settings.multigrid_smoothing_steps)));
 
     if (problem.physics == SupportedPhysics::ScalarFieldWithPowerCoupling) {
         SilproSection const& section
@@ -1291,6 +1315,9 @@ private:
                 .chebyshev_upper_bound = problem.solver_settings.chebyshev_upper_bound,
                 .ir_iterations = problem.solver_settings.ir_iterations,
                 .ir_relaxation_factor = problem.solver_settings.ir_relaxation_factor,
+                .multigrid_cycle = problem.solver_settings.multigrid_cycle,
+                .multigrid_max_levels = problem.solver_settings.multigrid_max_levels,
+                .multigrid_smoothing_steps = problem.solver_settings.multigrid_smoothing_steps,
         };
         auto const result = magnetostatics_onelab::
                 run(mesh_file,
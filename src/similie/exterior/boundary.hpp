@@ -202,6 +202,47 @@ boundary(
     return Boundary<AllocationType, SimplexType>::run(allocation, chain);
 }
 
+/*
+ * Parallel version of boundary(allocation, chain) for large chains. Every k-simplex has 2k faces,
+ * so the offset of the faces of a simplex in the allocation is known without a counting pass: the
+ * faces are filled concurrently and then cancelled with the sort-based Chain::optimize.
+ */
+template <class ExecSpace, misc::Specialization<Kokkos::View> AllocationType, class SimplexType>
+Chain<boundary_t<SimplexType>,
+      typename AllocationType::array_layout,
+      typename AllocationType::memory_space>
+boundary(
+        ExecSpace const& exec_space,
+        AllocationType allocation,
+        Chain<SimplexType,
+              typename AllocationType::array_layout,
+              typename AllocationType::memory_space> chain)
+{
+    constexpr std::size_t nb_faces = 2 * SimplexType::dimension();
+    assert(allocation.size() >= nb_faces * chain.size()
+           && "boundary allocation must hold 2k faces per k-simplex of the chain");
+    auto const simplices = chain.allocation();
+    Kokkos::parallel_for(
+            "similie_boundary_fill",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, chain.size()),
+            KOKKOS_LAMBDA(std::size_t i) {
+                auto faces = Kokkos::
+                        subview(allocation,
+                                std::pair<std::size_t, std::size_t>(
+                                        nb_faces * i,
+                                        nb_faces * (i + 1)));
+                Boundary<decltype(faces), SimplexType>::run(faces, simplices(i));
+            });
+    exec_space.fence();
+    Chain<boundary_t<SimplexType>,
+          typename AllocationType::array_layout,
+          typename AllocationType::memory_space>
+            boundary_chain(allocation);
+    boundary_chain += nb_faces * chain.size();
+    boundary_chain.optimize(exec_space);
+    return boundary_chain;
+}
+
 } // namespace exterior
 
 } // namespace sil
@@ -9,6 +9,7 @@
 #include <similie/misc/portable_stl.hpp>
 #include <similie/misc/specialization.hpp>
 
+#include <Kokkos_Sort.hpp>
 #include <Kokkos_StdAlgorithms.hpp>
 
 #include "simplex.hpp"
@@ -17,6 +18,84 @@ namespace sil {
 
 namespace exterior {
 
+namespace detail {
+
+template <class... Tag>
+KOKKOS_FUNCTION int compare_uids(
+        ddc::DiscreteElement<Tag...> const& lhs,
+        ddc::DiscreteElement<Tag...> const& rhs)
+{
+    int result = 0;
+    ((result = result != 0                                        ? result
+               : lhs.template uid<Tag>() < rhs.template uid<Tag>() ? -1
+               : rhs.template uid<Tag>() < lhs.template uid<Tag>() ? 1
+                                                                   : 0),
+     ...);
+    return result;
+}
+
+template <class... Tag>
+KOKKOS_FUNCTION int compare_uids(
+        ddc::DiscreteVector<Tag...> const& lhs,
+        ddc::DiscreteVector<Tag...> const& rhs)
+{
+    int result = 0;
+    ((result = result != 0                                        ? result
+               : lhs.template get<Tag>() < rhs.template get<Tag>() ? -1
+               : rhs.template get<Tag>() < lhs.template get<Tag>() ? 1
+                                                                   : 0),
+     ...);
+    return result;
+}
+
+/*
+ * Order of the positions of a chain which gathers the simplices with the same support (positive
+ * ones first), ties being broken by position so that the order is total.
+ */
+template <class SimplicesType>
+struct SimplexPositionOrder
+{
+    SimplicesType simplices;
+
+    KOKKOS_FUNCTION bool operator()(std::size_t lhs, std::size_t rhs) const
+    {
+        int result = compare_uids(
+                simplices(lhs).discrete_element(),
+                simplices(rhs).discrete_element());
+        if (result == 0) {
+            result = compare_uids(
+                    simplices(lhs).discrete_vector(),
+                    simplices(rhs).discrete_vector());
+        }
+        if (result == 0 && simplices(lhs).negative() != simplices(rhs).negative()) {
+            result = simplices(lhs).negative() ? 1 : -1;
+        }
+        return result != 0 ? result < 0 : lhs < rhs;
+    }
+};
+
+template <class ExecSpace, class SimplicesType>
+Kokkos::View<std::size_t*, typename ExecSpace::memory_space> sorted_simplex_positions(
+        ExecSpace const& exec_space,
+        SimplicesType simplices,
+        std::size_t size)
+{
+    Kokkos::View<std::size_t*, typename ExecSpace::memory_space> positions(
+            Kokkos::view_alloc(
+                    exec_space,
+                    Kokkos::WithoutInitializing,
+                    "similie_chain_sorted_positions"),
+            size);
+    Kokkos::parallel_for(
+            "similie_chain_init_positions",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, size),
+            KOKKOS_LAMBDA(std::size_t i) { positions(i) = i; });
+    Kokkos::sort(exec_space, positions, SimplexPositionOrder<SimplicesType> {simplices});
+    return positions;
+}
+
+} // namespace detail
+
 /// Chain class
 template <
         class SimplexType,
@@ -37,6 +116,11 @@ public:
 private:
     static constexpr bool s_is_local = false;
     static constexpr std::size_t s_k = simplex_type::dimension();
+    /*
+     * Size above which check(exec_space) and optimize(exec_space) outperform the in-place
+     * versions. The callers opt in explicitly since the former allocate and launch kernels.
+     */
+    static constexpr std::size_t s_parallel_threshold = 512;
     simplices_type m_simplices;
     std::size_t
             m_size; // Effective size, m_simplices elements between m_size and m_simplices.size() are undefined
@@ -82,11 +166,21 @@ public:
         return s_k;
     }
 
+    static KOKKOS_FUNCTION constexpr std::size_t parallel_threshold() noexcept
+    {
+        return s_parallel_threshold;
+    }
+
     KOKKOS_FUNCTION simplices_type& allocation() noexcept
     {
         return m_simplices;
     }
 
+    KOKKOS_FUNCTION simplices_type const& allocation() const noexcept
+    {
+        return m_simplices;
+    }
+
     KOKKOS_FUNCTION std::size_t size() noexcept
     {
         return m_size;
@@ -129,6 +223,28 @@ public:
         return 0;
     }
 
+    /// O(n log n) version of check(): sorted duplicates are adjacent.
+    template <class ExecSpace>
+    int check(ExecSpace const& exec_space) const
+    {
+        if (size() < 2) {
+            return 0;
+        }
+        simplices_type const simplices = m_simplices;
+        auto const positions = detail::sorted_simplex_positions(exec_space, simplices, size());
+        std::size_t nb_duplicates = 0;
+        Kokkos::parallel_reduce(
+                "similie_chain_check",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 1, size()),
+                KOKKOS_LAMBDA(std::size_t r, std::size_t & count) {
+                    if (simplices(positions(r)) == simplices(positions(r - 1))) {
+                        ++count;
+                    }
+                },
+                nb_duplicates);
+        return nb_duplicates == 0 ? 0 : -1;
+    }
+
     KOKKOS_FUNCTION void optimize()
     {
         auto i = begin();
@@ -152,6 +268,112 @@ public:
         assert(check() == 0 && "there are duplicate simplices in the chain");
     }
 
+    /*
+     * O(n log n) version of optimize(): simplices sorted by support form segments in which the
+     * positive and negative simplices cancel each other. As with the in-place version, the
+     * remaining simplices are the last ones of the majority orientation, kept in their order.
+     */
+    template <class ExecSpace>
+    void optimize(ExecSpace const& exec_space)
+    {
+        std::size_t const n = size();
+        if (n < 2) {
+            return;
+        }
+        using index_view_type = Kokkos::View<std::size_t*, typename ExecSpace::memory_space>;
+        simplices_type const simplices = m_simplices;
+        auto const positions = detail::sorted_simplex_positions(exec_space, simplices, n);
+        auto const same_support = KOKKOS_LAMBDA(std::size_t r, std::size_t s)
+        {
+            return simplices(positions(r)).discrete_element()
+                           == simplices(positions(s)).discrete_element()
+                   && simplices(positions(r)).discrete_vector()
+                              == simplices(positions(s)).discrete_vector();
+        };
+
+        // Segment of each sorted simplex and inclusive count of the positive ones.
+        index_view_type segments(
+                Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing, "segments"),
+                n);
+        index_view_type segment_bounds(
+                Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing, "segment_bounds"),
+                n + 1);
+        index_view_type positive_counts(
+                Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing, "positive_counts"),
+                n);
+        std::size_t nb_segments = 0;
+        Kokkos::parallel_scan(
+                "similie_chain_optimize_segments",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+                KOKKOS_LAMBDA(std::size_t r, std::size_t & segment, bool final) {
+                    bool const head = r == 0 || !same_support(r, r - 1);
+                    if (final) {
+                        if (head) {
+                            segment_bounds(segment) = r;
+                        }
+                        segments(r) = head ? segment : segment - 1;
+                    }
+                    if (head) {
+                        ++segment;
+                    }
+                },
+                nb_segments);
+        Kokkos::parallel_scan(
+                "similie_chain_optimize_orientations",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+                KOKKOS_LAMBDA(std::size_t r, std::size_t & count, bool final) {
+                    if (!simplices(positions(r)).negative()) {
+                        ++count;
+                    }
+                    if (final) {
+                        positive_counts(r) = count;
+                    }
+                });
+        Kokkos::deep_copy(exec_space, Kokkos::subview(segment_bounds, nb_segments), n);
+
+        // Flag the survivors at their position in the chain and compact them.
+        index_view_type kept(Kokkos::view_alloc(exec_space, "kept"), n);
+        Kokkos::parallel_for(
+                "similie_chain_optimize_cancel",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+                KOKKOS_LAMBDA(std::size_t r) {
+                    std::size_t const first = segment_bounds(segments(r));
+                    std::size_t const last = segment_bounds(segments(r) + 1) - 1;
+                    std::size_t const positives
+                            = positive_counts(last) - (first == 0 ? 0 : positive_counts(first - 1));
+                    std::size_t const negatives = last + 1 - first - positives;
+                    bool const negative = simplices(positions(r)).negative();
+                    // Simplices of the same orientation located after r in the segment.
+                    std::size_t const same_after
+                            = negative ? last - r : positive_counts(last) - positive_counts(r);
+                    if (negative ? negatives > positives + same_after
+                                 : positives > negatives + same_after) {
+                        kept(positions(r)) = 1;
+                    }
+                });
+        Kokkos::View<simplex_type*, memory_space> compacted(
+                Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing, "compacted"),
+                n);
+        std::size_t nb_kept = 0;
+        Kokkos::parallel_scan(
+                "similie_chain_optimize_compact",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+                KOKKOS_LAMBDA(std::size_t i, std::size_t & offset, bool final) {
+                    if (final && kept(i)) {
+                        compacted(offset) = simplices(i);
+                    }
+                    offset += kept(i);
+                },
+                nb_kept);
+        Kokkos::deep_copy(
+                exec_space,
+                Kokkos::subview(simplices, std::pair<std::size_t, std::size_t>(0, nb_kept)),
+                Kokkos::subview(compacted, std::pair<std::size_t, std::size_t>(0, nb_kept)));
+        exec_space.fence();
+        m_size = nb_kept;
+        assert(check(exec_space) == 0 && "there are duplicate simplices in the chain");
+    }
+
     KOKKOS_FUNCTION auto begin()
     {
         return Kokkos::Experimental::begin(m_simplices);
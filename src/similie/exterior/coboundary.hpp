@@ -4,6 +4,10 @@
 #pragma once
 
 #include <array>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include <ddc/ddc.hpp>
@@ -14,6 +18,8 @@
 #include <similie/misc/portable_stl.hpp>
 #include <similie/misc/select_from_type_seq.hpp>
 #include <similie/misc/specialization.hpp>
+#include <similie/misc/split_domain.hpp>
+#include <similie/misc/tiled_domain.hpp>
 #include <similie/misc/type_seq_conversion.hpp>
 #include <similie/tensor/antisymmetric_tensor.hpp>
 #include <similie/tensor/dummy_index.hpp>
@@ -201,10 +207,6 @@ struct NonSpectatorDimension<Index, ddc::DiscreteDomain<DDim...>>
             ddc::DiscreteDomain<>>...>;
 };
 
-struct CoboundaryDummyIndex
-{
-};
-
 template <class MemorySpace = Kokkos::HostSpace, class TensorIndex, class... DDims>
 KOKKOS_FUNCTION auto make_stencil(ddc::DiscreteElement<DDims...> front)
         -> sil::tensor::OwningTensor<
@@ -278,6 +280,20 @@ KOKKOS_FUNCTION auto find_discrete_vector(
     return lower_chain.end();
 }
 
+// Element at which a boundary face is sampled, completed with the spectator coordinates of elem.
+template <class LowerChainType, class Elem, class FaceElem>
+KOKKOS_FUNCTION Elem sampled_face_element(FaceElem face_elem, Elem elem)
+{
+    using spectator_dimensions = ddc::type_seq_remove_t<
+            ddc::to_type_seq_t<Elem>,
+            ddc::to_type_seq_t<typename LowerChainType::simplex_type::discrete_element_type>>;
+    if constexpr (ddc::type_seq_size_v<spectator_dimensions> == 0) {
+        return Elem(face_elem);
+    } else {
+        return Elem(face_elem, misc::select_from_type_seq<spectator_dimensions>(elem));
+    }
+}
+
 } // namespace detail
 
 template <tensor::TensorNatIndex TagToAddToCochain, tensor::TensorIndex CochainTag>
@@ -363,18 +379,31 @@ struct Coboundary<TagToAddToCochain, CochainTag>
             LowerChainType lower_chain,
             Elem elem)
     {
-        constexpr std::size_t BOUNDARY_SIZE = 2 * (CochainTag::rank() + 1);
-        std::array<double, BOUNDARY_SIZE> boundary_values_alloc {};
-        ddc::DiscreteDomain<detail::CoboundaryDummyIndex> const boundary_domain(
-                ddc::DiscreteElement<detail::CoboundaryDummyIndex>(0),
-                ddc::DiscreteVector<detail::CoboundaryDummyIndex>(BOUNDARY_SIZE));
-        ddc::ChunkSpan<
-                double,
-                ddc::DiscreteDomain<detail::CoboundaryDummyIndex>,
-                Kokkos::layout_right,
-                typename CoboundaryTensorType::memory_space>
-                boundary_values(boundary_values_alloc.data(), boundary_domain);
+        run(std::array<CoboundaryTensorType, 1> {coboundary_tensor},
+            std::array<Evaluator, 1> {evaluator},
+            chain,
+            lower_chain,
+            elem);
+    }
 
+    /*
+     * Multi-field version: the boundary of every chain simplex and the cochain index of each of its
+     * faces are computed once and reused for all the fields.
+     */
+    template <
+            class CoboundaryTensorType,
+            class Evaluator,
+            std::size_t NbFields,
+            class ChainType,
+            class LowerChainType,
+            class Elem>
+    KOKKOS_FUNCTION static void run(
+            std::array<CoboundaryTensorType, NbFields> coboundary_tensors,
+            std::array<Evaluator, NbFields> const& evaluators,
+            ChainType chain,
+            LowerChainType lower_chain,
+            Elem elem)
+    {
         typename ChainType::simplex_type::discrete_element_type const elem_on_chain
                 = misc::select_from_type_seq<ddc::to_type_seq_t<
                         typename ChainType::simplex_type::discrete_element_type>>(elem);
@@ -385,44 +414,26 @@ struct Coboundary<TagToAddToCochain, CochainTag>
                             elem_on_chain,
                             i->discrete_vector());
             auto boundary_chain = boundary<typename CoboundaryTensorType::memory_space>(simplex);
+            std::array<double, NbFields> integrals {};
             for (auto j = boundary_chain.begin(); j < boundary_chain.end(); ++j) {
-                std::size_t const boundary_id
-                        = Kokkos::Experimental::distance(boundary_chain.begin(), j);
-                if constexpr (
-                        ddc::type_seq_size_v<ddc::type_seq_remove_t<
-                                ddc::to_type_seq_t<Elem>,
-                                ddc::to_type_seq_t<typename LowerChainType::simplex_type::
-                                                           discrete_element_type>>>
-                        == 0) {
-                    boundary_values(ddc::DiscreteElement<detail::CoboundaryDummyIndex>(boundary_id))
-                            = evaluator(
-                                    Elem(j->discrete_element()),
-                                    ddc::DiscreteElement<CochainTag>(Kokkos::Experimental::distance(
-                                            lower_chain.begin(),
-                                            detail::find_discrete_vector(
-                                                    lower_chain,
-                                                    j->discrete_vector()))));
-                } else {
-                    boundary_values(ddc::DiscreteElement<detail::CoboundaryDummyIndex>(boundary_id))
-                            = evaluator(
-                                    Elem(j->discrete_element(),
-                                         misc::select_from_type_seq<ddc::type_seq_remove_t<
-                                                 ddc::to_type_seq_t<Elem>,
-                                                 ddc::to_type_seq_t<
-                                                         typename LowerChainType::simplex_type::
-                                                                 discrete_element_type>>>(elem)),
-                                    ddc::DiscreteElement<CochainTag>(Kokkos::Experimental::distance(
-                                            lower_chain.begin(),
-                                            detail::find_discrete_vector(
-                                                    lower_chain,
-                                                    j->discrete_vector()))));
+                Elem const sampled_elem = detail::sampled_face_element<
+                        LowerChainType>(j->discrete_element(), elem);
+                ddc::DiscreteElement<CochainTag> const cochain_elem(
+                        Kokkos::Experimental::distance(
+                                lower_chain.begin(),
+                                detail::find_discrete_vector(lower_chain, j->discrete_vector())));
+                double const orientation = j->negative() ? -1. : 1.;
+                for (std::size_t field_id = 0; field_id < NbFields; ++field_id) {
+                    integrals[field_id]
+                            += orientation * evaluators[field_id](sampled_elem, cochain_elem);
                 }
             }
-            Cochain cochain_boundary(boundary_chain, boundary_values.allocation_kokkos_view());
-            coboundary_tensor.mem(
-                    ddc::DiscreteElement<coboundary_index_t<TagToAddToCochain, CochainTag>>(
-                            chain_id))
-                    = cochain_boundary.integrate();
+            for (std::size_t field_id = 0; field_id < NbFields; ++field_id) {
+                coboundary_tensors[field_id].mem(
+                        ddc::DiscreteElement<coboundary_index_t<TagToAddToCochain, CochainTag>>(
+                                chain_id))
+                        = integrals[field_id];
+            }
         }
     }
 };
@@ -527,18 +538,28 @@ struct TransposedCoboundary<TagToAddToCochain, CochainTag>
             LowerChainType lower_chain,
             Elem elem)
     {
-        constexpr std::size_t BOUNDARY_SIZE = 2 * (CochainTag::rank() + 1);
-        std::array<double, BOUNDARY_SIZE> boundary_values_alloc {};
-        ddc::DiscreteDomain<detail::CoboundaryDummyIndex> const boundary_domain(
-                ddc::DiscreteElement<detail::CoboundaryDummyIndex>(0),
-                ddc::DiscreteVector<detail::CoboundaryDummyIndex>(BOUNDARY_SIZE));
-        ddc::ChunkSpan<
-                double,
-                ddc::DiscreteDomain<detail::CoboundaryDummyIndex>,
-                Kokkos::layout_right,
-                typename CoboundaryTensorType::memory_space>
-                boundary_values(boundary_values_alloc.data(), boundary_domain);
+        run(std::array<CoboundaryTensorType, 1> {coboundary_tensor},
+            std::array<Evaluator, 1> {evaluator},
+            chain,
+            lower_chain,
+            elem);
+    }
 
+    // Multi-field version, see Coboundary::run.
+    template <
+            class CoboundaryTensorType,
+            class Evaluator,
+            std::size_t NbFields,
+            class ChainType,
+            class LowerChainType,
+            class Elem>
+    KOKKOS_FUNCTION static void run(
+            std::array<CoboundaryTensorType, NbFields> coboundary_tensors,
+            std::array<Evaluator, NbFields> const& evaluators,
+            ChainType chain,
+            LowerChainType lower_chain,
+            Elem elem)
+    {
         typename ChainType::simplex_type::discrete_element_type const elem_on_chain
                 = misc::select_from_type_seq<ddc::to_type_seq_t<
                         typename ChainType::simplex_type::discrete_element_type>>(elem);
@@ -550,6 +571,7 @@ struct TransposedCoboundary<TagToAddToCochain, CochainTag>
                             elem_on_chain,
                             simplex_vector);
             auto boundary_chain = boundary<typename CoboundaryTensorType::memory_space>(simplex);
+            std::array<double, NbFields> integrals {};
             for (auto j = boundary_chain.begin(); j < boundary_chain.end(); ++j) {
                 std::size_t const boundary_id
                         = Kokkos::Experimental::distance(boundary_chain.begin(), j);
@@ -566,45 +588,168 @@ struct TransposedCoboundary<TagToAddToCochain, CochainTag>
                         }
                     }
                 }
-                if constexpr (
-                        ddc::type_seq_size_v<ddc::type_seq_remove_t<
-                                ddc::to_type_seq_t<Elem>,
-                                ddc::to_type_seq_t<typename LowerChainType::simplex_type::
-                                                           discrete_element_type>>>
-                        == 0) {
-                    boundary_values(ddc::DiscreteElement<detail::CoboundaryDummyIndex>(boundary_id))
-                            = evaluator(
-                                    Elem(sampled_face_elem),
-                                    ddc::DiscreteElement<CochainTag>(Kokkos::Experimental::distance(
-                                            lower_chain.begin(),
-                                            detail::find_discrete_vector(
-                                                    lower_chain,
-                                                    j->discrete_vector()))));
-                } else {
-                    boundary_values(ddc::DiscreteElement<detail::CoboundaryDummyIndex>(boundary_id))
-                            = evaluator(
-                                    Elem(sampled_face_elem,
-                                         misc::select_from_type_seq<ddc::type_seq_remove_t<
-                                                 ddc::to_type_seq_t<Elem>,
-                                                 ddc::to_type_seq_t<
-                                                         typename LowerChainType::simplex_type::
-                                                                 discrete_element_type>>>(elem)),
-                                    ddc::DiscreteElement<CochainTag>(Kokkos::Experimental::distance(
-                                            lower_chain.begin(),
-                                            detail::find_discrete_vector(
-                                                    lower_chain,
-                                                    j->discrete_vector()))));
+                Elem const sampled_elem
+                        = detail::sampled_face_element<LowerChainType>(sampled_face_elem, elem);
+                ddc::DiscreteElement<CochainTag> const cochain_elem(
+                        Kokkos::Experimental::distance(
+                                lower_chain.begin(),
+                                detail::find_discrete_vector(lower_chain, j->discrete_vector())));
+                double const orientation = j->negative() ? -1. : 1.;
+                for (std::size_t field_id = 0; field_id < NbFields; ++field_id) {
+                    integrals[field_id]
+                            += orientation * evaluators[field_id](sampled_elem, cochain_elem);
                 }
             }
-            Cochain cochain_boundary(boundary_chain, boundary_values.allocation_kokkos_view());
-            coboundary_tensor.mem(
-                    ddc::DiscreteElement<coboundary_index_t<TagToAddToCochain, CochainTag>>(
-                            chain_id))
-                    = -cochain_boundary.integrate();
+            for (std::size_t field_id = 0; field_id < NbFields; ++field_id) {
+                coboundary_tensors[field_id].mem(
+                        ddc::DiscreteElement<coboundary_index_t<TagToAddToCochain, CochainTag>>(
+                                chain_id))
+                        = -integrals[field_id];
+            }
         }
     }
 };
 
+namespace detail {
+
+// Default number of points of a tile of the team-tiled coboundaries, halo excluded.
+inline constexpr std::size_t team_tiled_coboundary_tile_size = 256;
+
+/*
+ * Hierarchical execution of Coboundary (UpperHalo) and TransposedCoboundary (lower halo): each
+ * team cooperatively stages a tile of the input cochain, extended by the halo read by the
+ * stencil, in scratch memory, then evaluates the operator at every point of the tile from there.
+ */
+template <
+        class OperatorType,
+        bool UpperHalo,
+        template <class> class BoundaryEvaluator,
+        class CoboundaryIndex,
+        class CochainTag,
+        class HaloSeq,
+        class ExecSpace,
+        class CoboundaryTensorType,
+        class TensorType,
+        class ChainType,
+        class LowerChainType,
+        class TileShape>
+void team_tiled_coboundary(
+        std::string const& label,
+        ExecSpace const& exec_space,
+        CoboundaryTensorType coboundary_tensor,
+        TensorType tensor,
+        ChainType chain,
+        LowerChainType lower_chain,
+        TileShape const& tile_shape)
+{
+    // Spectator tensor indices are part of the batch domain.
+    using batch_domain_type = decltype(ddc::remove_dims_of<CochainTag>(
+            std::declval<typename TensorType::discrete_domain_type>()));
+    using tile_domain_type
+            = ddc::cartesian_prod_t<batch_domain_type, ddc::DiscreteDomain<CochainTag>>;
+    using tile_type = tensor::Tensor<
+            double,
+            tile_domain_type,
+            Kokkos::layout_right,
+            typename TensorType::memory_space>;
+    using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    using scratch_view_type = Kokkos::View<
+            double*,
+            typename ExecSpace::scratch_memory_space,
+            Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    batch_domain_type const batch_domain
+            = ddc::remove_dims_of<CoboundaryIndex>(coboundary_tensor.domain());
+    batch_domain_type const support_domain = ddc::remove_dims_of<CochainTag>(tensor.domain());
+    misc::TiledDomain<HaloSeq, batch_domain_type> const tiles(batch_domain, tile_shape);
+    if (batch_domain.empty() || tiles.size() == 0) {
+        return;
+    }
+    // Tiles are staged from the input cochain, which must hold every point of the batch domain.
+    assert(misc::domain_contains(support_domain, batch_domain.front())
+           && misc::domain_contains(support_domain, batch_domain.back()));
+
+    // Tiles lying in this domain are processed without bounds logic.
+    std::optional<batch_domain_type> const interior
+            = misc::interior_domain<HaloSeq>(batch_domain, support_domain);
+    bool const has_interior = interior.has_value();
+    batch_domain_type const interior_domain = interior.value_or(batch_domain);
+
+    [[maybe_unused]] tensor::TensorAccessor<CochainTag> cochain_accessor;
+    ddc::DiscreteDomain<CochainTag> const cochain_index_domain = cochain_accessor.domain();
+    std::size_t const scratch_size = tiles.max_halo_size() * cochain_index_domain.size();
+
+    SIMILIE_DEBUG_LOG(label);
+    Kokkos::parallel_for(
+            label,
+            Kokkos::TeamPolicy<ExecSpace>(exec_space, tiles.size(), Kokkos::AUTO)
+                    .set_scratch_size(
+                            0,
+                            Kokkos::PerTeam(scratch_view_type::shmem_size(scratch_size))),
+            KOKKOS_LAMBDA(member_type const& team) {
+                batch_domain_type const tile = tiles.tile(team.league_rank());
+                batch_domain_type const halo_tile
+                        = UpperHalo ? tiles.upper_halo(tile, support_domain)
+                                    : tiles.lower_halo(tile, support_domain);
+                scratch_view_type const scratch(team.team_scratch(0), scratch_size);
+                ddc::ChunkSpan<
+                        double,
+                        tile_domain_type,
+                        Kokkos::layout_right,
+                        typename TensorType::memory_space>
+                        staged_span(
+                                scratch.data(),
+                                tile_domain_type(halo_tile, cochain_index_domain));
+                tile_type staged_tensor(staged_span);
+
+                Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange(team, halo_tile.size()),
+                        [&](std::size_t const i) {
+                            typename batch_domain_type::discrete_element_type const elem
+                                    = misc::linear_index_to_element(halo_tile, i);
+                            for (std::size_t cochain_id = 0;
+                                 cochain_id < cochain_index_domain.size();
+                                 ++cochain_id) {
+                                ddc::DiscreteElement<CochainTag> const cochain_elem(cochain_id);
+                                staged_tensor.mem(elem, cochain_elem)
+                                        = tensor.mem(elem, cochain_elem);
+                            }
+                        });
+                team.team_barrier();
+
+                /*
+                 * The halo tile is only truncated at the boundary of the support, so evaluating on
+                 * the staged tile is equivalent to evaluating on the whole input cochain.
+                 */
+                bool const unchecked = has_interior
+                                       && misc::domain_contains(interior_domain, tile.front())
+                                       && misc::domain_contains(interior_domain, tile.back());
+                Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange(team, tile.size()),
+                        [&](std::size_t const i) {
+                            typename batch_domain_type::discrete_element_type const elem
+                                    = misc::linear_index_to_element(tile, i);
+                            if (unchecked) {
+                                OperatorType::
+                                        run(coboundary_tensor[elem],
+                                            UncheckedTensorEvaluator<tile_type> {staged_tensor},
+                                            chain,
+                                            lower_chain,
+                                            elem);
+                            } else {
+                                OperatorType::
+                                        run(coboundary_tensor[elem],
+                                            BoundaryEvaluator<tile_type> {staged_tensor},
+                                            chain,
+                                            lower_chain,
+                                            elem);
+                            }
+                        });
+            });
+}
+
+} // namespace detail
+
 template <misc::Specialization<Cochain> CochainType>
 KOKKOS_FUNCTION coboundary_t<CochainType> coboundary(CochainType cochain)
 {
@@ -625,22 +770,25 @@ coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> coboundary(
             = ddc::remove_dims_of<coboundary_index_t<TagToAddToCochain, CochainTag>>(
                     coboundary_tensor.domain());
 
-    auto chain = tangent_basis<
-            CochainTag::rank() + 1,
-            typename detail::NonSpectatorDimension<
-                    TagToAddToCochain,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-    auto lower_chain = tangent_basis<
-            CochainTag::rank(),
-            typename detail::NonSpectatorDimension<
-                    TagToAddToCochain,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-
-    SIMILIE_DEBUG_LOG("similie_compute_coboundary");
-    ddc::parallel_for_each(
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToAddToCochain,
+            typename TensorType::non_indices_domain_t>::type;
+    auto chain = tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space);
+    auto lower_chain = tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space);
+
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
             "similie_compute_coboundary",
             exec_space,
             batch_dom,
+            tensor.non_indices_domain(),
+            KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
+                Coboundary<TagToAddToCochain, CochainTag>::
+                        run(coboundary_tensor[elem],
+                            detail::UncheckedTensorEvaluator<TensorType> {tensor},
+                            chain,
+                            lower_chain,
+                            elem);
+            },
             KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
                 Coboundary<TagToAddToCochain, CochainTag>::
                         run(coboundary_tensor[elem],
@@ -653,6 +801,65 @@ coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> coboundary(
     return coboundary_tensor;
 }
 
+/*
+ * Multi-field version of coboundary: the tensors share the same domain and are processed in a
+ * single sweep, the tangent basis and the boundaries of the simplices being computed once per
+ * point.
+ */
+template <
+        tensor::TensorNatIndex TagToAddToCochain,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> TensorType,
+        std::size_t NbFields,
+        class ExecSpace>
+std::array<coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType>, NbFields> coboundary(
+        ExecSpace const& exec_space,
+        std::array<coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType>, NbFields>
+                coboundary_tensors,
+        std::array<TensorType, NbFields> tensors)
+{
+    static_assert(NbFields > 0);
+    ddc::DiscreteDomain batch_dom
+            = ddc::remove_dims_of<coboundary_index_t<TagToAddToCochain, CochainTag>>(
+                    coboundary_tensors[0].domain());
+    for (std::size_t field_id = 1; field_id < NbFields; ++field_id) {
+        assert(coboundary_tensors[field_id].domain() == coboundary_tensors[0].domain());
+        assert(tensors[field_id].domain() == tensors[0].domain());
+    }
+
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToAddToCochain,
+            typename TensorType::non_indices_domain_t>::type;
+    auto chain = tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space);
+    auto lower_chain = tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space);
+
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
+            "similie_compute_batched_coboundary",
+            exec_space,
+            batch_dom,
+            tensors[0].non_indices_domain(),
+            KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
+                Coboundary<TagToAddToCochain, CochainTag>::
+                        run(detail::slice_fields(coboundary_tensors, elem),
+                            detail::make_field_evaluators<detail::UncheckedTensorEvaluator>(
+                                    tensors),
+                            chain,
+                            lower_chain,
+                            elem);
+            },
+            KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
+                Coboundary<TagToAddToCochain, CochainTag>::
+                        run(detail::slice_fields(coboundary_tensors, elem),
+                            detail::make_field_evaluators<detail::ClampedTensorEvaluator>(
+                                    tensors),
+                            chain,
+                            lower_chain,
+                            elem);
+            });
+
+    return coboundary_tensors;
+}
+
 template <
         tensor::TensorNatIndex TagToAddToCochain,
         tensor::TensorIndex CochainTag,
@@ -667,22 +874,25 @@ coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> transposed_coboun
             = ddc::remove_dims_of<coboundary_index_t<TagToAddToCochain, CochainTag>>(
                     coboundary_tensor.domain());
 
-    auto chain = tangent_basis<
-            CochainTag::rank() + 1,
-            typename detail::NonSpectatorDimension<
-                    TagToAddToCochain,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-    auto lower_chain = tangent_basis<
-            CochainTag::rank(),
-            typename detail::NonSpectatorDimension<
-                    TagToAddToCochain,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-
-    SIMILIE_DEBUG_LOG("similie_compute_transposed_coboundary");
-    ddc::parallel_for_each(
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToAddToCochain,
+            typename TensorType::non_indices_domain_t>::type;
+    auto chain = tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space);
+    auto lower_chain = tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space);
+
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
             "similie_compute_transposed_coboundary",
             exec_space,
             batch_dom,
+            tensor.non_indices_domain(),
+            KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
+                TransposedCoboundary<TagToAddToCochain, CochainTag>::
+                        run(coboundary_tensor[elem],
+                            detail::UncheckedTensorEvaluator<TensorType> {tensor},
+                            chain,
+                            lower_chain,
+                            elem);
+            },
             KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
                 TransposedCoboundary<TagToAddToCochain, CochainTag>::
                         run(coboundary_tensor[elem],
@@ -695,6 +905,132 @@ coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> transposed_coboun
     return coboundary_tensor;
 }
 
+// Multi-field version of transposed_coboundary, see the multi-field coboundary.
+template <
+        tensor::TensorNatIndex TagToAddToCochain,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> TensorType,
+        std::size_t NbFields,
+        class ExecSpace>
+std::array<coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType>, NbFields>
+transposed_coboundary(
+        ExecSpace const& exec_space,
+        std::array<coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType>, NbFields>
+                coboundary_tensors,
+        std::array<TensorType, NbFields> tensors)
+{
+    static_assert(NbFields > 0);
+    ddc::DiscreteDomain batch_dom
+            = ddc::remove_dims_of<coboundary_index_t<TagToAddToCochain, CochainTag>>(
+                    coboundary_tensors[0].domain());
+    for (std::size_t field_id = 1; field_id < NbFields; ++field_id) {
+        assert(coboundary_tensors[field_id].domain() == coboundary_tensors[0].domain());
+        assert(tensors[field_id].domain() == tensors[0].domain());
+    }
+
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToAddToCochain,
+            typename TensorType::non_indices_domain_t>::type;
+    auto chain = tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space);
+    auto lower_chain = tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space);
+
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
+            "similie_compute_batched_transposed_coboundary",
+            exec_space,
+            batch_dom,
+            tensors[0].non_indices_domain(),
+            KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
+                TransposedCoboundary<TagToAddToCochain, CochainTag>::
+                        run(detail::slice_fields(coboundary_tensors, elem),
+                            detail::make_field_evaluators<detail::UncheckedTensorEvaluator>(
+                                    tensors),
+                            chain,
+                            lower_chain,
+                            elem);
+            },
+            KOKKOS_LAMBDA(typename decltype(batch_dom)::discrete_element_type elem) {
+                TransposedCoboundary<TagToAddToCochain, CochainTag>::
+                        run(detail::slice_fields(coboundary_tensors, elem),
+                            detail::make_field_evaluators<detail::ZeroOutsideTensorEvaluator>(
+                                    tensors),
+                            chain,
+                            lower_chain,
+                            elem);
+            });
+
+    return coboundary_tensors;
+}
+
+/*
+ * Hierarchical alternatives to coboundary and transposed_coboundary, staging tiles of the input
+ * cochain (plus halo) in team scratch memory. tile_shape is either the target number of points of
+ * a tile or its extents along every dimension of the batch domain, and is best tuned per backend
+ * (see benchmarks/coboundary.cpp).
+ */
+template <
+        tensor::TensorNatIndex TagToAddToCochain,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> TensorType,
+        class ExecSpace,
+        class TileShape = std::size_t>
+coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> team_tiled_coboundary(
+        ExecSpace const& exec_space,
+        coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> coboundary_tensor,
+        TensorType tensor,
+        TileShape const& tile_shape = detail::team_tiled_coboundary_tile_size)
+{
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToAddToCochain,
+            typename TensorType::non_indices_domain_t>::type;
+    detail::team_tiled_coboundary<
+            Coboundary<TagToAddToCochain, CochainTag>,
+            true,
+            detail::ClampedTensorEvaluator,
+            coboundary_index_t<TagToAddToCochain, CochainTag>,
+            CochainTag,
+            ddc::to_type_seq_t<non_spectator_dimensions>>(
+            "similie_compute_team_tiled_coboundary",
+            exec_space,
+            coboundary_tensor,
+            tensor,
+            tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space),
+            tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space),
+            tile_shape);
+    return coboundary_tensor;
+}
+
+template <
+        tensor::TensorNatIndex TagToAddToCochain,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> TensorType,
+        class ExecSpace,
+        class TileShape = std::size_t>
+coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> team_tiled_transposed_coboundary(
+        ExecSpace const& exec_space,
+        coboundary_tensor_t<TagToAddToCochain, CochainTag, TensorType> coboundary_tensor,
+        TensorType tensor,
+        TileShape const& tile_shape = detail::team_tiled_coboundary_tile_size)
+{
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToAddToCochain,
+            typename TensorType::non_indices_domain_t>::type;
+    detail::team_tiled_coboundary<
+            TransposedCoboundary<TagToAddToCochain, CochainTag>,
+            false,
+            detail::ZeroOutsideTensorEvaluator,
+            coboundary_index_t<TagToAddToCochain, CochainTag>,
+            CochainTag,
+            ddc::to_type_seq_t<non_spectator_dimensions>>(
+            "similie_compute_team_tiled_transposed_coboundary",
+            exec_space,
+            coboundary_tensor,
+            tensor,
+            tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space),
+            tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space),
+            tile_shape);
+    return coboundary_tensor;
+}
+
 template <
         tensor::TensorNatIndex TagToAddToCochain,
         tensor::TensorIndex CochainTag,
@@ -209,6 +209,24 @@ public:
         }
         return out;
     }
+
+    /// Parallel reduction version of integrate() for cochains over large chains.
+    template <class ExecSpace>
+        requires(misc::Specialization<chain_type, Chain>)
+    element_type integrate(ExecSpace const& exec_space) const
+    {
+        typename chain_type::simplices_type const simplices = m_chain.allocation();
+        values_type const values = m_values;
+        element_type out = 0;
+        Kokkos::parallel_reduce(
+                "similie_cochain_integrate",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t i, element_type & sum) {
+                    sum += (simplices(i).negative() ? -1 : 1) * values(i);
+                },
+                out);
+        return out;
+    }
 };
 
 template <class ChainType, misc::Specialization<tensor::Tensor> TensorType>
@@ -4,8 +4,11 @@
 #pragma once
 
 #include <array>
+#include <cassert>
+#include <cstddef>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include <ddc/ddc.hpp>
 
@@ -13,6 +16,7 @@
 #include <similie/misc/domain_contains.hpp>
 #include <similie/misc/macros.hpp>
 #include <similie/misc/specialization.hpp>
+#include <similie/misc/tuned_parallel_for_each.hpp>
 #include <similie/tensor/character.hpp>
 #include <similie/tensor/tensor_impl.hpp>
 
@@ -21,6 +25,7 @@
 #include "coboundary.hpp"
 #include "cochain.hpp"
 #include "cosimplex.hpp"
+#include "evaluators.hpp"
 
 
 namespace sil {
@@ -172,6 +177,107 @@ using codifferential_hodge_output_indices_t =
 template <class... Args>
 struct Codifferential;
 
+namespace detail {
+
+// Tensors of a same domain stored one after the other in storage, one per field.
+template <class TensorType, class Domain, std::size_t... FieldId>
+KOKKOS_FUNCTION std::array<TensorType, sizeof...(FieldId)> split_field_storage(
+        double* storage,
+        Domain const& domain,
+        std::index_sequence<FieldId...>)
+{
+    return {TensorType(storage + FieldId * domain.size(), domain)...};
+}
+
+// Second stage of the codifferential: dual coboundary of the first Hodge star output, then second
+// Hodge star.
+template <tensor::TensorNatIndex TagToRemoveFromCochain, tensor::TensorIndex CochainTag>
+struct DualCoboundaryAndSecondHodgeStar
+{
+    using source_hodge_output_indices = codifferential_hodge_output_indices_t<
+            TagToRemoveFromCochain::size() - CochainTag::rank(),
+            TagToRemoveFromCochain>;
+    using dual_tensor_index = misc::
+            convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, source_hodge_output_indices>;
+    using target_hodge_input_indices = ddc::type_seq_merge_t<
+            ddc::detail::TypeSeq<TagToRemoveFromCochain>,
+            source_hodge_output_indices>;
+    using dual_codifferential_index = misc::
+            convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, target_hodge_input_indices>;
+
+    template <
+            class CodifferentialTensorType,
+            class Evaluator,
+            class DualHodgeStarType,
+            class ChainType,
+            class LowerChainType,
+            class Elem>
+    KOKKOS_FUNCTION static void run(
+            CodifferentialTensorType codifferential_tensor,
+            Evaluator evaluator,
+            DualHodgeStarType dual_hodge_star,
+            ChainType chain,
+            LowerChainType lower_chain,
+            Elem elem)
+    {
+        run(std::array<CodifferentialTensorType, 1> {codifferential_tensor},
+            std::array<Evaluator, 1> {evaluator},
+            dual_hodge_star,
+            chain,
+            lower_chain,
+            elem);
+    }
+
+    // Multi-field version, the dual Hodge star at elem being shared by all the fields.
+    template <
+            class CodifferentialTensorType,
+            class Evaluator,
+            std::size_t NbFields,
+            class DualHodgeStarType,
+            class ChainType,
+            class LowerChainType,
+            class Elem>
+    KOKKOS_FUNCTION static void run(
+            std::array<CodifferentialTensorType, NbFields> codifferential_tensors,
+            std::array<Evaluator, NbFields> const& evaluators,
+            DualHodgeStarType dual_hodge_star,
+            ChainType chain,
+            LowerChainType lower_chain,
+            Elem elem)
+    {
+        using DualCodifferentialType = tensor::Tensor<
+                double,
+                ddc::DiscreteDomain<dual_codifferential_index>,
+                Kokkos::layout_right,
+                typename CodifferentialTensorType::memory_space>;
+        [[maybe_unused]] tensor::TensorAccessor<dual_codifferential_index>
+                dual_codifferential_accessor;
+        std::array<double, NbFields * dual_codifferential_index::access_size()>
+                dual_codifferential_alloc {};
+        std::array<DualCodifferentialType, NbFields> const dual_codifferentials
+                = split_field_storage<DualCodifferentialType>(
+                        dual_codifferential_alloc.data(),
+                        dual_codifferential_accessor.domain(),
+                        std::make_index_sequence<NbFields> {});
+
+        TransposedCoboundary<TagToRemoveFromCochain, dual_tensor_index>::
+                run(dual_codifferentials, evaluators, chain, lower_chain, elem);
+
+        for (std::size_t field_id = 0; field_id < NbFields; ++field_id) {
+            sil::tensor::tensor_prod(
+                    codifferential_tensors[field_id],
+                    dual_codifferentials[field_id],
+                    dual_hodge_star);
+            if constexpr (
+                    (TagToRemoveFromCochain::size() * (CochainTag::rank() + 1) + 1) % 2 == 1) {
+                codifferential_tensors[field_id] *= -1;
+            }
+        }
+    }
+};
+
+} // namespace detail
+
 template <
         tensor::TensorIndex MetricIndex,
         tensor::TensorNatIndex TagToRemoveFromCochain,
@@ -310,6 +416,85 @@ struct Codifferential<
     }
 };
 
+namespace detail {
+
+/*
+ * Both stages of the codifferential of a batch of tensors sharing the same domain, in one sweep per
+ * stage. The Hodge stars at a point are loaded once and applied to all the fields.
+ */
+template <
+        tensor::TensorNatIndex TagToRemoveFromCochain,
+        tensor::TensorIndex CochainTag,
+        class NonSpectatorDimensions,
+        class ExecSpace,
+        class CodifferentialTensorType,
+        class TensorType,
+        class HodgeStarType,
+        class DualHodgeStarType,
+        class DualTensorType,
+        class ChainType,
+        class LowerChainType,
+        std::size_t NbFields>
+void apply_batched_codifferential(
+        ExecSpace const& exec_space,
+        std::array<CodifferentialTensorType, NbFields> codifferential_tensors,
+        std::array<TensorType, NbFields> tensors,
+        HodgeStarType hodge_star,
+        DualHodgeStarType dual_hodge_star,
+        std::array<DualTensorType, NbFields> dual_tensor_buffers,
+        ChainType chain,
+        LowerChainType lower_chain)
+{
+    static_assert(NbFields > 0);
+    for (std::size_t field_id = 1; field_id < NbFields; ++field_id) {
+        assert(tensors[field_id].domain() == tensors[0].domain());
+        assert(codifferential_tensors[field_id].domain() == codifferential_tensors[0].domain());
+        assert(dual_tensor_buffers[field_id].domain() == dual_tensor_buffers[0].domain());
+    }
+
+    SIMILIE_DEBUG_LOG("similie_apply_batched_first_hodge_star_for_codifferential");
+    misc::tuned_parallel_for_each(
+            "similie_apply_batched_first_hodge_star_for_codifferential",
+            exec_space,
+            dual_tensor_buffers[0].non_indices_domain(),
+            KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                auto const hodge_star_at_elem = hodge_star[elem];
+                for (std::size_t field_id = 0; field_id < NbFields; ++field_id) {
+                    sil::tensor::tensor_prod(
+                            dual_tensor_buffers[field_id][elem],
+                            tensors[field_id][elem],
+                            hodge_star_at_elem);
+                }
+            });
+
+    parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<NonSpectatorDimensions>>(
+            "similie_apply_batched_second_hodge_star_for_codifferential",
+            exec_space,
+            codifferential_tensors[0].non_indices_domain(),
+            dual_tensor_buffers[0].non_indices_domain(),
+            KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                DualCoboundaryAndSecondHodgeStar<TagToRemoveFromCochain, CochainTag>::
+                        run(slice_fields(codifferential_tensors, elem),
+                            make_field_evaluators<UncheckedTensorEvaluator>(dual_tensor_buffers),
+                            dual_hodge_star[elem],
+                            chain,
+                            lower_chain,
+                            elem);
+            },
+            KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                DualCoboundaryAndSecondHodgeStar<TagToRemoveFromCochain, CochainTag>::
+                        run(slice_fields(codifferential_tensors, elem),
+                            make_field_evaluators<ZeroOutsideTensorEvaluator>(
+                                    dual_tensor_buffers),
+                            dual_hodge_star[elem],
+                            chain,
+                            lower_chain,
+                            elem);
+            });
+}
+
+} // namespace detail
+
 template <
         tensor::TensorIndex MetricIndex,
         tensor::TensorNatIndex TagToRemoveFromCochain,
@@ -337,8 +522,6 @@ class StagedCodifferential
             ddc::detail::TypeSeq<TagToRemoveFromCochain>>;
     using DualTensorIndex = misc::
             convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, SourceHodgeOutputIndices>;
-    using DualCodifferentialIndex = misc::
-            convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, TargetHodgeInputIndices>;
     using NonSpectatorDimensions = typename detail::NonSpectatorDimension<
             TagToRemoveFromCochain,
             typename TensorType::non_indices_domain_t>::type;
@@ -377,9 +560,23 @@ class StagedCodifferential
     std::optional<HodgeStarTensorType> m_hodge_star;
     std::optional<DualHodgeStarTensorType> m_dual_hodge_star;
     std::optional<DualTensorType> m_dual_tensor_buffer;
+    // Extra dual tensor buffers of the multi-field run(), grown on demand.
+    mutable std::vector<DualTensorAllocType> m_field_dual_tensor_allocs;
     ChainType m_chain;
     LowerChainType m_lower_chain;
 
+    template <std::size_t... FieldId>
+    std::array<DualTensorType, sizeof...(FieldId) + 1> field_dual_tensor_buffers(
+            std::index_sequence<FieldId...>) const
+    {
+        while (m_field_dual_tensor_allocs.size() < sizeof...(FieldId)) {
+            m_field_dual_tensor_allocs.emplace_back(
+                    m_dual_tensor_buffer->domain(),
+                    AllocatorType());
+        }
+        return {*m_dual_tensor_buffer, DualTensorType(m_field_dual_tensor_allocs[FieldId])...};
+    }
+
 public:
     StagedCodifferential(
             ExecSpace const& exec_space,
@@ -428,12 +625,24 @@ public:
         m_dual_hodge_star.emplace(*m_dual_hodge_star_alloc);
         m_dual_tensor_buffer.emplace(*m_dual_tensor_alloc);
 
-        fill_discrete_hodge_star<
-                SourceHodgeInputIndices,
-                SourceHodgeOutputIndices>(exec_space, *m_hodge_star, metric, position);
+        // Both Hodge stars read the simplex volumes of the mesh, evaluated once.
+        simplex_volume_cache_t<MetricType, PositionType> const volume_cache
+                = make_simplex_volume_cache(exec_space, metric, position);
+        fill_discrete_hodge_star<SourceHodgeInputIndices, SourceHodgeOutputIndices>(
+                exec_space,
+                *m_hodge_star,
+                metric,
+                position,
+                volume_cache.volumes());
         fill_discrete_hodge_star<
                 tensor::upper_t<TargetHodgeInputIndices>,
-                TargetHodgeOutputIndices>(exec_space, *m_dual_hodge_star, metric, position);
+                TargetHodgeOutputIndices>(
+                exec_space,
+                *m_dual_hodge_star,
+                metric,
+                position,
+                volume_cache.volumes());
+        exec_space.fence();
     }
 
     CodifferentialTensorType run(CodifferentialTensorType codifferential_tensor, TensorType tensor)
@@ -447,7 +656,7 @@ public:
         auto lower_chain = m_lower_chain;
 
         SIMILIE_DEBUG_LOG("similie_apply_first_hodge_star_for_codifferential");
-        ddc::parallel_for_each(
+        misc::tuned_parallel_for_each(
                 "similie_apply_first_hodge_star_for_codifferential",
                 exec_space,
                 dual_tensor_buffer.non_indices_domain(),
@@ -457,54 +666,62 @@ public:
                             tensor_prod(dual_tensor_buffer[elem], tensor[elem], hodge_star[elem]);
                 });
 
-        SIMILIE_DEBUG_LOG("similie_apply_second_hodge_star_for_codifferential");
-        ddc::parallel_for_each(
+        detail::parallel_for_each_interior_and_boundary<
+                ddc::to_type_seq_t<NonSpectatorDimensions>>(
                 "similie_apply_second_hodge_star_for_codifferential",
                 exec_space,
                 codifferential_tensor.non_indices_domain(),
+                dual_tensor_buffer.non_indices_domain(),
                 KOKKOS_LAMBDA(
                         typename TensorType::non_indices_domain_t::discrete_element_type elem) {
-                    [[maybe_unused]] tensor::TensorAccessor<DualCodifferentialIndex>
-                            dual_codifferential_accessor;
-                    std::array<double, DualCodifferentialIndex::access_size()>
-                            dual_codifferential_alloc {};
-                    ddc::ChunkSpan<
-                            double,
-                            ddc::DiscreteDomain<DualCodifferentialIndex>,
-                            Kokkos::layout_right,
-                            typename TensorType::memory_space>
-                            dual_codifferential_span(
-                                    dual_codifferential_alloc.data(),
-                                    dual_codifferential_accessor.domain());
-                    sil::tensor::Tensor dual_codifferential(dual_codifferential_span);
-
-                    TransposedCoboundary<TagToRemoveFromCochain, DualTensorIndex>::run(
-                            dual_codifferential,
-                            [&](auto sampled_elem, auto dual_elem) {
-                                if (!misc::domain_contains(
-                                            dual_tensor_buffer.non_indices_domain(),
-                                            sampled_elem)) {
-                                    return 0.0;
-                                }
-                                return dual_tensor_buffer.mem(sampled_elem, dual_elem);
-                            },
-                            chain,
-                            lower_chain,
-                            elem);
-
-                    sil::tensor::tensor_prod(
-                            codifferential_tensor[elem],
-                            dual_codifferential,
-                            dual_hodge_star[elem]);
-                    if constexpr (
-                            (TagToRemoveFromCochain::size() * (CochainTag::rank() + 1) + 1) % 2
-                            == 1) {
-                        codifferential_tensor[elem] *= -1;
-                    }
+                    detail::DualCoboundaryAndSecondHodgeStar<TagToRemoveFromCochain, CochainTag>::
+                            run(codifferential_tensor[elem],
+                                detail::UncheckedTensorEvaluator<DualTensorType> {
+                                        dual_tensor_buffer},
+                                dual_hodge_star[elem],
+                                chain,
+                                lower_chain,
+                                elem);
+                },
+                KOKKOS_LAMBDA(
+                        typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                    detail::DualCoboundaryAndSecondHodgeStar<TagToRemoveFromCochain, CochainTag>::
+                            run(codifferential_tensor[elem],
+                                detail::ZeroOutsideTensorEvaluator<DualTensorType> {
+                                        dual_tensor_buffer},
+                                dual_hodge_star[elem],
+                                chain,
+                                lower_chain,
+                                elem);
                 });
 
         return codifferential_tensor;
     }
+
+    /*
+     * Multi-field version of run(), the tensors sharing the domain of the tensor the staged
+     * codifferential has been built for.
+     */
+    template <std::size_t NbFields>
+    std::array<CodifferentialTensorType, NbFields> run(
+            std::array<CodifferentialTensorType, NbFields> codifferential_tensors,
+            std::array<TensorType, NbFields> tensors) const
+    {
+        static_assert(NbFields > 0);
+        detail::apply_batched_codifferential<
+                TagToRemoveFromCochain,
+                CochainTag,
+                NonSpectatorDimensions>(
+                m_exec_space,
+                codifferential_tensors,
+                tensors,
+                *m_hodge_star,
+                *m_dual_hodge_star,
+                field_dual_tensor_buffers(std::make_index_sequence<NbFields - 1> {}),
+                m_chain,
+                m_lower_chain);
+        return codifferential_tensors;
+    }
 };
 
 template <
@@ -563,11 +780,6 @@ codifferential_tensor_t<TagToRemoveFromCochain, CochainTag, TensorType> codiffer
             TagToRemoveFromCochain>;
     using dual_tensor_index = misc::
             convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, source_hodge_output_indices>;
-    using target_hodge_input_indices = ddc::type_seq_merge_t<
-            ddc::detail::TypeSeq<TagToRemoveFromCochain>,
-            source_hodge_output_indices>;
-    using dual_codifferential_index = misc::
-            convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, target_hodge_input_indices>;
     using non_spectator_dimensions = typename detail::NonSpectatorDimension<
             TagToRemoveFromCochain,
             typename TensorType::non_indices_domain_t>::type;
@@ -576,7 +788,7 @@ codifferential_tensor_t<TagToRemoveFromCochain, CochainTag, TensorType> codiffer
             = tangent_basis<dual_tensor_index::rank(), non_spectator_dimensions>(exec_space);
 
     SIMILIE_DEBUG_LOG("similie_apply_first_hodge_star_for_codifferential");
-    ddc::parallel_for_each(
+    misc::tuned_parallel_for_each(
             "similie_apply_first_hodge_star_for_codifferential",
             exec_space,
             dual_tensor_buffer.non_indices_domain(),
@@ -584,53 +796,81 @@ codifferential_tensor_t<TagToRemoveFromCochain, CochainTag, TensorType> codiffer
                 sil::tensor::tensor_prod(dual_tensor_buffer[elem], tensor[elem], hodge_star[elem]);
             });
 
-    SIMILIE_DEBUG_LOG("similie_apply_second_hodge_star_for_codifferential");
-    ddc::parallel_for_each(
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
             "similie_apply_second_hodge_star_for_codifferential",
             exec_space,
             codifferential_tensor.non_indices_domain(),
+            dual_tensor_buffer.non_indices_domain(),
             KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
-                [[maybe_unused]] tensor::TensorAccessor<dual_codifferential_index>
-                        dual_codifferential_accessor;
-                std::array<double, dual_codifferential_index::access_size()>
-                        dual_codifferential_alloc {};
-                ddc::ChunkSpan<
-                        double,
-                        ddc::DiscreteDomain<dual_codifferential_index>,
-                        Kokkos::layout_right,
-                        typename TensorType::memory_space>
-                        dual_codifferential_span(
-                                dual_codifferential_alloc.data(),
-                                dual_codifferential_accessor.domain());
-                sil::tensor::Tensor dual_codifferential(dual_codifferential_span);
-
-                TransposedCoboundary<TagToRemoveFromCochain, dual_tensor_index>::run(
-                        dual_codifferential,
-                        [&](auto sampled_elem, auto dual_elem) {
-                            if (!misc::domain_contains(
-                                        dual_tensor_buffer.non_indices_domain(),
-                                        sampled_elem)) {
-                                return 0.0;
-                            }
-                            return dual_tensor_buffer.mem(sampled_elem, dual_elem);
-                        },
-                        chain,
-                        lower_chain,
-                        elem);
-
-                sil::tensor::tensor_prod(
-                        codifferential_tensor[elem],
-                        dual_codifferential,
-                        dual_hodge_star[elem]);
-                if constexpr (
-                        (TagToRemoveFromCochain::size() * (CochainTag::rank() + 1) + 1) % 2 == 1) {
-                    codifferential_tensor[elem] *= -1;
-                }
+                detail::DualCoboundaryAndSecondHodgeStar<TagToRemoveFromCochain, CochainTag>::
+                        run(codifferential_tensor[elem],
+                            detail::UncheckedTensorEvaluator<DualTensorType> {dual_tensor_buffer},
+                            dual_hodge_star[elem],
+                            chain,
+                            lower_chain,
+                            elem);
+            },
+            KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                detail::DualCoboundaryAndSecondHodgeStar<TagToRemoveFromCochain, CochainTag>::
+                        run(codifferential_tensor[elem],
+                            detail::ZeroOutsideTensorEvaluator<DualTensorType> {
+                                    dual_tensor_buffer},
+                            dual_hodge_star[elem],
+                            chain,
+                            lower_chain,
+                            elem);
             });
 
     return codifferential_tensor;
 }
 
+// Multi-field version of codifferential, one dual tensor buffer being needed per field.
+template <
+        tensor::TensorIndex MetricIndex,
+        tensor::TensorNatIndex TagToRemoveFromCochain,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> DualTensorType,
+        misc::Specialization<tensor::Tensor> TensorType,
+        misc::Specialization<tensor::Tensor> HodgeStarType,
+        misc::Specialization<tensor::Tensor> DualHodgeStarType,
+        std::size_t NbFields,
+        class ExecSpace>
+std::array<codifferential_tensor_t<TagToRemoveFromCochain, CochainTag, TensorType>, NbFields>
+codifferential(
+        ExecSpace const& exec_space,
+        std::array<
+                codifferential_tensor_t<TagToRemoveFromCochain, CochainTag, TensorType>,
+                NbFields> codifferential_tensors,
+        std::array<TensorType, NbFields> tensors,
+        HodgeStarType hodge_star,
+        DualHodgeStarType dual_hodge_star,
+        std::array<DualTensorType, NbFields> dual_tensor_buffers)
+{
+    static_assert(tensor::is_covariant_v<TagToRemoveFromCochain>);
+    using source_hodge_output_indices = codifferential_hodge_output_indices_t<
+            TagToRemoveFromCochain::size() - CochainTag::rank(),
+            TagToRemoveFromCochain>;
+    using dual_tensor_index = misc::
+            convert_type_seq_to_t<tensor::TensorAntisymmetricIndex, source_hodge_output_indices>;
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            TagToRemoveFromCochain,
+            typename TensorType::non_indices_domain_t>::type;
+
+    detail::apply_batched_codifferential<
+            TagToRemoveFromCochain,
+            CochainTag,
+            non_spectator_dimensions>(
+            exec_space,
+            codifferential_tensors,
+            tensors,
+            hodge_star,
+            dual_hodge_star,
+            dual_tensor_buffers,
+            tangent_basis<dual_tensor_index::rank() + 1, non_spectator_dimensions>(exec_space),
+            tangent_basis<dual_tensor_index::rank(), non_spectator_dimensions>(exec_space));
+    return codifferential_tensors;
+}
+
 template <
         tensor::TensorIndex MetricIndex,
         tensor::TensorNatIndex TagToRemoveFromCochain,
@@ -3,8 +3,19 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
 #include <similie/misc/clamp_to_domain.hpp>
 #include <similie/misc/domain_contains.hpp>
+#include <similie/misc/macros.hpp>
+#include <similie/misc/split_domain.hpp>
+#include <similie/misc/tuned_parallel_for_each.hpp>
 
 #include <Kokkos_Core.hpp>
 
@@ -27,6 +38,24 @@ struct IdentityStencilEvaluator
     }
 };
 
+// Reads the tensor without any bounds logic, valid only where every sampled element is in the
+// domain.
+template <class TensorType>
+struct UncheckedTensorEvaluator
+{
+    TensorType tensor;
+
+    KOKKOS_FUNCTION double operator()(auto sampled_elem, auto cochain_elem) const
+    {
+        return tensor.mem(sampled_elem, cochain_elem);
+    }
+
+    KOKKOS_FUNCTION double value(auto sampler, auto sampled_elem, auto cochain_elem) const
+    {
+        return sampler(sampled_elem, cochain_elem);
+    }
+};
+
 template <class TensorType>
 struct ClampedTensorEvaluator
 {
@@ -67,6 +96,85 @@ struct ZeroOutsideTensorEvaluator
     }
 };
 
+template <
+        template <class> class Evaluator,
+        class TensorType,
+        std::size_t NbFields,
+        std::size_t... FieldId>
+KOKKOS_FUNCTION std::array<Evaluator<TensorType>, NbFields> make_field_evaluators(
+        std::array<TensorType, NbFields> const& tensors,
+        std::index_sequence<FieldId...>)
+{
+    return {Evaluator<TensorType> {tensors[FieldId]}...};
+}
+
+// One evaluator per field of a batch of tensors sharing the same domain.
+template <template <class> class Evaluator, class TensorType, std::size_t NbFields>
+KOKKOS_FUNCTION std::array<Evaluator<TensorType>, NbFields> make_field_evaluators(
+        std::array<TensorType, NbFields> const& tensors)
+{
+    return make_field_evaluators<Evaluator>(tensors, std::make_index_sequence<NbFields> {});
+}
+
+template <class TensorType, std::size_t NbFields, class Elem, std::size_t... FieldId>
+KOKKOS_FUNCTION auto slice_fields(
+        std::array<TensorType, NbFields> const& tensors,
+        Elem elem,
+        std::index_sequence<FieldId...>)
+{
+    return std::array<decltype(tensors[0][elem]), NbFields> {tensors[FieldId][elem]...};
+}
+
+// Slices of every field of a batch of tensors at elem.
+template <class TensorType, std::size_t NbFields, class Elem>
+KOKKOS_FUNCTION auto slice_fields(std::array<TensorType, NbFields> const& tensors, Elem elem)
+{
+    return slice_fields(tensors, elem, std::make_index_sequence<NbFields> {});
+}
+
+/*
+ * Stencils sample the direct neighbours of elem along the HaloSeq dimensions. The batch domain is
+ * split into an interior region, on which interior_functor (free of bounds logic) is launched, and
+ * thin boundary shells, on which boundary_functor (clamping or zeroing out-of-support samples) is
+ * launched.
+ */
+template <
+        class HaloSeq,
+        class ExecSpace,
+        class BatchDomain,
+        class SupportDomain,
+        class InteriorFunctor,
+        class BoundaryFunctor>
+void parallel_for_each_interior_and_boundary(
+        std::string const& label,
+        ExecSpace const& exec_space,
+        BatchDomain const& batch_domain,
+        SupportDomain const& support_domain,
+        InteriorFunctor const& interior_functor,
+        BoundaryFunctor const& boundary_functor)
+{
+    std::optional<BatchDomain> const interior
+            = misc::interior_domain<HaloSeq>(batch_domain, support_domain);
+    if (!interior.has_value()) {
+        SIMILIE_DEBUG_LOG(label + "_boundary");
+        misc::tuned_parallel_for_each(
+                label + "_boundary",
+                exec_space,
+                batch_domain,
+                boundary_functor);
+        return;
+    }
+
+    SIMILIE_DEBUG_LOG(label + "_interior");
+    misc::tuned_parallel_for_each(label + "_interior", exec_space, *interior, interior_functor);
+    for (BatchDomain const& shell : misc::boundary_shells<HaloSeq>(batch_domain, *interior)) {
+        if (!shell.empty()) {
+            SIMILIE_DEBUG_LOG(label + "_boundary");
+            misc::tuned_parallel_for_each(label + "_boundary", exec_space, shell, boundary_functor);
+        }
+    }
+}
+
 } // namespace detail
 
 } // namespace exterior
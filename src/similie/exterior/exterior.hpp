@@ -11,9 +11,11 @@
 #include "cosimplex.hpp"
 #include "evaluators.hpp"
 #include "form.hpp"
+#include "fourier_laplacian.hpp"
 #include "hodge_star.hpp"
 #include "laplacian.hpp"
 #include "local_chain.hpp"
 #include "reduction_and_reconstruction.hpp"
 #include "simplex.hpp"
+#include "sparse_assembly.hpp"
 #include "volume.hpp"
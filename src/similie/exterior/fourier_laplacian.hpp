@@ -0,0 +1,398 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <similie/misc/fft.hpp>
+#include <similie/misc/macros.hpp>
+#include <similie/misc/specialization.hpp>
+#include <similie/misc/tiled_domain.hpp>
+#include <similie/tensor/tensor_impl.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "laplacian.hpp"
+
+namespace sil {
+
+namespace exterior {
+
+namespace detail {
+
+template <class Domain>
+struct DomainExtents;
+
+template <class... DDim>
+struct DomainExtents<ddc::DiscreteDomain<DDim...>>
+{
+    static std::array<std::size_t, sizeof...(DDim)> run(ddc::DiscreteDomain<DDim...> const& dom)
+    {
+        return {static_cast<std::size_t>(ddc::select<DDim>(dom).size())...};
+    }
+};
+
+} // namespace detail
+
+/*
+ * Direct solver of the Hodge-Laplace equation laplacian(u) = f on a uniform Cartesian mesh with a
+ * constant metric and periodic boundary conditions, in O(N log N).
+ *
+ * The translation-invariant stencil of StagedLaplacian is probed once by applying it to unit
+ * impulses placed at the center of the mesh, so the solver inverts exactly the discretization of
+ * StagedLaplacian (away from the boundary, which is made periodic). The stencil is then
+ * diagonalized by the discrete Fourier transform: every wavenumber reduces to a small system
+ * coupling the components of the cochain. Harmonic modes (i.e. constant cochains) are not
+ * determined by the equation and are set to zero.
+ */
+template <
+        tensor::TensorIndex MetricIndex,
+        tensor::TensorNatIndex LaplacianDummyIndex,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> TensorType,
+        misc::Specialization<tensor::Tensor> MetricType,
+        misc::Specialization<tensor::Tensor> PositionType,
+        class ExecSpace>
+class FourierLaplacianSolver
+{
+    using MemorySpace = typename TensorType::memory_space;
+    using AllocatorType = ddc::KokkosAllocator<double, MemorySpace>;
+    using BatchDomainType = typename TensorType::non_indices_domain_t;
+    using BatchElementType = typename BatchDomainType::discrete_element_type;
+
+    static constexpr std::size_t s_rank
+            = ddc::type_seq_size_v<ddc::to_type_seq_t<BatchDomainType>>;
+    static constexpr std::size_t s_nb_components = CochainTag::mem_size();
+    // The stencil of the Laplacian spans the direct neighbours along every dimension.
+    static constexpr std::size_t s_stencil_width = 3;
+
+    ExecSpace m_exec_space;
+    std::array<std::size_t, s_rank> m_extents;
+    std::size_t m_nb_points;
+    // Coefficients S_o of the stencil, indexed by (offset, output component, input component).
+    std::vector<double> m_stencil;
+    std::vector<misc::DiscreteFourierTransform> m_transforms;
+
+    static std::size_t stencil_size()
+    {
+        std::size_t size = 1;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            size *= s_stencil_width;
+        }
+        return size;
+    }
+
+    void probe_stencil(
+            StagedLaplacian<
+                    MetricIndex,
+                    LaplacianDummyIndex,
+                    CochainTag,
+                    TensorType,
+                    MetricType,
+                    PositionType,
+                    ExecSpace>& laplacian,
+            TensorType impulse,
+            TensorType response)
+    {
+        BatchDomainType const batch_domain = impulse.non_indices_domain();
+        std::size_t center = 0;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            center = center * m_extents[dim] + m_extents[dim] / 2;
+        }
+        BatchElementType const center_elem = misc::linear_index_to_element(batch_domain, center);
+
+        m_stencil.assign(stencil_size() * s_nb_components * s_nb_components, 0.);
+        for (std::size_t input_component = 0; input_component < s_nb_components;
+             ++input_component) {
+            typename TensorType::discrete_element_type const impulse_elem(
+                    center_elem,
+                    ddc::DiscreteElement<CochainTag>(input_component));
+            SIMILIE_DEBUG_LOG("similie_fill_fourier_laplacian_impulse");
+            ddc::parallel_for_each(
+                    "similie_fill_fourier_laplacian_impulse",
+                    m_exec_space,
+                    impulse.domain(),
+                    KOKKOS_LAMBDA(typename TensorType::discrete_element_type elem) {
+                        impulse.mem(elem) = elem == impulse_elem ? 1. : 0.;
+                    });
+            laplacian.run(response, impulse);
+            m_exec_space.fence();
+
+            auto response_host = ddc::create_mirror_view_and_copy(response);
+            // (L u)(x) = sum_o S_o u(x + o), so the response at center - o is S_o.
+            for (std::size_t offset_id = 0; offset_id < stencil_size(); ++offset_id) {
+                std::array<std::size_t, s_rank> sampled_ids {};
+                std::size_t remainder = offset_id;
+                for (std::size_t dim = s_rank; dim-- > 0;) {
+                    std::size_t const offset_1d = remainder % s_stencil_width;
+                    remainder /= s_stencil_width;
+                    sampled_ids[dim] = m_extents[dim] / 2 + s_stencil_width / 2 - offset_1d;
+                }
+                std::size_t sampled = 0;
+                for (std::size_t dim = 0; dim < s_rank; ++dim) {
+                    sampled = sampled * m_extents[dim] + sampled_ids[dim];
+                }
+                BatchElementType const sampled_elem
+                        = misc::linear_index_to_element(batch_domain, sampled);
+                for (std::size_t output_component = 0; output_component < s_nb_components;
+                     ++output_component) {
+                    m_stencil[(offset_id * s_nb_components + output_component) * s_nb_components
+                              + input_component]
+                            = response_host(
+                                    sampled_elem,
+                                    ddc::DiscreteElement<CochainTag>(output_component));
+                }
+            }
+        }
+    }
+
+    // Symbol of the stencil at a wavenumber, M(k) = sum_o S_o exp(2 i pi k.o / N).
+    void symbol(
+            std::array<std::size_t, s_rank> const& wavenumber,
+            std::array<std::complex<double>, s_nb_components * s_nb_components>& matrix) const
+    {
+        matrix.fill(std::complex<double>(0.));
+        for (std::size_t offset_id = 0; offset_id < stencil_size(); ++offset_id) {
+            double phase = 0.;
+            std::size_t remainder = offset_id;
+            for (std::size_t dim = s_rank; dim-- > 0;) {
+                double const offset_1d = static_cast<double>(remainder % s_stencil_width)
+                                         - static_cast<double>(s_stencil_width / 2);
+                remainder /= s_stencil_width;
+                phase += 2. * std::numbers::pi * static_cast<double>(wavenumber[dim]) * offset_1d
+                         / static_cast<double>(m_extents[dim]);
+            }
+            std::complex<double> const factor = std::polar(1., phase);
+            for (std::size_t i = 0; i < s_nb_components * s_nb_components; ++i) {
+                matrix[i] += m_stencil[offset_id * s_nb_components * s_nb_components + i] * factor;
+            }
+        }
+    }
+
+    /*
+     * Gaussian elimination with partial pivoting. Directions with a vanishing pivot belong to the
+     * kernel of the Laplacian and get a zero coefficient.
+     */
+    static void solve_symbol(
+            std::array<std::complex<double>, s_nb_components * s_nb_components>& matrix,
+            std::array<std::complex<double>, s_nb_components>& rhs,
+            double tolerance)
+    {
+        constexpr std::size_t n = s_nb_components;
+        std::array<bool, n> singular {};
+        for (std::size_t col = 0; col < n; ++col) {
+            std::size_t pivot = col;
+            for (std::size_t row = col + 1; row < n; ++row) {
+                if (std::abs(matrix[row * n + col]) > std::abs(matrix[pivot * n + col])) {
+                    pivot = row;
+                }
+            }
+            if (std::abs(matrix[pivot * n + col]) <= tolerance) {
+                singular[col] = true;
+                continue;
+            }
+            if (pivot != col) {
+                for (std::size_t k = 0; k < n; ++k) {
+                    std::swap(matrix[col * n + k], matrix[pivot * n + k]);
+                }
+                std::swap(rhs[col], rhs[pivot]);
+            }
+            for (std::size_t row = col + 1; row < n; ++row) {
+                std::complex<double> const factor = matrix[row * n + col] / matrix[col * n + col];
+                for (std::size_t k = col; k < n; ++k) {
+                    matrix[row * n + k] -= factor * matrix[col * n + k];
+                }
+                rhs[row] -= factor * rhs[col];
+            }
+        }
+        for (std::size_t col = n; col-- > 0;) {
+            if (singular[col]) {
+                rhs[col] = 0.;
+                continue;
+            }
+            std::complex<double> value = rhs[col];
+            for (std::size_t k = col + 1; k < n; ++k) {
+                value -= matrix[col * n + k] * rhs[k];
+            }
+            rhs[col] = value / matrix[col * n + col];
+        }
+    }
+
+    /*
+     * Transforms every component along every dimension of the (points, components) array. The
+     * lines are split into one contiguous chunk per host thread, and each chunk reuses its own
+     * scratch buffer across its lines and the dimensions.
+     */
+    void transform(std::vector<std::complex<double>>& values, bool backward) const
+    {
+        std::size_t buffer_size = 0;
+        for (misc::DiscreteFourierTransform const& dft : m_transforms) {
+            buffer_size = std::max(buffer_size, dft.buffer_size());
+        }
+        std::size_t const nb_chunks = static_cast<std::size_t>(
+                Kokkos::DefaultHostExecutionSpace().concurrency());
+        std::vector<std::vector<std::complex<double>>> buffers(nb_chunks);
+        for (std::vector<std::complex<double>>& buffer : buffers) {
+            buffer.reserve(buffer_size);
+        }
+
+        std::size_t inner_stride = s_nb_components;
+        for (std::size_t dim = s_rank; dim-- > 0;) {
+            std::size_t const extent = m_extents[dim];
+            std::size_t const nb_lines = m_nb_points * s_nb_components / extent;
+            std::size_t const chunk_size = (nb_lines + nb_chunks - 1) / nb_chunks;
+            misc::DiscreteFourierTransform const& dft = m_transforms[dim];
+            Kokkos::parallel_for(
+                    "similie_fourier_laplacian_transform",
+                    Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nb_chunks),
+                    [&, inner_stride, extent, nb_lines, chunk_size](std::size_t chunk) {
+                        std::vector<std::complex<double>>& buffer = buffers[chunk];
+                        std::size_t const end = std::min(nb_lines, (chunk + 1) * chunk_size);
+                        for (std::size_t line = chunk * chunk_size; line < end; ++line) {
+                            std::size_t const outer = line / inner_stride;
+                            std::size_t const inner = line % inner_stride;
+                            std::complex<double>* const data
+                                    = values.data() + outer * extent * inner_stride + inner;
+                            if (backward) {
+                                dft.backward(data, inner_stride, buffer);
+                            } else {
+                                dft.forward(data, inner_stride, buffer);
+                            }
+                        }
+                    });
+            Kokkos::DefaultHostExecutionSpace().fence();
+            inner_stride *= extent;
+        }
+    }
+
+public:
+    FourierLaplacianSolver(
+            ExecSpace const& exec_space,
+            TensorType tensor,
+            MetricType metric,
+            PositionType position)
+        : m_exec_space(exec_space)
+        , m_extents(detail::DomainExtents<BatchDomainType>::run(tensor.non_indices_domain()))
+        , m_nb_points(tensor.non_indices_domain().size())
+    {
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            if (m_extents[dim] < s_stencil_width + 2) {
+                throw std::invalid_argument(
+                        "FourierLaplacianSolver requires at least 5 points along every dimension");
+            }
+            m_transforms.emplace_back(m_extents[dim]);
+        }
+
+        ddc::Chunk impulse_alloc(tensor.domain(), AllocatorType());
+        ddc::Chunk response_alloc(tensor.domain(), AllocatorType());
+        TensorType impulse(impulse_alloc);
+        TensorType response(response_alloc);
+        auto laplacian = make_staged_laplacian<MetricIndex, LaplacianDummyIndex, CochainTag>(
+                exec_space,
+                response,
+                impulse,
+                metric,
+                position);
+        probe_stencil(laplacian, impulse, response);
+    }
+
+    // Solves laplacian(solution) = rhs, solution being the zero-mean solution.
+    TensorType solve(TensorType solution, TensorType rhs) const
+    {
+        auto rhs_host = ddc::create_mirror_view_and_copy(rhs);
+        std::vector<std::complex<double>> values(m_nb_points * s_nb_components);
+        std::size_t value_id = 0;
+        ddc::host_for_each(rhs_host.domain(), [&](typename TensorType::discrete_element_type elem) {
+            values[value_id++] = rhs_host(elem);
+        });
+
+        transform(values, false);
+
+        double stencil_norm = 0.;
+        for (double const coefficient : m_stencil) {
+            stencil_norm += std::abs(coefficient);
+        }
+        double const tolerance = 1e-12 * stencil_norm;
+        Kokkos::parallel_for(
+                "similie_fourier_laplacian_divide_by_symbol",
+                Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, m_nb_points),
+                [&](std::size_t point) {
+                    std::array<std::size_t, s_rank> wavenumber {};
+                    std::size_t remainder = point;
+                    for (std::size_t dim = s_rank; dim-- > 0;) {
+                        wavenumber[dim] = remainder % m_extents[dim];
+                        remainder /= m_extents[dim];
+                    }
+                    std::array<std::complex<double>, s_nb_components * s_nb_components> matrix;
+                    symbol(wavenumber, matrix);
+                    std::array<std::complex<double>, s_nb_components> coefficients;
+                    for (std::size_t i = 0; i < s_nb_components; ++i) {
+                        coefficients[i] = values[point * s_nb_components + i];
+                    }
+                    solve_symbol(matrix, coefficients, tolerance);
+                    for (std::size_t i = 0; i < s_nb_components; ++i) {
+                        values[point * s_nb_components + i] = coefficients[i];
+                    }
+                });
+        Kokkos::DefaultHostExecutionSpace().fence();
+
+        transform(values, true);
+
+        auto solution_host = ddc::create_mirror_view(solution);
+        double const normalization = 1. / static_cast<double>(m_nb_points);
+        value_id = 0;
+        ddc::host_for_each(
+                solution_host.domain(),
+                [&](typename TensorType::discrete_element_type elem) {
+                    solution_host(elem) = values[value_id++].real() * normalization;
+                });
+        ddc::parallel_deepcopy(solution, solution_host);
+        return solution;
+    }
+};
+
+template <
+        tensor::TensorIndex MetricIndex,
+        tensor::TensorNatIndex LaplacianDummyIndex,
+        tensor::TensorIndex CochainTag,
+        class ExecSpace,
+        misc::Specialization<tensor::Tensor> TensorType,
+        misc::Specialization<tensor::Tensor> MetricType,
+        misc::Specialization<tensor::Tensor> PositionType>
+FourierLaplacianSolver<
+        MetricIndex,
+        LaplacianDummyIndex,
+        CochainTag,
+        TensorType,
+        MetricType,
+        PositionType,
+        ExecSpace>
+make_fourier_laplacian_solver(
+        ExecSpace const& exec_space,
+        TensorType tensor,
+        MetricType metric,
+        PositionType position)
+{
+    return FourierLaplacianSolver<
+            MetricIndex,
+            LaplacianDummyIndex,
+            CochainTag,
+            TensorType,
+            MetricType,
+            PositionType,
+            ExecSpace>(exec_space, tensor, metric, position);
+}
+
+} // namespace exterior
+
+} // namespace sil
@@ -11,6 +11,7 @@
 #include <similie/misc/macros.hpp>
 #include <similie/misc/small_matrix.hpp>
 #include <similie/misc/specialization.hpp>
+#include <similie/misc/tuned_parallel_for_each.hpp>
 #include <similie/misc/type_seq_conversion.hpp>
 #include <similie/tensor/antisymmetric_tensor.hpp>
 #include <similie/tensor/character.hpp>
@@ -161,12 +162,14 @@ template <
         misc::Specialization<tensor::Tensor> HodgeStarType,
         misc::Specialization<tensor::Tensor> MetricType,
         misc::Specialization<tensor::Tensor> PositionType,
+        class Volumes,
         class BatchElem>
 struct FillDiscreteHodgeStarMem
 {
     HodgeStarType m_hodge_star;
     MetricType m_metric;
     PositionType m_position;
+    Volumes m_volumes;
     BatchElem m_elem;
 
     template <class MemElem>
@@ -182,6 +185,7 @@ struct FillDiscreteHodgeStarMem
                         BatchElem>::
                         value(m_metric,
                               m_position,
+                              m_volumes,
                               m_elem,
                               m_hodge_star.accessor().canonical_natural_element(mem_elem));
     }
@@ -230,6 +234,27 @@ struct DiscreteHodgeStar
             MetricType metric,
             PositionType position,
             BatchElem elem)
+    {
+        run(hodge_tensor,
+            form_tensor,
+            metric,
+            position,
+            ComputedSimplexVolumes<MetricType, PositionType> {metric, position},
+            elem);
+    }
+
+    // Volumes is a simplex volume provider, e.g. the volumes() of a SimplexVolumeCache.
+    template <
+            misc::Specialization<tensor::Tensor> HodgeTensorType,
+            misc::Specialization<tensor::Tensor> FormTensorType,
+            class Volumes>
+    KOKKOS_FUNCTION static void run(
+            HodgeTensorType hodge_tensor,
+            FormTensorType form_tensor,
+            MetricType metric,
+            PositionType position,
+            Volumes const& volumes,
+            BatchElem elem)
     {
         using InputIndex = ddc::type_seq_element_t<
                 0,
@@ -269,12 +294,28 @@ struct DiscreteHodgeStar
         ContinuousHodgeStar<Indices1, Indices2, MetricType, BatchElem>::
                 run(continuous_output, reconstructed_form, metric, elem);
         Reduction<OutputIndexSeq, PositionType, BatchElem, Complex>::
-                run(hodge_tensor, continuous_output, metric, position, elem);
+                run(hodge_tensor, continuous_output, metric, position, volumes, elem);
+    }
+
+    KOKKOS_FUNCTION static double value(
+            MetricType metric,
+            PositionType position,
+            BatchElem elem,
+            auto natural_elem)
+    {
+        return value(
+                metric,
+                position,
+                ComputedSimplexVolumes<MetricType, PositionType> {metric, position},
+                elem,
+                natural_elem);
     }
 
+    template <class Volumes>
     KOKKOS_FUNCTION static double value(
             MetricType metric,
             PositionType position,
+            Volumes const& volumes,
             BatchElem elem,
             auto natural_elem)
     {
@@ -340,7 +381,7 @@ struct DiscreteHodgeStar
         ddc::detail::array(source_natural_elem) = canonical_source_ids;
         source_tensor(source_tensor.accessor().access_element(source_natural_elem)) = 1.;
 
-        run(target_tensor, source_tensor, metric, position, elem);
+        run(target_tensor, source_tensor, metric, position, volumes, elem);
 
         double const source_factor
                 = (odd ? -1. : 1.) / misc::factorial(ddc::type_seq_size_v<Indices1>);
@@ -457,18 +498,20 @@ template <
         misc::Specialization<tensor::Tensor> HodgeStarType,
         misc::Specialization<tensor::Tensor> MetricType,
         misc::Specialization<tensor::Tensor> PositionType,
-        class ExecSpace>
+        class ExecSpace,
+        class Volumes>
 HodgeStarType fill_discrete_hodge_star(
         ExecSpace const& exec_space,
         HodgeStarType hodge_star,
         MetricType metric,
-        PositionType position)
+        PositionType position,
+        Volumes volumes)
 {
     static_assert(
             ddc::type_seq_size_v<ddc::to_type_seq_t<typename PositionType::indices_domain_t>> == 1);
 
     SIMILIE_DEBUG_LOG("similie_compute_hodge_star");
-    ddc::parallel_for_each(
+    misc::tuned_parallel_for_each(
             "similie_compute_hodge_star",
             exec_space,
             hodge_star.non_indices_domain(),
@@ -483,16 +526,44 @@ HodgeStarType fill_discrete_hodge_star(
                                 HodgeStarType,
                                 MetricType,
                                 PositionType,
+                                Volumes,
                                 typename HodgeStarType::non_indices_domain_t::
                                         discrete_element_type> {
                                 hodge_star,
                                 metric,
                                 position,
+                                volumes,
                                 elem});
             });
     return hodge_star;
 }
 
+/*
+ * Recomputes the simplex volumes for every entry of the Hodge star. Operators filling several
+ * Hodge stars on the same mesh should rather share a SimplexVolumeCache.
+ */
+template <
+        misc::Specialization<ddc::detail::TypeSeq> Indices1,
+        misc::Specialization<ddc::detail::TypeSeq> Indices2,
+        CellComplex Complex = CellComplex::CircumcentricDual,
+        misc::Specialization<tensor::Tensor> HodgeStarType,
+        misc::Specialization<tensor::Tensor> MetricType,
+        misc::Specialization<tensor::Tensor> PositionType,
+        class ExecSpace>
+HodgeStarType fill_discrete_hodge_star(
+        ExecSpace const& exec_space,
+        HodgeStarType hodge_star,
+        MetricType metric,
+        PositionType position)
+{
+    return fill_discrete_hodge_star<Indices1, Indices2, Complex>(
+            exec_space,
+            hodge_star,
+            metric,
+            position,
+            ComputedSimplexVolumes<MetricType, PositionType> {metric, position});
+}
+
 template <
         misc::Specialization<ddc::detail::TypeSeq> Indices1,
         misc::Specialization<ddc::detail::TypeSeq> Indices2,
@@ -505,7 +576,7 @@ HodgeStarType fill_continuous_hodge_star(
         MetricType metric)
 {
     SIMILIE_DEBUG_LOG("similie_compute_continuous_hodge_star");
-    ddc::parallel_for_each(
+    misc::tuned_parallel_for_each(
             "similie_compute_continuous_hodge_star",
             exec_space,
             hodge_star.non_indices_domain(),
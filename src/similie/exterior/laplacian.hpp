@@ -3,27 +3,84 @@
 
 #pragma once
 
+#include <array>
 #include <optional>
 #include <utility>
 
 #include <ddc/ddc.hpp>
 
-#include <similie/misc/domain_contains.hpp>
 #include <similie/misc/macros.hpp>
 #include <similie/misc/specialization.hpp>
+#include <similie/misc/split_domain.hpp>
+#include <similie/misc/tiled_domain.hpp>
 #include <similie/tensor/character.hpp>
 #include <similie/tensor/tensor_impl.hpp>
 
+#include <Kokkos_Core.hpp>
+
 #include "coboundary.hpp"
 #include "codifferential.hpp"
+#include "evaluators.hpp"
 
 
 namespace sil {
 
 namespace exterior {
 
+/*
+ * Execution mode of the codifferential of coboundary in StagedLaplacian. Staged runs two sweeps
+ * over the whole grid through a global dual tensor buffer. FusedTiled computes the first stage of
+ * each tile (plus its halo) in team scratch memory and immediately applies the second stage, so
+ * the intermediate never goes through global memory.
+ */
+enum class LaplacianMode {
+    Staged,
+    FusedTiled,
+};
+
 namespace detail {
 
+// Target number of points of a tile of the fused Laplacian, halo excluded.
+inline constexpr std::size_t fused_laplacian_tile_size = 256;
+
+// First stage of the codifferential of coboundary: coboundary, then first Hodge star.
+template <tensor::TensorNatIndex LaplacianDummyIndex, tensor::TensorIndex CochainTag>
+struct CoboundaryAndFirstHodgeStar
+{
+    using coboundary_output_index = coboundary_index_t<LaplacianDummyIndex, CochainTag>;
+
+    template <
+            class DualTensorType,
+            class Evaluator,
+            class HodgeStarType,
+            class ChainType,
+            class LowerChainType,
+            class Elem>
+    KOKKOS_FUNCTION static void run(
+            DualTensorType dual_tensor,
+            Evaluator evaluator,
+            HodgeStarType hodge_star,
+            ChainType chain,
+            LowerChainType lower_chain,
+            Elem elem)
+    {
+        [[maybe_unused]] tensor::TensorAccessor<coboundary_output_index> derivative_accessor;
+        std::array<double, coboundary_output_index::access_size()> derivative_alloc {};
+        ddc::ChunkSpan<
+                double,
+                ddc::DiscreteDomain<coboundary_output_index>,
+                Kokkos::layout_right,
+                typename DualTensorType::memory_space>
+                derivative_span(derivative_alloc.data(), derivative_accessor.domain());
+        sil::tensor::Tensor derivative_tensor(derivative_span);
+
+        Coboundary<LaplacianDummyIndex, CochainTag>::
+                run(derivative_tensor, evaluator, chain, lower_chain, elem);
+
+        sil::tensor::tensor_prod(dual_tensor, derivative_tensor, hodge_star);
+    }
+};
+
 template <
         tensor::TensorIndex MetricIndex,
         tensor::TensorNatIndex LaplacianDummyIndex,
@@ -48,107 +105,229 @@ TensorType codifferential_of_coboundary(
     using coboundary_dual_tensor_index = misc::convert_type_seq_to_t<
             tensor::TensorAntisymmetricIndex,
             codifferential_hodge_output_indices>;
-    using dual_codifferential_hodge_input_indices = ddc::type_seq_merge_t<
-            ddc::detail::TypeSeq<LaplacianDummyIndex>,
-            codifferential_hodge_output_indices>;
-    using dual_codifferential_index = misc::convert_type_seq_to_t<
-            tensor::TensorAntisymmetricIndex,
-            dual_codifferential_hodge_input_indices>;
-    auto chain = tangent_basis<
-            CochainTag::rank() + 1,
-            typename detail::NonSpectatorDimension<
-                    LaplacianDummyIndex,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-    auto lower_chain = tangent_basis<
-            CochainTag::rank(),
-            typename detail::NonSpectatorDimension<
-                    LaplacianDummyIndex,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-    auto dual_chain = tangent_basis<
-            coboundary_dual_tensor_index::rank() + 1,
-            typename detail::NonSpectatorDimension<
-                    LaplacianDummyIndex,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-    auto dual_lower_chain = tangent_basis<
-            coboundary_dual_tensor_index::rank(),
-            typename detail::NonSpectatorDimension<
-                    LaplacianDummyIndex,
-                    typename TensorType::non_indices_domain_t>::type>(exec_space);
-
-    SIMILIE_DEBUG_LOG("similie_deriv_and_apply_first_hodge_star_for_codifferential_of_coboundary");
-    ddc::parallel_for_each(
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            LaplacianDummyIndex,
+            typename TensorType::non_indices_domain_t>::type;
+    auto chain = tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space);
+    auto lower_chain = tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space);
+    auto dual_chain
+            = tangent_basis<coboundary_dual_tensor_index::rank() + 1, non_spectator_dimensions>(
+                    exec_space);
+    auto dual_lower_chain
+            = tangent_basis<coboundary_dual_tensor_index::rank(), non_spectator_dimensions>(
+                    exec_space);
+
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
             "similie_deriv_and_apply_first_hodge_star_for_codifferential_of_coboundary",
             exec_space,
             dual_tensor_buffer.non_indices_domain(),
+            tensor.non_indices_domain(),
             KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
-                [[maybe_unused]] tensor::TensorAccessor<coboundary_output_index>
-                        derivative_accessor;
-                std::array<double, coboundary_output_index::access_size()> derivative_alloc {};
-                ddc::ChunkSpan<
-                        double,
-                        ddc::DiscreteDomain<coboundary_output_index>,
-                        Kokkos::layout_right,
-                        typename TensorType::memory_space>
-                        derivative_span(derivative_alloc.data(), derivative_accessor.domain());
-                sil::tensor::Tensor derivative_tensor(derivative_span);
-
-                Coboundary<LaplacianDummyIndex, CochainTag>::run(
-                        derivative_tensor,
-                        [&](auto sampled_elem, auto cochain_elem) {
-                            auto const clamped_elem = misc::
-                                    clamp_to_domain(tensor.non_indices_domain(), sampled_elem);
-                            return tensor.mem(clamped_elem, cochain_elem);
-                        },
-                        chain,
-                        lower_chain,
-                        elem);
-
-                sil::tensor::
-                        tensor_prod(dual_tensor_buffer[elem], derivative_tensor, hodge_star[elem]);
+                CoboundaryAndFirstHodgeStar<LaplacianDummyIndex, CochainTag>::
+                        run(dual_tensor_buffer[elem],
+                            UncheckedTensorEvaluator<TensorType> {tensor},
+                            hodge_star[elem],
+                            chain,
+                            lower_chain,
+                            elem);
+            },
+            KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                CoboundaryAndFirstHodgeStar<LaplacianDummyIndex, CochainTag>::
+                        run(dual_tensor_buffer[elem],
+                            ClampedTensorEvaluator<TensorType> {tensor},
+                            hodge_star[elem],
+                            chain,
+                            lower_chain,
+                            elem);
             });
 
-    SIMILIE_DEBUG_LOG("similie_deriv_and_apply_second_hodge_star_for_codifferential_of_coboundary");
-    ddc::parallel_for_each(
+    detail::parallel_for_each_interior_and_boundary<ddc::to_type_seq_t<non_spectator_dimensions>>(
             "similie_deriv_and_apply_second_hodge_star_for_codifferential_of_coboundary",
             exec_space,
             out_tensor.non_indices_domain(),
+            dual_tensor_buffer.non_indices_domain(),
             KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
-                [[maybe_unused]] tensor::TensorAccessor<dual_codifferential_index>
-                        dual_codifferential_accessor;
-                std::array<double, dual_codifferential_index::access_size()>
-                        dual_codifferential_alloc {};
+                DualCoboundaryAndSecondHodgeStar<LaplacianDummyIndex, coboundary_output_index>::
+                        run(out_tensor[elem],
+                            UncheckedTensorEvaluator<DualTensorBufferType> {dual_tensor_buffer},
+                            dual_hodge_star[elem],
+                            dual_chain,
+                            dual_lower_chain,
+                            elem);
+            },
+            KOKKOS_LAMBDA(typename TensorType::non_indices_domain_t::discrete_element_type elem) {
+                DualCoboundaryAndSecondHodgeStar<LaplacianDummyIndex, coboundary_output_index>::
+                        run(out_tensor[elem],
+                            ZeroOutsideTensorEvaluator<DualTensorBufferType> {dual_tensor_buffer},
+                            dual_hodge_star[elem],
+                            dual_chain,
+                            dual_lower_chain,
+                            elem);
+            });
+
+    return out_tensor;
+}
+
+template <
+        tensor::TensorIndex MetricIndex,
+        tensor::TensorNatIndex LaplacianDummyIndex,
+        tensor::TensorIndex CochainTag,
+        misc::Specialization<tensor::Tensor> TensorType,
+        misc::Specialization<tensor::Tensor> HodgeStarType,
+        misc::Specialization<tensor::Tensor> DualHodgeStarType,
+        class ExecSpace>
+TensorType fused_codifferential_of_coboundary(
+        ExecSpace const& exec_space,
+        TensorType out_tensor,
+        TensorType tensor,
+        HodgeStarType hodge_star,
+        DualHodgeStarType dual_hodge_star)
+{
+    using coboundary_output_index = coboundary_index_t<LaplacianDummyIndex, CochainTag>;
+    using codifferential_hodge_output_indices = codifferential_hodge_output_indices_t<
+            LaplacianDummyIndex::size() - coboundary_output_index::rank(),
+            LaplacianDummyIndex>;
+    using coboundary_dual_tensor_index = misc::convert_type_seq_to_t<
+            tensor::TensorAntisymmetricIndex,
+            codifferential_hodge_output_indices>;
+    using non_spectator_dimensions = typename detail::NonSpectatorDimension<
+            LaplacianDummyIndex,
+            typename TensorType::non_indices_domain_t>::type;
+    using halo_dimensions = ddc::to_type_seq_t<non_spectator_dimensions>;
+    using batch_domain_type = typename TensorType::non_indices_domain_t;
+    using dual_tile_domain_type = ddc::
+            cartesian_prod_t<batch_domain_type, ddc::DiscreteDomain<coboundary_dual_tensor_index>>;
+    using dual_tile_type = tensor::Tensor<
+            double,
+            dual_tile_domain_type,
+            Kokkos::layout_right,
+            typename TensorType::memory_space>;
+    using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    using scratch_view_type = Kokkos::View<
+            double*,
+            typename ExecSpace::scratch_memory_space,
+            Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    auto chain = tangent_basis<CochainTag::rank() + 1, non_spectator_dimensions>(exec_space);
+    auto lower_chain = tangent_basis<CochainTag::rank(), non_spectator_dimensions>(exec_space);
+    auto dual_chain
+            = tangent_basis<coboundary_dual_tensor_index::rank() + 1, non_spectator_dimensions>(
+                    exec_space);
+    auto dual_lower_chain
+            = tangent_basis<coboundary_dual_tensor_index::rank(), non_spectator_dimensions>(
+                    exec_space);
+
+    batch_domain_type const batch_domain = out_tensor.non_indices_domain();
+    // Support of the dual tensor, i.e. the domain of the global buffer of the staged mode.
+    batch_domain_type const dual_domain = tensor.non_indices_domain();
+    misc::TiledDomain<halo_dimensions, batch_domain_type> const
+            tiles(batch_domain, fused_laplacian_tile_size);
+    if (tiles.size() == 0) {
+        return out_tensor;
+    }
+
+    /*
+     * Tiles lying in these domains are processed without bounds logic. The first stage runs on the
+     * halo tiles, which span dual_domain, and reads tensor (supported on dual_domain). The second
+     * stage runs on the tiles of batch_domain and reads the dual tile.
+     */
+    std::optional<batch_domain_type> const first_stage_interior
+            = misc::interior_domain<halo_dimensions>(dual_domain, dual_domain);
+    std::optional<batch_domain_type> const second_stage_interior
+            = misc::interior_domain<halo_dimensions>(batch_domain, dual_domain);
+    bool const has_first_stage_interior = first_stage_interior.has_value();
+    bool const has_second_stage_interior = second_stage_interior.has_value();
+    batch_domain_type const first_stage_interior_domain
+            = first_stage_interior.value_or(dual_domain);
+    batch_domain_type const second_stage_interior_domain
+            = second_stage_interior.value_or(batch_domain);
+
+    [[maybe_unused]] tensor::TensorAccessor<coboundary_dual_tensor_index> dual_tensor_accessor;
+    ddc::DiscreteDomain<coboundary_dual_tensor_index> const dual_index_domain
+            = dual_tensor_accessor.domain();
+    std::size_t const scratch_size = tiles.max_halo_size() * dual_index_domain.size();
+
+    SIMILIE_DEBUG_LOG("similie_fused_codifferential_of_coboundary");
+    Kokkos::parallel_for(
+            "similie_fused_codifferential_of_coboundary",
+            Kokkos::TeamPolicy<ExecSpace>(exec_space, tiles.size(), Kokkos::AUTO)
+                    .set_scratch_size(
+                            0,
+                            Kokkos::PerTeam(scratch_view_type::shmem_size(scratch_size))),
+            KOKKOS_LAMBDA(member_type const& team) {
+                batch_domain_type const tile = tiles.tile(team.league_rank());
+                batch_domain_type const halo_tile = tiles.lower_halo(tile, dual_domain);
+                scratch_view_type const scratch(team.team_scratch(0), scratch_size);
                 ddc::ChunkSpan<
                         double,
-                        ddc::DiscreteDomain<dual_codifferential_index>,
+                        dual_tile_domain_type,
                         Kokkos::layout_right,
                         typename TensorType::memory_space>
-                        dual_codifferential_span(
-                                dual_codifferential_alloc.data(),
-                                dual_codifferential_accessor.domain());
-                sil::tensor::Tensor dual_codifferential(dual_codifferential_span);
-
-                TransposedCoboundary<LaplacianDummyIndex, coboundary_dual_tensor_index>::run(
-                        dual_codifferential,
-                        [&](auto sampled_elem, auto dual_elem) {
-                            if (!misc::domain_contains(
-                                        dual_tensor_buffer.non_indices_domain(),
-                                        sampled_elem)) {
-                                return 0.0;
+                        dual_tile_span(
+                                scratch.data(),
+                                dual_tile_domain_type(halo_tile, dual_index_domain));
+                dual_tile_type dual_tile(dual_tile_span);
+
+                bool const unchecked_first_stage
+                        = has_first_stage_interior
+                          && misc::domain_contains(first_stage_interior_domain, halo_tile.front())
+                          && misc::domain_contains(first_stage_interior_domain, halo_tile.back());
+                Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange(team, halo_tile.size()),
+                        [&](std::size_t const i) {
+                            typename batch_domain_type::discrete_element_type const elem
+                                    = misc::linear_index_to_element(halo_tile, i);
+                            if (unchecked_first_stage) {
+                                CoboundaryAndFirstHodgeStar<LaplacianDummyIndex, CochainTag>::
+                                        run(dual_tile[elem],
+                                            UncheckedTensorEvaluator<TensorType> {tensor},
+                                            hodge_star[elem],
+                                            chain,
+                                            lower_chain,
+                                            elem);
+                            } else {
+                                CoboundaryAndFirstHodgeStar<LaplacianDummyIndex, CochainTag>::
+                                        run(dual_tile[elem],
+                                            ClampedTensorEvaluator<TensorType> {tensor},
+                                            hodge_star[elem],
+                                            chain,
+                                            lower_chain,
+                                            elem);
+                            }
+                        });
+                team.team_barrier();
+
+                bool const unchecked_second_stage
+                        = has_second_stage_interior
+                          && misc::domain_contains(second_stage_interior_domain, tile.front())
+                          && misc::domain_contains(second_stage_interior_domain, tile.back());
+                Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange(team, tile.size()),
+                        [&](std::size_t const i) {
+                            typename batch_domain_type::discrete_element_type const elem
+                                    = misc::linear_index_to_element(tile, i);
+                            if (unchecked_second_stage) {
+                                DualCoboundaryAndSecondHodgeStar<
+                                        LaplacianDummyIndex,
+                                        coboundary_output_index>::
+                                        run(out_tensor[elem],
+                                            UncheckedTensorEvaluator<dual_tile_type> {dual_tile},
+                                            dual_hodge_star[elem],
+                                            dual_chain,
+                                            dual_lower_chain,
+                                            elem);
+                            } else {
+                                DualCoboundaryAndSecondHodgeStar<
+                                        LaplacianDummyIndex,
+                                        coboundary_output_index>::
+                                        run(out_tensor[elem],
+                                            ZeroOutsideTensorEvaluator<dual_tile_type> {dual_tile},
+                                            dual_hodge_star[elem],
+                                            dual_chain,
+                                            dual_lower_chain,
+                                            elem);
                             }
-                            return dual_tensor_buffer.mem(sampled_elem, dual_elem);
-                        },
-                        dual_chain,
-                        dual_lower_chain,
-                        elem);
-
-                sil::tensor::
-                        tensor_prod(out_tensor[elem], dual_codifferential, dual_hodge_star[elem]);
-                if constexpr (
-                        (LaplacianDummyIndex::size() * (coboundary_output_index::rank() + 1) + 1)
-                                % 2
-                        == 1) {
-                    out_tensor[elem] *= -1;
-                }
+                        });
             });
 
     return out_tensor;
@@ -238,6 +417,7 @@ class StagedLaplacian<
     using DerivativeDualTensorType = tensor::
             Tensor<double, DerivativeDualTensorDomainType, Kokkos::layout_right, MemorySpace>;
     ExecSpace m_exec_space;
+    LaplacianMode m_mode = LaplacianMode::Staged;
     std::optional<DerivativeHodgeStarAllocType> m_derivative_hodge_star_alloc;
     std::optional<DualDerivativeHodgeStarAllocType> m_dual_derivative_hodge_star_alloc;
     std::optional<DerivativeDualTensorAllocType> m_derivative_dual_tensor_alloc;
@@ -263,8 +443,10 @@ public:
             TensorType,
             TensorType tensor,
             MetricType metric,
-            PositionType position)
+            PositionType position,
+            LaplacianMode mode = LaplacianMode::Staged)
         : m_exec_space(exec_space)
+        , m_mode(mode)
     {
         [[maybe_unused]] tensor::tensor_accessor_for_domain_t<
                 hodge_star_domain_t<CoboundaryHodgeInputIndices, CoboundaryHodgeOutputIndices>>
@@ -285,32 +467,51 @@ public:
                         metric.non_indices_domain(),
                         dual_derivative_hodge_star_accessor.domain()),
                 AllocatorType());
-        m_derivative_dual_tensor_alloc.emplace(
-                DerivativeDualTensorDomainType(
-                        tensor.non_indices_domain(),
-                        derivative_dual_tensor_accessor.domain()),
-                AllocatorType());
+        // The fused mode keeps the intermediate in team scratch memory.
+        if (m_mode == LaplacianMode::Staged) {
+            m_derivative_dual_tensor_alloc.emplace(
+                    DerivativeDualTensorDomainType(
+                            tensor.non_indices_domain(),
+                            derivative_dual_tensor_accessor.domain()),
+                    AllocatorType());
+            m_derivative_dual_tensor_buffer.emplace(*m_derivative_dual_tensor_alloc);
+        }
 
         m_derivative_hodge_star.emplace(*m_derivative_hodge_star_alloc);
         m_dual_derivative_hodge_star.emplace(*m_dual_derivative_hodge_star_alloc);
-        m_derivative_dual_tensor_buffer.emplace(*m_derivative_dual_tensor_alloc);
 
+        simplex_volume_cache_t<MetricType, PositionType> const volume_cache
+                = make_simplex_volume_cache(exec_space, metric, position);
         fill_discrete_hodge_star<CoboundaryHodgeInputIndices, CoboundaryHodgeOutputIndices>(
                 exec_space,
                 *m_derivative_hodge_star,
                 metric,
-                position);
+                position,
+                volume_cache.volumes());
         fill_discrete_hodge_star<
                 tensor::upper_t<DualCoboundaryHodgeInputIndices>,
                 DualCoboundaryHodgeOutputIndices>(
                 exec_space,
                 *m_dual_derivative_hodge_star,
                 metric,
-                position);
+                position,
+                volume_cache.volumes());
+        exec_space.fence();
     }
 
     TensorType run(TensorType laplacian_tensor, TensorType tensor)
     {
+        if (m_mode == LaplacianMode::FusedTiled) {
+            return detail::fused_codifferential_of_coboundary<
+                    MetricIndex,
+                    CodifferentialOfCoboundaryIndex,
+                    CochainTag>(
+                    m_exec_space,
+                    laplacian_tensor,
+                    tensor,
+                    *m_derivative_hodge_star,
+                    *m_dual_derivative_hodge_star);
+        }
         return detail::codifferential_of_coboundary<
                 MetricIndex,
                 CodifferentialOfCoboundaryIndex,
@@ -345,7 +546,8 @@ make_staged_laplacian(
         TensorType laplacian_tensor,
         TensorType tensor,
         MetricType metric,
-        PositionType position)
+        PositionType position,
+        LaplacianMode mode = LaplacianMode::Staged)
 {
     return StagedLaplacian<
             MetricIndex,
@@ -354,7 +556,7 @@ make_staged_laplacian(
             TensorType,
             MetricType,
             PositionType,
-            ExecSpace>(exec_space, laplacian_tensor, tensor, metric, position);
+            ExecSpace>(exec_space, laplacian_tensor, tensor, metric, position, mode);
 }
 
 template <
@@ -465,6 +667,7 @@ class StagedLaplacian<
     using CodifferentialTensorType
             = tensor::Tensor<double, CodifferentialDomainType, Kokkos::layout_right, MemorySpace>;
     ExecSpace m_exec_space;
+    LaplacianMode m_mode = LaplacianMode::Staged;
     std::optional<DerivativeHodgeStarAllocType> m_derivative_hodge_star_alloc;
     std::optional<DualDerivativeHodgeStarAllocType> m_dual_derivative_hodge_star_alloc;
     std::optional<DerivativeDualTensorAllocType> m_derivative_dual_tensor_alloc;
@@ -510,8 +713,10 @@ public:
             TensorType laplacian_tensor,
             TensorType tensor,
             MetricType metric,
-            PositionType position)
+            PositionType position,
+            LaplacianMode mode = LaplacianMode::Staged)
         : m_exec_space(exec_space)
+        , m_mode(mode)
     {
         [[maybe_unused]] tensor::tensor_accessor_for_domain_t<
                 hodge_star_domain_t<CoboundaryHodgeInputIndices, CoboundaryHodgeOutputIndices>>
@@ -540,11 +745,14 @@ public:
                         metric.non_indices_domain(),
                         dual_derivative_hodge_star_accessor.domain()),
                 AllocatorType());
-        m_derivative_dual_tensor_alloc.emplace(
-                DerivativeDualTensorDomainType(
-                        tensor.non_indices_domain(),
-                        derivative_dual_tensor_accessor.domain()),
-                AllocatorType());
+        if (m_mode == LaplacianMode::Staged) {
+            m_derivative_dual_tensor_alloc.emplace(
+                    DerivativeDualTensorDomainType(
+                            tensor.non_indices_domain(),
+                            derivative_dual_tensor_accessor.domain()),
+                    AllocatorType());
+            m_derivative_dual_tensor_buffer.emplace(*m_derivative_dual_tensor_alloc);
+        }
         m_hodge_star_alloc.emplace(
                 HodgeStarDomainType(metric.non_indices_domain(), hodge_star_accessor.domain()),
                 AllocatorType());
@@ -565,51 +773,73 @@ public:
 
         m_derivative_hodge_star.emplace(*m_derivative_hodge_star_alloc);
         m_dual_derivative_hodge_star.emplace(*m_dual_derivative_hodge_star_alloc);
-        m_derivative_dual_tensor_buffer.emplace(*m_derivative_dual_tensor_alloc);
         m_hodge_star.emplace(*m_hodge_star_alloc);
         m_dual_hodge_star.emplace(*m_dual_hodge_star_alloc);
         m_dual_tensor_buffer.emplace(*m_dual_tensor_alloc);
         m_codifferential_tensor_buffer.emplace(*m_codifferential_alloc);
         m_coboundary_of_codifferential_buffer.emplace(*m_coboundary_of_codifferential_alloc);
 
+        simplex_volume_cache_t<MetricType, PositionType> const volume_cache
+                = make_simplex_volume_cache(exec_space, metric, position);
         fill_discrete_hodge_star<CoboundaryHodgeInputIndices, CoboundaryHodgeOutputIndices>(
                 exec_space,
                 *m_derivative_hodge_star,
                 metric,
-                position);
+                position,
+                volume_cache.volumes());
         fill_discrete_hodge_star<
                 tensor::upper_t<DualCoboundaryHodgeInputIndices>,
                 DualCoboundaryHodgeOutputIndices>(
                 exec_space,
                 *m_dual_derivative_hodge_star,
                 metric,
-                position);
+                position,
+                volume_cache.volumes());
         fill_discrete_hodge_star<
                 CodifferentialHodgeInputIndices,
-                CodifferentialHodgeOutputIndices>(exec_space, *m_hodge_star, metric, position);
+                CodifferentialHodgeOutputIndices>(
+                exec_space,
+                *m_hodge_star,
+                metric,
+                position,
+                volume_cache.volumes());
         fill_discrete_hodge_star<
                 tensor::upper_t<DualCodifferentialHodgeInputIndices>,
                 DualCodifferentialHodgeOutputIndices>(
                 exec_space,
                 *m_dual_hodge_star,
                 metric,
-                position);
+                position,
+                volume_cache.volumes());
+        exec_space.fence();
     }
 
     TensorType run(TensorType laplacian_tensor, TensorType tensor)
     {
         auto exec_spaces = Kokkos::Experimental::partition_space(m_exec_space, 1, 1);
 
-        detail::codifferential_of_coboundary<
-                MetricIndex,
-                CodifferentialOfCoboundaryIndex,
-                CochainTag>(
-                exec_spaces[0],
-                laplacian_tensor,
-                tensor,
-                *m_derivative_hodge_star,
-                *m_dual_derivative_hodge_star,
-                *m_derivative_dual_tensor_buffer);
+        if (m_mode == LaplacianMode::FusedTiled) {
+            detail::fused_codifferential_of_coboundary<
+                    MetricIndex,
+                    CodifferentialOfCoboundaryIndex,
+                    CochainTag>(
+                    exec_spaces[0],
+                    laplacian_tensor,
+                    tensor,
+                    *m_derivative_hodge_star,
+                    *m_dual_derivative_hodge_star);
+        } else {
+            detail::codifferential_of_coboundary<
+                    MetricIndex,
+                    CodifferentialOfCoboundaryIndex,
+                    CochainTag>(
+                    exec_spaces[0],
+                    laplacian_tensor,
+                    tensor,
+                    *m_derivative_hodge_star,
+                    *m_dual_derivative_hodge_star,
+                    *m_derivative_dual_tensor_buffer);
+        }
 
         StagedCodifferential<
                 MetricIndex,
@@ -737,12 +967,14 @@ public:
     {
     }
 
+    // There is no codifferential of coboundary on top-rank cochains, so the mode has no effect.
     StagedLaplacian(
             ExecSpace const& exec_space,
             TensorType,
             TensorType tensor,
             MetricType metric,
-            PositionType position)
+            PositionType position,
+            [[maybe_unused]] LaplacianMode mode = LaplacianMode::Staged)
         : m_exec_space(exec_space)
     {
         [[maybe_unused]] tensor::tensor_accessor_for_domain_t<hodge_star_domain_t<
@@ -776,16 +1008,25 @@ public:
         m_dual_tensor_buffer.emplace(*m_dual_tensor_alloc);
         m_codifferential_tensor_buffer.emplace(*m_codifferential_alloc);
 
+        simplex_volume_cache_t<MetricType, PositionType> const volume_cache
+                = make_simplex_volume_cache(exec_space, metric, position);
         fill_discrete_hodge_star<
                 CodifferentialHodgeInputIndices,
-                CodifferentialHodgeOutputIndices>(exec_space, *m_hodge_star, metric, position);
+                CodifferentialHodgeOutputIndices>(
+                exec_space,
+                *m_hodge_star,
+                metric,
+                position,
+                volume_cache.volumes());
         fill_discrete_hodge_star<
                 tensor::upper_t<DualCodifferentialHodgeInputIndices>,
                 DualCodifferentialHodgeOutputIndices>(
                 exec_space,
                 *m_dual_hodge_star,
                 metric,
-                position);
+                position,
+                volume_cache.volumes());
+        exec_space.fence();
     }
 
     TensorType run(TensorType laplacian_tensor, TensorType tensor)
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <cassert>
+#include <cstdint>
 
 #include <ddc/ddc.hpp>
 
@@ -133,17 +135,22 @@ struct ReductionTargetIndex<ddc::detail::TypeSeq<Index...>>
     using type = tensor::TensorAntisymmetricIndex<Index...>;
 };
 
+// Bitmask of the ids, ids being smaller than 64.
 template <std::size_t N>
-KOKKOS_FUNCTION bool has_unique_reduction_ids(std::array<std::size_t, N> const& ids)
+KOKKOS_FUNCTION constexpr std::uint64_t reduction_ids_mask(std::array<std::size_t, N> const& ids)
 {
-    for (std::size_t i = 0; i < N; ++i) {
-        for (std::size_t j = i + 1; j < N; ++j) {
-            if (ids[i] == ids[j]) {
-                return false;
-            }
-        }
+    std::uint64_t mask = 0;
+    for (std::size_t id : ids) {
+        assert(id < 64 && "reduction ids must be smaller than 64");
+        mask |= std::uint64_t(1) << id;
     }
-    return true;
+    return mask;
+}
+
+template <std::size_t N>
+KOKKOS_FUNCTION bool has_unique_reduction_ids(std::array<std::size_t, N> const& ids)
+{
+    return static_cast<std::size_t>(Kokkos::popcount(reduction_ids_mask(ids))) == N;
 }
 
 template <std::size_t N>
@@ -187,70 +194,94 @@ KOKKOS_FUNCTION double reduction_determinant(std::array<double, K * K> const& ma
     }
 }
 
+/*
+ * The K-combinations of (0, ..., N-1) in lexicographic order with their complements, generated at
+ * compile time so that the per-point kernels only load them.
+ */
 template <std::size_t N, std::size_t K>
-KOKKOS_FUNCTION std::array<std::size_t, K> combination_from_rank(std::size_t rank)
+struct CombinationTable
 {
+    static_assert(K <= N && N < 16, "unsupported combination table size");
+
+    static constexpr std::size_t s_size = misc::binomial_coefficient(N, K);
+
+    std::array<std::array<std::size_t, K>, s_size> ids;
+    std::array<std::array<std::size_t, N - K>, s_size> complement_ids;
+    // Sign of the permutation (ids, complement_ids) of (0, ..., N-1).
+    std::array<int, s_size> complement_signs;
+    // Rank of the combination given as a bitmask, s_size if the mask has not K bits set.
+    std::array<std::size_t, (std::size_t(1) << N)> ranks;
+};
+
+template <std::size_t N, std::size_t K>
+constexpr CombinationTable<N, K> make_combination_table()
+{
+    CombinationTable<N, K> table {};
+    for (std::size_t& rank : table.ranks) {
+        rank = CombinationTable<N, K>::s_size;
+    }
     std::array<std::size_t, K> ids {};
-    if constexpr (K == 0) {
-        return ids;
-    } else {
-        std::size_t next_candidate = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+        ids[i] = i;
+    }
+    for (std::size_t rank = 0; rank < CombinationTable<N, K>::s_size; ++rank) {
+        std::array<std::size_t, N> permutation {};
+        std::size_t mask = 0;
         for (std::size_t i = 0; i < K; ++i) {
-            for (std::size_t candidate = next_candidate; candidate < N; ++candidate) {
-                std::size_t const remaining = K - i - 1;
-                std::size_t const remaining_space = N - candidate - 1;
-                std::size_t const count
-                        = (remaining == 0) ? 1
-                                           : misc::binomial_coefficient(remaining_space, remaining);
-                if (rank < count) {
-                    ids[i] = candidate;
-                    next_candidate = candidate + 1;
-                    break;
-                }
-                rank -= count;
+            permutation[i] = ids[i];
+            mask |= std::size_t(1) << ids[i];
+        }
+        std::size_t complement_id = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!(mask & (std::size_t(1) << i))) {
+                table.complement_ids[rank][complement_id] = i;
+                permutation[K + complement_id] = i;
+                ++complement_id;
+            }
+        }
+        bool odd = false;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = i + 1; j < N; ++j) {
+                odd = (permutation[i] > permutation[j]) != odd;
+            }
+        }
+        table.ids[rank] = ids;
+        table.complement_signs[rank] = odd ? -1 : 1;
+        table.ranks[mask] = rank;
+
+        // Next combination in lexicographic order.
+        std::size_t i = K;
+        while (i > 0 && ids[i - 1] == N - K + i - 1) {
+            --i;
+        }
+        if (i > 0) {
+            ++ids[i - 1];
+            for (std::size_t j = i; j < K; ++j) {
+                ids[j] = ids[j - 1] + 1;
             }
         }
-        return ids;
     }
+    return table;
 }
 
+// rank must be smaller than binomial_coefficient(N, K).
 template <std::size_t N, std::size_t K>
-KOKKOS_FUNCTION std::size_t combination_rank(std::array<std::size_t, K> const& ids)
+KOKKOS_FUNCTION std::array<std::size_t, K> combination_from_rank(std::size_t rank)
 {
-    if constexpr (K == 0) {
-        return 0;
-    } else {
-        std::size_t rank = 0;
-        std::size_t next_candidate = 0;
-        for (std::size_t i = 0; i < K; ++i) {
-            for (std::size_t candidate = next_candidate; candidate < ids[i]; ++candidate) {
-                std::size_t const remaining = K - i - 1;
-                std::size_t const remaining_space = N - candidate - 1;
-                rank += (remaining == 0) ? 1
-                                         : misc::binomial_coefficient(remaining_space, remaining);
-            }
-            next_candidate = ids[i] + 1;
-        }
-        return rank;
-    }
+    constexpr CombinationTable<N, K> table = make_combination_table<N, K>();
+    assert((rank < CombinationTable<N, K>::s_size) && "combination rank out of range");
+    return table.ids[rank];
 }
 
 template <std::size_t N, std::size_t M>
 KOKKOS_FUNCTION bool hodge_has_unique_ids(std::array<std::size_t, M> const& ids)
 {
-    if constexpr (M > 0) {
-        for (std::size_t i = 0; i < M; ++i) {
-            if (ids[i] >= N) {
-                return false;
-            }
-            for (std::size_t j = i + 1; j < M; ++j) {
-                if (ids[i] == ids[j]) {
-                    return false;
-                }
-            }
+    for (std::size_t id : ids) {
+        if (id >= N) {
+            return false;
         }
     }
-    return true;
+    return has_unique_reduction_ids(ids);
 }
 
 template <std::size_t N, std::size_t M1, std::size_t M2>
@@ -258,67 +289,58 @@ KOKKOS_FUNCTION bool hodge_is_complete_permutation(
         std::array<std::size_t, M1> const& source_ids,
         std::array<std::size_t, M2> const& target_ids)
 {
-    std::array<int, N> counts {};
-    for (std::size_t id : source_ids) {
-        if (id >= N) {
-            return false;
-        }
-        counts[id]++;
-    }
-    for (std::size_t id : target_ids) {
-        if (id >= N) {
-            return false;
-        }
-        counts[id]++;
-    }
-    for (int count : counts) {
-        if (count != 1) {
-            return false;
+    return M1 + M2 == N && hodge_has_unique_ids<N>(source_ids)
+           && hodge_has_unique_ids<N>(target_ids)
+           && (reduction_ids_mask(source_ids) | reduction_ids_mask(target_ids))
+                      == (std::uint64_t(1) << N) - 1;
+}
+
+// Rank of the combination of the ids, in any order. The ids must be K distinct dimensions < N.
+template <std::size_t N, std::size_t K>
+KOKKOS_FUNCTION std::size_t combination_rank(std::array<std::size_t, K> const& ids)
+{
+    constexpr CombinationTable<N, K> table = make_combination_table<N, K>();
+    assert(hodge_has_unique_ids<N>(ids) && "invalid combination ids");
+    return table.ranks[reduction_ids_mask(ids)];
+}
+
+template <std::size_t M>
+KOKKOS_FUNCTION bool has_odd_inversions(std::array<std::size_t, M> const& ids)
+{
+    bool odd = false;
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = i + 1; j < M; ++j) {
+            odd = (ids[i] > ids[j]) != odd;
         }
     }
-    return true;
+    return odd;
 }
 
+/*
+ * Sign of the permutation (source_ids, target_ids) of (0, ..., N-1), which the caller must have
+ * checked with hodge_is_complete_permutation. It is the tabulated sign of the sorted lists, flipped
+ * by the parity of the inversions inside each list.
+ */
 template <std::size_t N, std::size_t M1, std::size_t M2>
 KOKKOS_FUNCTION int hodge_permutation_sign(
         std::array<std::size_t, M1> const& source_ids,
         std::array<std::size_t, M2> const& target_ids)
 {
-    std::array<std::size_t, N> permutation {};
-    for (std::size_t i = 0; i < M1; ++i) {
-        permutation[i] = source_ids[i];
-    }
-    if constexpr (M2 > 0) {
-        for (std::size_t i = 0; i < M2; ++i) {
-            permutation[M1 + i] = target_ids[i];
-        }
-    }
-
-    bool odd = false;
-    for (std::size_t i = 0; i < N; ++i) {
-        for (std::size_t j = i + 1; j < N; ++j) {
-            odd = (permutation[i] > permutation[j]) != odd;
-        }
-    }
-    return odd ? -1 : 1;
+    static_assert(M1 + M2 == N);
+    constexpr CombinationTable<N, M1> table = make_combination_table<N, M1>();
+    assert(hodge_is_complete_permutation<N>(source_ids, target_ids)
+           && "the ids are not a permutation");
+    int const sign = table.complement_signs[table.ranks[reduction_ids_mask(source_ids)]];
+    return has_odd_inversions(source_ids) != has_odd_inversions(target_ids) ? -sign : sign;
 }
 
+// Increasing ids of the dimensions smaller than N missing from ids, which must be distinct and < N.
 template <std::size_t N, std::size_t M>
 KOKKOS_FUNCTION std::array<std::size_t, N - M> hodge_complement_ids(
         std::array<std::size_t, M> const& ids)
 {
-    std::array<std::size_t, N - M> complement {};
-    std::size_t complement_id = 0;
-    for (std::size_t i = 0; i < N; ++i) {
-        bool found = false;
-        for (std::size_t id : ids) {
-            found = found || (id == i);
-        }
-        if (!found) {
-            complement[complement_id++] = i;
-        }
-    }
-    return complement;
+    constexpr CombinationTable<N, M> table = make_combination_table<N, M>();
+    return table.complement_ids[combination_rank<N>(ids)];
 }
 
 template <class PositionIndex, class PositionType, class BatchElem, std::size_t K>
@@ -354,8 +376,7 @@ KOKKOS_FUNCTION double continuous_hodge_value_from_ids(
         std::array<std::size_t, K> const& source_ids,
         std::array<std::size_t, N - K> const& target_ids)
 {
-    if (!hodge_has_unique_ids<N>(source_ids) || !hodge_has_unique_ids<N>(target_ids)
-        || !hodge_is_complete_permutation<N>(source_ids, target_ids)) {
+    if (!hodge_is_complete_permutation<N>(source_ids, target_ids)) {
         return 0.;
     }
 
@@ -400,35 +421,25 @@ KOKKOS_FUNCTION double continuous_hodge_value_from_ids(
            / misc::factorial(K);
 }
 
-template <
-        CellComplex Complex,
-        std::size_t N,
-        std::size_t K,
-        class MetricType,
-        class PositionType,
-        class BatchElem>
+// Volumes is a simplex volume provider (see ComputedSimplexVolumes).
+template <CellComplex Complex, std::size_t N, std::size_t K, class Volumes, class BatchElem>
 KOKKOS_FUNCTION double legacy_discrete_hodge_value_from_ids(
-        MetricType metric,
-        PositionType position,
+        Volumes const& volumes,
         BatchElem elem,
         std::array<std::size_t, K> const& source_ids,
         std::array<std::size_t, N - K> const& target_ids)
 {
-    if (!hodge_has_unique_ids<N>(source_ids) || !hodge_has_unique_ids<N>(target_ids)
-        || !hodge_is_complete_permutation<N>(source_ids, target_ids)) {
+    static_assert(Complex != CellComplex::Primal, "The dual volumes need a dual cell complex.");
+    if (!hodge_is_complete_permutation<N>(source_ids, target_ids)) {
         return 0.;
     }
-    double const primal_volume
-            = SimplexVolume<CellComplex::Primal, N, MetricType, PositionType, BatchElem>::
-                    template run<K>(metric, position, elem, source_ids);
+    double const primal_volume = volumes.primal(elem, source_ids);
     if (primal_volume == 0.) {
         return 0.;
     }
 
     return static_cast<double>(hodge_permutation_sign<N>(source_ids, target_ids))
-           * DualSimplexVolume<Complex, N, MetricType, PositionType, BatchElem>::template run<
-                   K>(metric, position, elem, source_ids)
-           / (primal_volume * misc::factorial(K));
+           * volumes.dual(elem, source_ids) / (primal_volume * misc::factorial(K));
 }
 
 template <class ReductionNaturalElemType, std::size_t N1, std::size_t N2>
@@ -538,6 +549,28 @@ struct Reduction
             MetricType metric,
             PositionType position,
             BatchElem elem)
+    {
+        run(reduced_tensor,
+            form_tensor,
+            metric,
+            position,
+            ComputedSimplexVolumes<MetricType, PositionType> {metric, position},
+            elem);
+    }
+
+    // Metric-aware reduction reading the simplex volumes from a provider, e.g. a volume cache.
+    template <
+            misc::Specialization<tensor::Tensor> ReductionTensorType,
+            misc::Specialization<tensor::Tensor> FormTensorType,
+            misc::Specialization<tensor::Tensor> MetricType,
+            class Volumes>
+    KOKKOS_FUNCTION static void run(
+            ReductionTensorType reduced_tensor,
+            FormTensorType form_tensor,
+            MetricType metric,
+            PositionType position,
+            Volumes const& volumes,
+            BatchElem elem)
     {
         if constexpr (Complex == CellComplex::Primal) {
             run(reduced_tensor, form_tensor, position, elem);
@@ -581,7 +614,7 @@ struct Reduction
                             = detail::legacy_discrete_hodge_value_from_ids<
                                     Complex,
                                     N,
-                                    K>(metric, position, elem, primal_ids, target_ids);
+                                    K>(volumes, elem, primal_ids, target_ids);
                 }
             }
 
@@ -682,6 +715,22 @@ struct Reduction
             PositionType position,
             BatchElem elem,
             auto natural_elem)
+    {
+        return value(
+                metric,
+                position,
+                ComputedSimplexVolumes<MetricType, PositionType> {metric, position},
+                elem,
+                natural_elem);
+    }
+
+    template <misc::Specialization<tensor::Tensor> MetricType, class Volumes>
+    KOKKOS_FUNCTION static double value(
+            MetricType metric,
+            PositionType position,
+            Volumes const& volumes,
+            BatchElem elem,
+            auto natural_elem)
     {
         if constexpr (Complex == CellComplex::Primal) {
             return value(position, elem, natural_elem);
@@ -722,7 +771,7 @@ struct Reduction
             }
             source_tensor(source_tensor.accessor().access_element(source_natural_elem)) = 1.;
 
-            run(target_tensor, source_tensor, metric, position, elem);
+            run(target_tensor, source_tensor, metric, position, volumes, elem);
 
             if constexpr (target_index_type::rank() == 0) {
                 return target_tensor.get(
@@ -0,0 +1,327 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <ddc/ddc.hpp>
+
+#include <similie/misc/macros.hpp>
+#include <similie/misc/specialization.hpp>
+#include <similie/misc/tiled_domain.hpp>
+#include <similie/tensor/tensor_impl.hpp>
+
+#include <Kokkos_Core.hpp>
+
+namespace sil {
+
+namespace exterior {
+
+/*
+ * Sparse matrix in compressed sparse row format: the entries of row i are (columns(k), values(k))
+ * for k in [row_ptrs(i), row_ptrs(i + 1)), sorted by column. Rows and columns are the flat
+ * (layout_right) indices of the output and input domains of the assembled operator.
+ */
+template <class MemorySpace>
+struct SparseOperator
+{
+    using memory_space = MemorySpace;
+    using index_type = std::int32_t;
+
+    std::size_t nb_rows = 0;
+    std::size_t nb_columns = 0;
+    Kokkos::View<index_type*, MemorySpace> row_ptrs;
+    Kokkos::View<index_type*, MemorySpace> columns;
+    Kokkos::View<double*, MemorySpace> values;
+
+    std::size_t nnz() const
+    {
+        return values.extent(0);
+    }
+};
+
+namespace detail {
+
+/*
+ * Coloring of the basis cochains of the input domain: two basis cochains of the same color are at
+ * least 2 * radius + 1 points apart along every dimension of StencilDims, so that no output entry
+ * depends on more than one of them. The other dimensions (typically tensor indices) are fully
+ * coupled, every point getting its own color along them.
+ */
+template <class StencilDims, class InputDomain, class OutputDomain>
+class SparseAssemblyColoring;
+
+template <class StencilDims, class... IDim, class OutputDomain>
+class SparseAssemblyColoring<StencilDims, ddc::DiscreteDomain<IDim...>, OutputDomain>
+{
+    static constexpr std::size_t s_rank = sizeof...(IDim);
+
+    ddc::DiscreteDomain<IDim...> m_input_domain;
+    std::array<std::size_t, s_rank> m_extents;
+    std::array<std::size_t, s_rank> m_periods;
+    std::size_t m_radius;
+
+    template <class IDim1>
+    static constexpr bool is_stencil_dim = ddc::type_seq_contains_v<
+            ddc::detail::TypeSeq<IDim1>,
+            StencilDims>;
+
+    template <class IDim1>
+    static constexpr std::size_t rank_of
+            = ddc::type_seq_rank_v<IDim1, ddc::detail::TypeSeq<IDim...>>;
+
+    // Offset of the unique basis cochain of the given color digit coupled with the row, or -1.
+    template <class IDim1>
+    KOKKOS_FUNCTION std::ptrdiff_t column_offset(
+            typename OutputDomain::discrete_element_type row_elem,
+            std::size_t digit) const
+    {
+        constexpr std::size_t dim = rank_of<IDim1>;
+        if constexpr (is_stencil_dim<IDim1>) {
+            std::ptrdiff_t const radius = static_cast<std::ptrdiff_t>(m_radius);
+            std::ptrdiff_t const period = static_cast<std::ptrdiff_t>(m_periods[dim]);
+            std::ptrdiff_t const center
+                    = static_cast<std::ptrdiff_t>(row_elem.template uid<IDim1>())
+                      - static_cast<std::ptrdiff_t>(m_input_domain.front().template uid<IDim1>());
+            std::ptrdiff_t const lowest = Kokkos::max(center - radius, std::ptrdiff_t(0));
+            std::ptrdiff_t const highest = Kokkos::
+                    min(center + radius, static_cast<std::ptrdiff_t>(m_extents[dim]) - 1);
+            std::ptrdiff_t const offset
+                    = lowest
+                      + ((static_cast<std::ptrdiff_t>(digit) - lowest) % period + period) % period;
+            return offset <= highest ? offset : -1;
+        } else {
+            return static_cast<std::ptrdiff_t>(digit);
+        }
+    }
+
+public:
+    SparseAssemblyColoring(ddc::DiscreteDomain<IDim...> const& input_domain, std::size_t radius)
+        : m_input_domain(input_domain)
+        , m_extents {static_cast<std::size_t>(ddc::select<IDim>(input_domain).size())...}
+        , m_periods {}
+        , m_radius(radius)
+    {
+        static_assert(
+                ((!is_stencil_dim<IDim>
+                  || ddc::type_seq_contains_v<
+                          ddc::detail::TypeSeq<IDim>,
+                          ddc::to_type_seq_t<OutputDomain>>)
+                 && ...),
+                "The stencil dimensions must be shared by the input and output domains");
+        std::array<bool, s_rank> const stencil_dims {is_stencil_dim<IDim>...};
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            m_periods[dim] = stencil_dims[dim] ? std::min(2 * radius + 1, m_extents[dim])
+                                               : m_extents[dim];
+        }
+    }
+
+    std::size_t size() const
+    {
+        std::size_t nb_colors = 1;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            nb_colors *= m_periods[dim];
+        }
+        return nb_colors;
+    }
+
+    KOKKOS_FUNCTION std::size_t color(ddc::DiscreteElement<IDim...> elem) const
+    {
+        std::array<std::size_t, s_rank> const offsets {static_cast<std::size_t>(
+                elem.template uid<IDim>() - m_input_domain.front().template uid<IDim>())...};
+        std::size_t color = 0;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            color = color * m_periods[dim] + offsets[dim] % m_periods[dim];
+        }
+        return color;
+    }
+
+    // Flat index of the basis cochain of the color coupled with the row, or -1 if there is none.
+    KOKKOS_FUNCTION std::int64_t column(
+            typename OutputDomain::discrete_element_type row_elem,
+            std::size_t color) const
+    {
+        std::array<std::size_t, s_rank> digits {};
+        for (std::size_t dim = s_rank; dim-- > 0;) {
+            digits[dim] = color % m_periods[dim];
+            color /= m_periods[dim];
+        }
+        std::array<std::ptrdiff_t, s_rank> const offsets {
+                column_offset<IDim>(row_elem, digits[rank_of<IDim>])...};
+        std::int64_t column = 0;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            if (offsets[dim] < 0) {
+                return -1;
+            }
+            column = column * static_cast<std::int64_t>(m_extents[dim]) + offsets[dim];
+        }
+        return column;
+    }
+};
+
+} // namespace detail
+
+/*
+ * Assembles the matrix of a linear operator mapping cochains on input_domain to cochains on
+ * output_domain, by applying it to sums of basis cochains far enough from each other (along the
+ * StencilDims dimensions) for their images not to overlap. apply_operator(input, output) must
+ * overwrite output with the image of input, both being tensors allocated in the memory space of
+ * exec_space, and must not couple points more than stencil_radius apart along StencilDims. The
+ * operator is applied twice per color: once to count the nonzeros of every row, once to write them
+ * directly in CSR format on the device.
+ */
+template <
+        misc::Specialization<ddc::detail::TypeSeq> StencilDims,
+        class ExecSpace,
+        class InputDomain,
+        class OutputDomain,
+        class Operator>
+SparseOperator<typename ExecSpace::memory_space> assemble_sparse_operator(
+        ExecSpace const& exec_space,
+        InputDomain const& input_domain,
+        OutputDomain const& output_domain,
+        Operator&& apply_operator,
+        std::size_t stencil_radius = 1)
+{
+    using memory_space = typename ExecSpace::memory_space;
+    using index_type = typename SparseOperator<memory_space>::index_type;
+    using coloring_type = detail::SparseAssemblyColoring<StencilDims, InputDomain, OutputDomain>;
+
+    SIMILIE_DEBUG_LOG("similie_assemble_sparse_operator");
+    coloring_type const coloring(input_domain, stencil_radius);
+    std::size_t const nb_rows = output_domain.size();
+
+    ddc::Chunk probe_alloc(input_domain, ddc::KokkosAllocator<double, memory_space>());
+    ddc::Chunk applied_alloc(output_domain, ddc::KokkosAllocator<double, memory_space>());
+    tensor::Tensor probe(probe_alloc);
+    tensor::Tensor applied(applied_alloc);
+    auto probe_span = probe_alloc.span_view();
+    auto applied_span = applied_alloc.span_cview();
+
+    auto const apply_color = [&](std::size_t color) {
+        Kokkos::parallel_for(
+                "similie_sparse_assembly_fill_probe",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, input_domain.size()),
+                KOKKOS_LAMBDA(std::size_t index) {
+                    auto const elem = misc::linear_index_to_element(input_domain, index);
+                    probe_span(elem) = coloring.color(elem) == color ? 1. : 0.;
+                });
+        exec_space.fence();
+        apply_operator(probe, applied);
+        exec_space.fence();
+    };
+
+    SparseOperator<memory_space> sparse_operator;
+    sparse_operator.nb_rows = nb_rows;
+    sparse_operator.nb_columns = input_domain.size();
+    sparse_operator.row_ptrs
+            = Kokkos::View<index_type*, memory_space>("similie_sparse_row_ptrs", nb_rows + 1);
+    auto row_ptrs = sparse_operator.row_ptrs;
+
+    for (std::size_t color = 0; color < coloring.size(); ++color) {
+        apply_color(color);
+        Kokkos::parallel_for(
+                "similie_sparse_assembly_count",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, nb_rows),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    auto const elem = misc::linear_index_to_element(output_domain, row);
+                    if (applied_span(elem) != 0. && coloring.column(elem, color) >= 0) {
+                        ++row_ptrs(row + 1);
+                    }
+                });
+    }
+    Kokkos::parallel_scan(
+            "similie_sparse_assembly_row_ptrs",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 1, nb_rows + 1),
+            KOKKOS_LAMBDA(std::size_t row, index_type& partial_sum, bool is_final) {
+                partial_sum += row_ptrs(row);
+                if (is_final) {
+                    row_ptrs(row) = partial_sum;
+                }
+            });
+    exec_space.fence();
+    index_type nnz = 0;
+    Kokkos::deep_copy(nnz, Kokkos::subview(row_ptrs, nb_rows));
+
+    sparse_operator.columns = Kokkos::View<index_type*, memory_space>(
+            "similie_sparse_columns",
+            static_cast<std::size_t>(nnz));
+    sparse_operator.values = Kokkos::View<double*, memory_space>(
+            "similie_sparse_values",
+            static_cast<std::size_t>(nnz));
+    auto columns = sparse_operator.columns;
+    auto values = sparse_operator.values;
+    Kokkos::View<index_type*, memory_space> cursors("similie_sparse_assembly_cursors", nb_rows);
+    Kokkos::deep_copy(
+            exec_space,
+            cursors,
+            Kokkos::subview(row_ptrs, Kokkos::pair<std::size_t, std::size_t>(0, nb_rows)));
+
+    for (std::size_t color = 0; color < coloring.size(); ++color) {
+        apply_color(color);
+        Kokkos::parallel_for(
+                "similie_sparse_assembly_fill",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, nb_rows),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    auto const elem = misc::linear_index_to_element(output_domain, row);
+                    double const value = applied_span(elem);
+                    std::int64_t const column = coloring.column(elem, color);
+                    if (value != 0. && column >= 0) {
+                        index_type const entry = cursors(row)++;
+                        columns(entry) = static_cast<index_type>(column);
+                        values(entry) = value;
+                    }
+                });
+    }
+
+    // Rows are short (one entry per color at most), an insertion sort is enough.
+    Kokkos::parallel_for(
+            "similie_sparse_assembly_sort_rows",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, nb_rows),
+            KOKKOS_LAMBDA(std::size_t row) {
+                for (index_type i = row_ptrs(row) + 1; i < row_ptrs(row + 1); ++i) {
+                    index_type const column = columns(i);
+                    double const value = values(i);
+                    index_type j = i;
+                    for (; j > row_ptrs(row) && columns(j - 1) > column; --j) {
+                        columns(j) = columns(j - 1);
+                        values(j) = values(j - 1);
+                    }
+                    columns(j) = column;
+                    values(j) = value;
+                }
+            });
+    exec_space.fence();
+    return sparse_operator;
+}
+
+// y = A x on the flat (layout_right) representations of the input and output cochains.
+template <class ExecSpace, class MemorySpace, class InputView, class OutputView>
+void apply_sparse_operator(
+        ExecSpace const& exec_space,
+        SparseOperator<MemorySpace> const& sparse_operator,
+        InputView x,
+        OutputView y)
+{
+    auto const row_ptrs = sparse_operator.row_ptrs;
+    auto const columns = sparse_operator.columns;
+    auto const values = sparse_operator.values;
+    Kokkos::parallel_for(
+            "similie_apply_sparse_operator",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, sparse_operator.nb_rows),
+            KOKKOS_LAMBDA(std::size_t row) {
+                double sum = 0.;
+                for (auto entry = row_ptrs(row); entry < row_ptrs(row + 1); ++entry) {
+                    sum += values(entry) * x(columns(entry));
+                }
+                y(row) = sum;
+            });
+}
+
+} // namespace exterior
+
+} // namespace sil
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <utility>
 
 #include <ddc/ddc.hpp>
 
@@ -11,9 +13,14 @@
 #include <similie/misc/clamp_to_domain.hpp>
 #include <similie/misc/domain_contains.hpp>
 #include <similie/misc/factorial.hpp>
+#include <similie/misc/macros.hpp>
 #include <similie/misc/small_matrix.hpp>
+#include <similie/misc/specialization.hpp>
+#include <similie/misc/tuned_parallel_for_each.hpp>
 #include <similie/tensor/metric.hpp>
 
+#include <Kokkos_Core.hpp>
+
 namespace sil {
 
 namespace exterior {
@@ -172,6 +179,206 @@ struct DualSimplexVolume
     }
 };
 
+/*
+ * Simplex volumes as read by the discrete Hodge star and the metric-aware reduction: primal(elem,
+ * ids) is the volume of the simplex spanned by the edges ids at elem, dual(elem, ids) the volume
+ * of its dual cell. This provider recomputes them from the metric and the positions at each call.
+ */
+template <
+        misc::Specialization<tensor::Tensor> MetricType,
+        misc::Specialization<tensor::Tensor> PositionType>
+struct ComputedSimplexVolumes
+{
+    static constexpr std::size_t s_dimension = ddc::type_seq_element_t<
+            0,
+            ddc::to_type_seq_t<typename PositionType::indices_domain_t>>::size();
+
+    MetricType metric;
+    PositionType position;
+
+    template <class BatchElem, std::size_t K>
+    KOKKOS_FUNCTION double primal(BatchElem elem, std::array<std::size_t, K> const& ids) const
+    {
+        return SimplexVolume<
+                CellComplex::Primal,
+                s_dimension,
+                MetricType,
+                PositionType,
+                BatchElem>::template run<K>(metric, position, elem, ids);
+    }
+
+    template <class BatchElem, std::size_t K>
+    KOKKOS_FUNCTION double dual(BatchElem elem, std::array<std::size_t, K> const& ids) const
+    {
+        return primal(elem, detail::complement<s_dimension>(ids));
+    }
+};
+
+// Simplex of a SimplexVolumeCache, identified by the bitmask of the edges spanning it.
+struct SimplexVolumeIndex
+{
+};
+
+namespace detail {
+
+template <std::size_t K>
+KOKKOS_FUNCTION std::size_t simplex_mask(std::array<std::size_t, K> const& ids)
+{
+    std::size_t mask = 0;
+    for (std::size_t id : ids) {
+        mask |= std::size_t(1) << id;
+    }
+    return mask;
+}
+
+KOKKOS_INLINE_FUNCTION std::size_t simplex_mask_degree(std::size_t mask)
+{
+    std::size_t degree = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        ++degree;
+    }
+    return degree;
+}
+
+template <std::size_t K>
+KOKKOS_FUNCTION std::array<std::size_t, K> simplex_ids_from_mask(std::size_t mask)
+{
+    std::array<std::size_t, K> ids {};
+    std::size_t i = 0;
+    for (std::size_t id = 0; mask != 0; ++id, mask >>= 1) {
+        if ((mask & 1) != 0) {
+            ids[i++] = id;
+        }
+    }
+    return ids;
+}
+
+template <
+        std::size_t N,
+        class MetricType,
+        class PositionType,
+        class BatchElem,
+        std::size_t... K>
+KOKKOS_FUNCTION double simplex_volume_from_mask(
+        MetricType metric,
+        PositionType position,
+        BatchElem elem,
+        std::size_t mask,
+        std::index_sequence<K...>)
+{
+    using VolumeType = SimplexVolume<CellComplex::Primal, N, MetricType, PositionType, BatchElem>;
+    std::size_t const degree = simplex_mask_degree(mask);
+    double volume = 0.;
+    ((volume = degree == K ? VolumeType::template run<
+                                     K>(metric, position, elem, simplex_ids_from_mask<K>(mask))
+                           : volume),
+     ...);
+    return volume;
+}
+
+} // namespace detail
+
+// Provider reading the simplex volumes stored in a SimplexVolumeCache.
+template <std::size_t N, class VolumeSpan>
+struct CachedSimplexVolumes
+{
+    using batch_element_type = typename decltype(ddc::remove_dims_of<SimplexVolumeIndex>(
+            std::declval<typename VolumeSpan::discrete_domain_type>()))::discrete_element_type;
+
+    VolumeSpan volumes;
+
+    template <class BatchElem, std::size_t K>
+    KOKKOS_FUNCTION double primal(BatchElem elem, std::array<std::size_t, K> const& ids) const
+    {
+        std::size_t const mask = detail::simplex_mask(ids);
+        // A repeated edge spans a degenerate simplex.
+        if (detail::simplex_mask_degree(mask) != K) {
+            return 0.;
+        }
+        return volumes(batch_element_type(elem), ddc::DiscreteElement<SimplexVolumeIndex>(mask));
+    }
+
+    template <class BatchElem, std::size_t K>
+    KOKKOS_FUNCTION double dual(BatchElem elem, std::array<std::size_t, K> const& ids) const
+    {
+        return primal(elem, detail::complement<N>(ids));
+    }
+};
+
+/*
+ * Volumes of the 2^N simplices spanned by the edges of every point of a mesh, evaluated once in
+ * parallel. They are stored per point in bitmask order, the 2^N subsets of edges covering all the
+ * degrees without any unused entry.
+ */
+template <std::size_t N, class BatchDomain, class MemorySpace>
+class SimplexVolumeCache
+{
+public:
+    using domain_type
+            = ddc::cartesian_prod_t<BatchDomain, ddc::DiscreteDomain<SimplexVolumeIndex>>;
+    using span_type
+            = ddc::ChunkSpan<double const, domain_type, Kokkos::layout_right, MemorySpace>;
+
+private:
+    ddc::Chunk<double, domain_type, ddc::KokkosAllocator<double, MemorySpace>> m_volumes;
+
+public:
+    template <
+            class ExecSpace,
+            misc::Specialization<tensor::Tensor> MetricType,
+            misc::Specialization<tensor::Tensor> PositionType>
+    SimplexVolumeCache(ExecSpace const& exec_space, MetricType metric, PositionType position)
+        : m_volumes(
+                  domain_type(
+                          metric.non_indices_domain(),
+                          ddc::DiscreteDomain<SimplexVolumeIndex>(
+                                  ddc::DiscreteElement<SimplexVolumeIndex>(0),
+                                  ddc::DiscreteVector<SimplexVolumeIndex>(std::size_t(1) << N))),
+                  ddc::KokkosAllocator<double, MemorySpace>())
+    {
+        using batch_element_type = typename BatchDomain::discrete_element_type;
+        auto volumes = m_volumes.span_view();
+        SIMILIE_DEBUG_LOG("similie_compute_simplex_volumes");
+        misc::tuned_parallel_for_each(
+                "similie_compute_simplex_volumes",
+                exec_space,
+                volumes.domain(),
+                KOKKOS_LAMBDA(typename domain_type::discrete_element_type elem) {
+                    volumes(elem) = detail::simplex_volume_from_mask<N>(
+                            metric,
+                            position,
+                            batch_element_type(elem),
+                            elem.template uid<SimplexVolumeIndex>(),
+                            std::make_index_sequence<N + 1> {});
+                });
+    }
+
+    CachedSimplexVolumes<N, span_type> volumes() const
+    {
+        return {m_volumes.span_cview()};
+    }
+};
+
+template <
+        misc::Specialization<tensor::Tensor> MetricType,
+        misc::Specialization<tensor::Tensor> PositionType>
+using simplex_volume_cache_t = SimplexVolumeCache<
+        ComputedSimplexVolumes<MetricType, PositionType>::s_dimension,
+        typename MetricType::non_indices_domain_t,
+        typename MetricType::memory_space>;
+
+template <
+        class ExecSpace,
+        misc::Specialization<tensor::Tensor> MetricType,
+        misc::Specialization<tensor::Tensor> PositionType>
+simplex_volume_cache_t<MetricType, PositionType> make_simplex_volume_cache(
+        ExecSpace const& exec_space,
+        MetricType metric,
+        PositionType position)
+{
+    return simplex_volume_cache_t<MetricType, PositionType>(exec_space, metric, position);
+}
+
 } // namespace exterior
 
 } // namespace sil
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+namespace sil {
+
+namespace misc {
+
+/*
+ * Host-side unnormalized discrete Fourier transform of a fixed size, O(n log n) for any n.
+ * Power-of-two sizes use an iterative radix-2 Cooley-Tukey transform, other sizes are reduced to
+ * a power-of-two circular convolution (Bluestein algorithm).
+ */
+class DiscreteFourierTransform
+{
+    std::size_t m_size;
+    std::size_t m_padded_size;
+    std::vector<std::complex<double>> m_twiddles;
+    std::vector<std::complex<double>> m_chirp;
+    std::vector<std::complex<double>> m_chirp_filter_spectrum;
+
+    static constexpr bool is_power_of_two(std::size_t n)
+    {
+        return n != 0 && (n & (n - 1)) == 0;
+    }
+
+    // In-place forward transform of m_padded_size contiguous values.
+    void radix2(std::complex<double>* data) const
+    {
+        std::size_t const n = m_padded_size;
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(data[i], data[j]);
+            }
+        }
+        for (std::size_t length = 2; length <= n; length <<= 1) {
+            std::size_t const twiddle_stride = n / length;
+            for (std::size_t begin = 0; begin < n; begin += length) {
+                for (std::size_t k = 0; k < length / 2; ++k) {
+                    std::complex<double> const u = data[begin + k];
+                    std::complex<double> const v
+                            = data[begin + k + length / 2] * m_twiddles[k * twiddle_stride];
+                    data[begin + k] = u + v;
+                    data[begin + k + length / 2] = u - v;
+                }
+            }
+        }
+    }
+
+    void radix2_backward(std::complex<double>* data) const
+    {
+        for (std::size_t i = 0; i < m_padded_size; ++i) {
+            data[i] = std::conj(data[i]);
+        }
+        radix2(data);
+        for (std::size_t i = 0; i < m_padded_size; ++i) {
+            data[i] = std::conj(data[i]);
+        }
+    }
+
+    void forward_contiguous(std::complex<double>* data, std::complex<double>* buffer) const
+    {
+        if (m_size == m_padded_size) {
+            radix2(data);
+            return;
+        }
+        for (std::size_t i = 0; i < m_padded_size; ++i) {
+            buffer[i] = i < m_size ? data[i] * m_chirp[i] : std::complex<double>(0.);
+        }
+        radix2(buffer);
+        for (std::size_t i = 0; i < m_padded_size; ++i) {
+            buffer[i] *= m_chirp_filter_spectrum[i];
+        }
+        radix2_backward(buffer);
+        double const normalization = 1. / static_cast<double>(m_padded_size);
+        for (std::size_t i = 0; i < m_size; ++i) {
+            data[i] = buffer[i] * m_chirp[i] * normalization;
+        }
+    }
+
+public:
+    explicit DiscreteFourierTransform(std::size_t size)
+        : m_size(size)
+        , m_padded_size(1)
+    {
+        if (size <= 1) {
+            return;
+        }
+        if (is_power_of_two(size)) {
+            m_padded_size = size;
+        } else {
+            while (m_padded_size < 2 * size - 1) {
+                m_padded_size <<= 1;
+            }
+        }
+        m_twiddles.resize(m_padded_size / 2);
+        for (std::size_t k = 0; k < m_padded_size / 2; ++k) {
+            m_twiddles[k] = std::polar(
+                    1.,
+                    -2. * std::numbers::pi * static_cast<double>(k)
+                            / static_cast<double>(m_padded_size));
+        }
+        if (m_padded_size == size) {
+            return;
+        }
+
+        // exp(-i pi k^2 / n), with k^2 reduced modulo 2n to preserve accuracy for large k.
+        m_chirp.resize(size);
+        for (std::size_t k = 0; k < size; ++k) {
+            m_chirp[k] = std::polar(
+                    1.,
+                    -std::numbers::pi * static_cast<double>((k * k) % (2 * size))
+                            / static_cast<double>(size));
+        }
+        m_chirp_filter_spectrum.assign(m_padded_size, std::complex<double>(0.));
+        m_chirp_filter_spectrum[0] = std::conj(m_chirp[0]);
+        for (std::size_t k = 1; k < size; ++k) {
+            m_chirp_filter_spectrum[k] = std::conj(m_chirp[k]);
+            m_chirp_filter_spectrum[m_padded_size - k] = std::conj(m_chirp[k]);
+        }
+        radix2(m_chirp_filter_spectrum.data());
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    // Size of the scratch buffer expected by forward() and backward().
+    std::size_t buffer_size() const
+    {
+        return 2 * m_padded_size;
+    }
+
+    // X_k = sum_j x_j exp(-2 i pi j k / n) on the values data[0], data[stride], ...
+    void forward(
+            std::complex<double>* data,
+            std::size_t stride,
+            std::vector<std::complex<double>>& buffer) const
+    {
+        transform(data, stride, buffer, false);
+    }
+
+    // x_j = sum_k X_k exp(2 i pi j k / n), without the 1/n normalization.
+    void backward(
+            std::complex<double>* data,
+            std::size_t stride,
+            std::vector<std::complex<double>>& buffer) const
+    {
+        transform(data, stride, buffer, true);
+    }
+
+private:
+    void transform(
+            std::complex<double>* data,
+            std::size_t stride,
+            std::vector<std::complex<double>>& buffer,
+            bool backward) const
+    {
+        if (m_size <= 1) {
+            return;
+        }
+        buffer.resize(buffer_size());
+        std::complex<double>* const line = buffer.data();
+        std::complex<double>* const work = buffer.data() + m_padded_size;
+        for (std::size_t i = 0; i < m_size; ++i) {
+            line[i] = backward ? std::conj(data[i * stride]) : data[i * stride];
+        }
+        forward_contiguous(line, work);
+        for (std::size_t i = 0; i < m_size; ++i) {
+            data[i * stride] = backward ? std::conj(line[i]) : line[i];
+        }
+    }
+};
+
+} // namespace misc
+
+} // namespace sil
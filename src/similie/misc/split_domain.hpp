@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+
+#include <ddc/ddc.hpp>
+
+namespace sil {
+
+namespace misc {
+
+namespace detail {
+
+template <class HaloSeq, class BatchDomain>
+struct SplitDomain;
+
+template <class HaloSeq, class... DDim>
+struct SplitDomain<HaloSeq, ddc::DiscreteDomain<DDim...>>
+{
+    using domain_type = ddc::DiscreteDomain<DDim...>;
+
+    /*
+     * Largest sub-domain of the batch domain along DDim1 whose points have all their neighbours
+     * in the support domain. Neighbours are at distance 1 along the halo dimensions and at
+     * distance 0 along the other dimensions of the support domain.
+     */
+    template <class DDim1, class SupportDomain>
+    static std::optional<ddc::DiscreteDomain<DDim1>> interior_1d(
+            domain_type const& batch_domain,
+            SupportDomain const& support_domain)
+    {
+        ddc::DiscreteDomain<DDim1> const batch_1d = ddc::select<DDim1>(batch_domain);
+        if constexpr (!ddc::type_seq_contains_v<
+                              ddc::detail::TypeSeq<DDim1>,
+                              ddc::to_type_seq_t<SupportDomain>>) {
+            return batch_1d;
+        } else {
+            constexpr std::ptrdiff_t halo
+                    = ddc::type_seq_contains_v<ddc::detail::TypeSeq<DDim1>, HaloSeq> ? 1 : 0;
+            ddc::DiscreteDomain<DDim1> const support_1d = ddc::select<DDim1>(support_domain);
+            std::ptrdiff_t const front = std::
+                    max(static_cast<std::ptrdiff_t>(batch_1d.front().uid()),
+                        static_cast<std::ptrdiff_t>(support_1d.front().uid()) + halo);
+            std::ptrdiff_t const back = std::
+                    min(static_cast<std::ptrdiff_t>(batch_1d.back().uid()),
+                        static_cast<std::ptrdiff_t>(support_1d.back().uid()) - halo);
+            if (batch_1d.empty() || support_1d.empty() || front > back) {
+                return std::nullopt;
+            }
+            return ddc::DiscreteDomain<DDim1>(
+                    ddc::DiscreteElement<DDim1>(front),
+                    ddc::DiscreteVector<DDim1>(back - front + 1));
+        }
+    }
+
+    template <class SupportDomain>
+    static std::optional<domain_type> interior(
+            domain_type const& batch_domain,
+            SupportDomain const& support_domain)
+    {
+        std::tuple<std::optional<ddc::DiscreteDomain<DDim>>...> const interiors(
+                interior_1d<DDim>(batch_domain, support_domain)...);
+        if (!(std::get<std::optional<ddc::DiscreteDomain<DDim>>>(interiors).has_value() && ...)) {
+            return std::nullopt;
+        }
+        return domain_type(*std::get<std::optional<ddc::DiscreteDomain<DDim>>>(interiors)...);
+    }
+
+    /*
+     * Along the shell dimension, the shell is the slab lying before (or after) the interior.
+     * Dimensions before it are restricted to the interior and dimensions after it span the whole
+     * batch domain, so that the shells are pairwise disjoint.
+     */
+    template <class DDim1>
+    static ddc::DiscreteDomain<DDim1> shell_1d(
+            domain_type const& batch_domain,
+            domain_type const& interior_domain,
+            std::size_t shell_dim,
+            bool upper)
+    {
+        constexpr std::size_t dim = ddc::type_seq_rank_v<DDim1, ddc::detail::TypeSeq<DDim...>>;
+        ddc::DiscreteDomain<DDim1> const batch_1d = ddc::select<DDim1>(batch_domain);
+        ddc::DiscreteDomain<DDim1> const interior_1d = ddc::select<DDim1>(interior_domain);
+        if (dim < shell_dim) {
+            return interior_1d;
+        }
+        if (dim > shell_dim) {
+            return batch_1d;
+        }
+        if (upper) {
+            return ddc::DiscreteDomain<DDim1>(
+                    interior_1d.back() + ddc::DiscreteVector<DDim1>(1),
+                    batch_1d.back() - interior_1d.back());
+        }
+        return ddc::DiscreteDomain<DDim1>(
+                batch_1d.front(),
+                interior_1d.front() - batch_1d.front());
+    }
+
+    static std::array<domain_type, 2 * sizeof...(DDim)> boundary_shells(
+            domain_type const& batch_domain,
+            domain_type const& interior_domain)
+    {
+        std::array<domain_type, 2 * sizeof...(DDim)> shells {};
+        for (std::size_t dim = 0; dim < sizeof...(DDim); ++dim) {
+            shells[2 * dim] = domain_type(
+                    shell_1d<DDim>(batch_domain, interior_domain, dim, false)...);
+            shells[2 * dim + 1] = domain_type(
+                    shell_1d<DDim>(batch_domain, interior_domain, dim, true)...);
+        }
+        return shells;
+    }
+};
+
+} // namespace detail
+
+/*
+ * Points of batch_domain whose direct neighbours (at distance 1 along every dimension of HaloSeq)
+ * all belong to support_domain. Returns std::nullopt if there is no such point.
+ */
+template <class HaloSeq, class... DDim, class SupportDomain>
+std::optional<ddc::DiscreteDomain<DDim...>> interior_domain(
+        ddc::DiscreteDomain<DDim...> const& batch_domain,
+        SupportDomain const& support_domain)
+{
+    return detail::SplitDomain<HaloSeq, ddc::DiscreteDomain<DDim...>>::
+            interior(batch_domain, support_domain);
+}
+
+// Disjoint sub-domains covering batch_domain minus interior_domain (some of them may be empty).
+template <class HaloSeq, class... DDim>
+auto boundary_shells(
+        ddc::DiscreteDomain<DDim...> const& batch_domain,
+        ddc::DiscreteDomain<DDim...> const& interior_domain)
+{
+    return detail::SplitDomain<HaloSeq, ddc::DiscreteDomain<DDim...>>::
+            boundary_shells(batch_domain, interior_domain);
+}
+
+} // namespace misc
+
+} // namespace sil
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+namespace sil {
+
+namespace misc {
+
+// Element at position index of the domain, traversed with the last dimension running fastest.
+template <class... DDim>
+KOKKOS_FUNCTION ddc::DiscreteElement<DDim...> linear_index_to_element(
+        ddc::DiscreteDomain<DDim...> const& domain,
+        std::size_t index)
+{
+    std::array<std::size_t, sizeof...(DDim)> const extents {
+            static_cast<std::size_t>(ddc::select<DDim>(domain).size())...};
+    std::array<std::size_t, sizeof...(DDim)> offsets {};
+    for (std::size_t dim = sizeof...(DDim); dim-- > 0;) {
+        offsets[dim] = index % extents[dim];
+        index /= extents[dim];
+    }
+    return ddc::DiscreteElement<DDim...>(ddc::DiscreteElement<DDim>(
+            domain.front().template uid<DDim>()
+            + offsets[ddc::type_seq_rank_v<DDim, ddc::detail::TypeSeq<DDim...>>])...);
+}
+
+template <class HaloSeq, class Domain>
+class TiledDomain;
+
+/*
+ * Partition of a domain into rectangular tiles. Along the dimensions of HaloSeq, a tile can be
+ * extended by one point towards the front (resp. the back) of the domain to hold the halo read by
+ * a backward (resp. forward) stencil. Only the tiles touching the domain boundary are truncated.
+ */
+template <class HaloSeq, class... DDim>
+class TiledDomain<HaloSeq, ddc::DiscreteDomain<DDim...>>
+{
+public:
+    using domain_type = ddc::DiscreteDomain<DDim...>;
+
+private:
+    static constexpr std::size_t s_rank = sizeof...(DDim);
+
+    domain_type m_domain;
+    std::array<std::size_t, s_rank> m_tile_extents;
+    std::array<std::size_t, s_rank> m_nb_tiles;
+
+    template <class DDim1>
+    static constexpr std::size_t halo_width()
+    {
+        return ddc::type_seq_contains_v<ddc::detail::TypeSeq<DDim1>, HaloSeq> ? 1 : 0;
+    }
+
+    template <class DDim1>
+    KOKKOS_FUNCTION ddc::DiscreteDomain<DDim1> tile_1d(std::size_t tile_id_1d) const
+    {
+        constexpr std::size_t dim = ddc::type_seq_rank_v<DDim1, ddc::detail::TypeSeq<DDim...>>;
+        ddc::DiscreteDomain<DDim1> const domain_1d = ddc::select<DDim1>(m_domain);
+        std::size_t const offset = tile_id_1d * m_tile_extents[dim];
+        std::size_t const extent = Kokkos::min(
+                m_tile_extents[dim],
+                static_cast<std::size_t>(domain_1d.size()) - offset);
+        return ddc::DiscreteDomain<DDim1>(
+                domain_1d.front() + ddc::DiscreteVector<DDim1>(offset),
+                ddc::DiscreteVector<DDim1>(extent));
+    }
+
+    template <class DDim1, class SupportDomain>
+    static KOKKOS_FUNCTION ddc::DiscreteDomain<DDim1> lower_halo_1d(
+            domain_type const& tile,
+            SupportDomain const& support_domain)
+    {
+        ddc::DiscreteDomain<DDim1> const tile_1d = ddc::select<DDim1>(tile);
+        std::ptrdiff_t const available = static_cast<std::ptrdiff_t>(tile_1d.front().uid())
+                                         - static_cast<std::ptrdiff_t>(
+                                                 ddc::select<DDim1>(support_domain).front().uid());
+        std::size_t const halo = Kokkos::
+                min(halo_width<DDim1>(),
+                    static_cast<std::size_t>(Kokkos::max(available, std::ptrdiff_t(0))));
+        return ddc::DiscreteDomain<DDim1>(
+                tile_1d.front() - ddc::DiscreteVector<DDim1>(halo),
+                ddc::DiscreteVector<DDim1>(tile_1d.size() + halo));
+    }
+
+    template <class DDim1, class SupportDomain>
+    static KOKKOS_FUNCTION ddc::DiscreteDomain<DDim1> upper_halo_1d(
+            domain_type const& tile,
+            SupportDomain const& support_domain)
+    {
+        ddc::DiscreteDomain<DDim1> const tile_1d = ddc::select<DDim1>(tile);
+        std::ptrdiff_t const available
+                = static_cast<std::ptrdiff_t>(ddc::select<DDim1>(support_domain).back().uid())
+                  - static_cast<std::ptrdiff_t>(tile_1d.back().uid());
+        std::size_t const halo = Kokkos::
+                min(halo_width<DDim1>(),
+                    static_cast<std::size_t>(Kokkos::max(available, std::ptrdiff_t(0))));
+        return ddc::DiscreteDomain<DDim1>(
+                tile_1d.front(),
+                ddc::DiscreteVector<DDim1>(tile_1d.size() + halo));
+    }
+
+public:
+    TiledDomain(domain_type const& domain, std::array<std::size_t, s_rank> const& tile_extents)
+        : m_domain(domain)
+        , m_tile_extents {}
+        , m_nb_tiles {}
+    {
+        std::array<std::size_t, s_rank> const extents {
+                static_cast<std::size_t>(ddc::select<DDim>(domain).size())...};
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            m_tile_extents[dim] = std::max<std::size_t>(
+                    1,
+                    std::min(tile_extents[dim], std::max<std::size_t>(1, extents[dim])));
+            m_nb_tiles[dim] = (extents[dim] + m_tile_extents[dim] - 1) / m_tile_extents[dim];
+        }
+    }
+
+    /*
+     * Tiles of about max_tile_size points, cubic along the dimensions of HaloSeq and flat along the
+     * other ones.
+     */
+    TiledDomain(domain_type const& domain, std::size_t max_tile_size)
+        : TiledDomain(domain, default_tile_extents(max_tile_size))
+    {
+    }
+
+    static std::array<std::size_t, s_rank> default_tile_extents(std::size_t max_tile_size)
+    {
+        constexpr std::size_t nb_halo_dims = (halo_width<DDim>() + ... + 0);
+        std::size_t const halo_dim_extent
+                = nb_halo_dims == 0 ? 1
+                                    : std::max<std::size_t>(
+                                              1,
+                                              static_cast<std::size_t>(std::pow(
+                                                      static_cast<double>(max_tile_size),
+                                                      1. / static_cast<double>(nb_halo_dims))));
+        return {(halo_width<DDim>() == 1 ? halo_dim_extent : std::size_t(1))...};
+    }
+
+    KOKKOS_FUNCTION std::size_t size() const
+    {
+        std::size_t nb_tiles = 1;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            nb_tiles *= m_nb_tiles[dim];
+        }
+        return nb_tiles;
+    }
+
+    // Upper bound of the number of points in a tile extended by its lower or upper halo.
+    std::size_t max_halo_size() const
+    {
+        std::array<std::size_t, s_rank> const halo_widths {halo_width<DDim>()...};
+        std::size_t halo_size = 1;
+        for (std::size_t dim = 0; dim < s_rank; ++dim) {
+            halo_size *= m_tile_extents[dim] + halo_widths[dim];
+        }
+        return halo_size;
+    }
+
+    KOKKOS_FUNCTION domain_type tile(std::size_t tile_id) const
+    {
+        std::array<std::size_t, s_rank> tile_ids {};
+        for (std::size_t dim = s_rank; dim-- > 0;) {
+            tile_ids[dim] = tile_id % m_nb_tiles[dim];
+            tile_id /= m_nb_tiles[dim];
+        }
+        return domain_type(tile_1d<DDim>(
+                tile_ids[ddc::type_seq_rank_v<DDim, ddc::detail::TypeSeq<DDim...>>])...);
+    }
+
+    /*
+     * The tile extended by one point towards the front along the HaloSeq dimensions, without
+     * leaving support_domain (which must contain the tiled domain).
+     */
+    template <class SupportDomain>
+    KOKKOS_FUNCTION domain_type
+    lower_halo(domain_type const& tile, SupportDomain const& support_domain) const
+    {
+        return domain_type(lower_halo_1d<DDim>(tile, support_domain)...);
+    }
+
+    // The tile extended by one point towards the back along the HaloSeq dimensions.
+    template <class SupportDomain>
+    KOKKOS_FUNCTION domain_type
+    upper_halo(domain_type const& tile, SupportDomain const& support_domain) const
+    {
+        return domain_type(upper_halo_1d<DDim>(tile, support_domain)...);
+    }
+};
+
+} // namespace misc
+
+} // namespace sil
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "macros.hpp"
+
+namespace sil {
+
+namespace misc {
+
+/*
+ * Tile shapes of multidimensional loops, keyed by kernel label, backend and domain extents, and
+ * persisted in a text file with one "key tile_0 tile_1 ..." line per loop. A zero tile extent
+ * means the Kokkos default.
+ */
+class MDRangeTuningCache
+{
+    std::string m_path;
+    std::map<std::string, std::vector<std::int64_t>> m_tiles;
+    std::mutex m_mutex;
+
+public:
+    explicit MDRangeTuningCache(std::string path) : m_path(std::move(path))
+    {
+        std::ifstream file(m_path);
+        std::string line;
+        while (std::getline(file, line)) {
+            std::istringstream stream(line);
+            std::string key;
+            stream >> key;
+            std::vector<std::int64_t> tile;
+            std::int64_t extent = 0;
+            while (stream >> extent) {
+                tile.push_back(extent);
+            }
+            if (!key.empty()) {
+                m_tiles[key] = tile;
+            }
+        }
+    }
+
+    /*
+     * Cache shared by the whole process, stored in the file named by the
+     * SIMILIE_MDRANGE_TUNING_FILE environment variable. Tuning is disabled if it is not set.
+     */
+    static MDRangeTuningCache& global()
+    {
+        static MDRangeTuningCache cache([] {
+            char const* const path = std::getenv("SIMILIE_MDRANGE_TUNING_FILE");
+            return std::string(path == nullptr ? "" : path);
+        }());
+        return cache;
+    }
+
+    bool enabled() const
+    {
+        return !m_path.empty();
+    }
+
+    template <std::size_t Rank>
+    std::optional<std::array<std::int64_t, Rank>> find(std::string const& key)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const it = m_tiles.find(key);
+        if (it == m_tiles.end() || it->second.size() != Rank) {
+            return std::nullopt;
+        }
+        std::array<std::int64_t, Rank> tile {};
+        std::copy(it->second.begin(), it->second.end(), tile.begin());
+        return tile;
+    }
+
+    template <std::size_t Rank>
+    void insert(std::string const& key, std::array<std::int64_t, Rank> const& tile)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_tiles[key] = std::vector<std::int64_t>(tile.begin(), tile.end());
+        std::ofstream file(m_path, std::ios::app);
+        file << key;
+        for (std::int64_t const extent : tile) {
+            file << ' ' << extent;
+        }
+        file << '\n';
+    }
+};
+
+namespace detail {
+
+// Loops smaller than this are not worth a benchmark and keep the default tiling.
+inline constexpr std::size_t mdrange_tuning_min_size = 4096;
+
+template <class Functor, class... DDim>
+class MDRangeElementFunctor
+{
+    Functor m_functor;
+    ddc::DiscreteElement<DDim...> m_front;
+
+public:
+    MDRangeElementFunctor(Functor const& functor, ddc::DiscreteElement<DDim...> front)
+        : m_functor(functor)
+        , m_front(front)
+    {
+    }
+
+    template <class... Index>
+        requires(sizeof...(Index) == sizeof...(DDim))
+    KOKKOS_FUNCTION void operator()(Index... ids) const
+    {
+        m_functor(ddc::DiscreteElement<DDim...>(ddc::DiscreteElement<DDim>(
+                m_front.template uid<DDim>() + static_cast<std::size_t>(ids))...));
+    }
+};
+
+template <class ExecSpace, class... DDim, class Functor>
+void mdrange_for_each(
+        std::string const& label,
+        ExecSpace const& exec_space,
+        ddc::DiscreteDomain<DDim...> const& domain,
+        std::array<std::int64_t, sizeof...(DDim)> const& tile,
+        Functor const& functor)
+{
+    constexpr std::size_t rank = sizeof...(DDim);
+    Kokkos::Array<std::int64_t, rank> begin {};
+    Kokkos::Array<std::int64_t, rank> const end {
+            static_cast<std::int64_t>(ddc::select<DDim>(domain).size())...};
+    Kokkos::Array<std::int64_t, rank> tile_extents {};
+    for (std::size_t dim = 0; dim < rank; ++dim) {
+        tile_extents[dim] = tile[dim];
+    }
+    Kokkos::parallel_for(
+            label,
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<rank>,
+                    Kokkos::IndexType<std::int64_t>>(exec_space, begin, end, tile_extents),
+            MDRangeElementFunctor<Functor, DDim...>(functor, domain.front()));
+}
+
+/*
+ * Candidate tiles: the Kokkos default, then 64- and 256-point tiles spread over the two innermost
+ * dimensions of either iteration order.
+ */
+template <std::size_t Rank>
+std::vector<std::array<std::int64_t, Rank>> mdrange_tile_candidates(
+        std::array<std::int64_t, Rank> const& extents)
+{
+    std::vector<std::array<std::int64_t, Rank>> candidates {std::array<std::int64_t, Rank> {}};
+    for (std::int64_t const tile_size : {64, 256}) {
+        for (std::int64_t inner = 4; inner <= tile_size; inner *= 4) {
+            for (std::array<std::size_t, 2> const dims :
+                 {std::array<std::size_t, 2> {Rank - 1, Rank - 2},
+                  std::array<std::size_t, 2> {0, 1}}) {
+                std::array<std::int64_t, Rank> tile;
+                tile.fill(1);
+                tile[dims[0]] = std::min(inner, extents[dims[0]]);
+                tile[dims[1]] = std::min(tile_size / inner, extents[dims[1]]);
+                if (std::find(candidates.begin(), candidates.end(), tile) == candidates.end()) {
+                    candidates.push_back(tile);
+                }
+            }
+        }
+    }
+    return candidates;
+}
+
+} // namespace detail
+
+/*
+ * ddc::parallel_for_each whose multidimensional tiling is tuned on the first launch of every
+ * (label, backend, extents) triplet: each candidate tile is benchmarked on the functor and the
+ * fastest one is stored in the cache, then reused. The functor must therefore be idempotent.
+ */
+template <class ExecSpace, class... DDim, class Functor>
+void tuned_parallel_for_each(
+        MDRangeTuningCache& cache,
+        std::string const& label,
+        ExecSpace const& exec_space,
+        ddc::DiscreteDomain<DDim...> const& domain,
+        Functor const& functor)
+{
+    constexpr std::size_t rank = sizeof...(DDim);
+    if constexpr (rank < 2 || rank > 6) {
+        ddc::parallel_for_each(label, exec_space, domain, functor);
+    } else {
+        if (!cache.enabled() || domain.size() < detail::mdrange_tuning_min_size) {
+            ddc::parallel_for_each(label, exec_space, domain, functor);
+            return;
+        }
+        std::array<std::int64_t, rank> const extents {
+                static_cast<std::int64_t>(ddc::select<DDim>(domain).size())...};
+        std::string key = label + '|' + ExecSpace::name() + '|';
+        for (std::size_t dim = 0; dim < rank; ++dim) {
+            key += (dim == 0 ? "" : "x") + std::to_string(extents[dim]);
+        }
+
+        if (std::optional<std::array<std::int64_t, rank>> const tile
+            = cache.template find<rank>(key)) {
+            detail::mdrange_for_each(label, exec_space, domain, *tile, functor);
+            return;
+        }
+
+        SIMILIE_DEBUG_LOG(label + "_tuning");
+        std::array<std::int64_t, rank> best_tile {};
+        double best_time = std::numeric_limits<double>::max();
+        for (std::array<std::int64_t, rank> const& tile :
+             detail::mdrange_tile_candidates(extents)) {
+            exec_space.fence();
+            Kokkos::Timer timer;
+            detail::mdrange_for_each(label, exec_space, domain, tile, functor);
+            exec_space.fence();
+            double const time = timer.seconds();
+            if (time < best_time) {
+                best_time = time;
+                best_tile = tile;
+            }
+        }
+        cache.insert(key, best_tile);
+    }
+}
+
+template <class ExecSpace, class... DDim, class Functor>
+void tuned_parallel_for_each(
+        std::string const& label,
+        ExecSpace const& exec_space,
+        ddc::DiscreteDomain<DDim...> const& domain,
+        Functor const& functor)
+{
+    tuned_parallel_for_each(MDRangeTuningCache::global(), label, exec_space, domain, functor);
+}
+
+} // namespace misc
+
+} // namespace sil
@@ -12,7 +12,9 @@ namespace sil {
 #include <similie/physics/hamilton_equations.hpp>
 #include <similie/physics/magnetostatics/magnetostatics_quantities.hpp>
 #include <similie/physics/scalar_field/scalar_field_with_power_coupling.hpp>
+#include <similie/solvers/hodge_laplacian_model.hpp>
 #include <similie/solvers/minimize_strong_formulation_residual.hpp>
+#include <similie/solvers/solution_extrapolation.hpp>
 
 #include "csr/csr.hpp"
 #include "exterior/exterior.hpp"
@@ -0,0 +1,326 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+namespace similie::solvers {
+
+/*
+ * Layout of a cochain stored on the nodes of a structured grid: row = NbComponents * node +
+ * component, nodes being numbered with the first dimension running fastest. Bit d of
+ * directions[component] is set if the component lives on cells extending along dimension d (no
+ * bit for a 0-form, one bit for the edges of a 1-form, etc.), every cell being attached to its
+ * lowest node.
+ */
+template <std::size_t Rank, std::size_t NbComponents>
+struct StructuredCochainLayout
+{
+    std::array<std::size_t, Rank> extents;
+    std::array<unsigned int, NbComponents> directions;
+    // Largest node distance, along any dimension, between two rows coupled by the operator.
+    std::size_t stencil_radius = 1;
+
+    static constexpr std::size_t rank()
+    {
+        return Rank;
+    }
+
+    static constexpr std::size_t nb_components()
+    {
+        return NbComponents;
+    }
+
+    KOKKOS_FUNCTION std::size_t node_count() const
+    {
+        std::size_t count = 1;
+        for (std::size_t dim = 0; dim < Rank; ++dim) {
+            count *= extents[dim];
+        }
+        return count;
+    }
+
+    KOKKOS_FUNCTION std::size_t size() const
+    {
+        return NbComponents * node_count();
+    }
+};
+
+// Coarse node I lies on the fine node min(2I, n - 1), so that both ends of the grid are kept.
+KOKKOS_INLINE_FUNCTION std::size_t coarse_to_fine_node(
+        std::size_t coarse_node,
+        std::size_t fine_extent)
+{
+    return Kokkos::min(2 * coarse_node, fine_extent - 1);
+}
+
+KOKKOS_INLINE_FUNCTION std::size_t coarsened_extent(std::size_t fine_extent)
+{
+    return fine_extent / 2 + 1;
+}
+
+// A grid can be coarsened as long as the coarse grid keeps at least one interior node.
+template <std::size_t Rank, std::size_t NbComponents>
+bool can_coarsen(StructuredCochainLayout<Rank, NbComponents> const& layout)
+{
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+        if (layout.extents[dim] < 5) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t Rank, std::size_t NbComponents>
+StructuredCochainLayout<Rank, NbComponents> coarsen(
+        StructuredCochainLayout<Rank, NbComponents> const& layout)
+{
+    StructuredCochainLayout<Rank, NbComponents> coarse_layout = layout;
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+        coarse_layout.extents[dim] = coarsened_extent(layout.extents[dim]);
+    }
+    return coarse_layout;
+}
+
+namespace detail {
+
+/*
+ * One-dimensional factor of the prolongation weight of a coarse node (or cell) to a fine node (or
+ * cell). Nodal values are interpolated linearly, while the value of a coarse cell is split evenly
+ * between the fine cells it contains, so that the prolongation commutes with the coboundary.
+ */
+KOKKOS_INLINE_FUNCTION double prolongation_weight_1d(
+        std::size_t fine_index,
+        std::size_t coarse_index,
+        std::size_t fine_extent,
+        bool cell)
+{
+    std::size_t const coarse_extent = coarsened_extent(fine_extent);
+    if (cell) {
+        if (fine_index + 1 >= fine_extent) {
+            return 0.;
+        }
+        std::size_t const containing = Kokkos::min(fine_index / 2, coarse_extent - 2);
+        if (coarse_index != containing) {
+            return 0.;
+        }
+        return 1.
+               / static_cast<double>(
+                       coarse_to_fine_node(containing + 1, fine_extent)
+                       - coarse_to_fine_node(containing, fine_extent));
+    }
+    std::size_t const lower = Kokkos::min(fine_index / 2, coarse_extent - 1);
+    std::size_t const lower_node = coarse_to_fine_node(lower, fine_extent);
+    if (lower_node == fine_index) {
+        return coarse_index == lower ? 1. : 0.;
+    }
+    double const t = static_cast<double>(fine_index - lower_node)
+                     / static_cast<double>(
+                             coarse_to_fine_node(lower + 1, fine_extent) - lower_node);
+    if (coarse_index == lower) {
+        return 1. - t;
+    }
+    if (coarse_index == lower + 1) {
+        return t;
+    }
+    return 0.;
+}
+
+template <std::size_t Rank, std::size_t NbComponents>
+KOKKOS_FUNCTION void decode_row(
+        StructuredCochainLayout<Rank, NbComponents> const& layout,
+        std::size_t row,
+        std::array<std::size_t, Rank>& node,
+        std::size_t& component)
+{
+    component = row % NbComponents;
+    std::size_t node_index = row / NbComponents;
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+        node[dim] = node_index % layout.extents[dim];
+        node_index /= layout.extents[dim];
+    }
+}
+
+template <std::size_t Rank, std::size_t NbComponents>
+KOKKOS_FUNCTION std::size_t encode_row(
+        StructuredCochainLayout<Rank, NbComponents> const& layout,
+        std::array<std::size_t, Rank> const& node,
+        std::size_t component)
+{
+    std::size_t node_index = 0;
+    for (std::size_t dim = Rank; dim-- > 0;) {
+        node_index = node_index * layout.extents[dim] + node[dim];
+    }
+    return NbComponents * node_index + component;
+}
+
+} // namespace detail
+
+// fine += P coarse, P being the form-degree-aware prolongation of cochains.
+template <
+        class ExecSpace,
+        std::size_t Rank,
+        std::size_t NbComponents,
+        class CoarseView,
+        class FineView>
+void prolongate_and_add(
+        ExecSpace exec_space,
+        StructuredCochainLayout<Rank, NbComponents> const& fine_layout,
+        CoarseView coarse,
+        FineView fine)
+{
+    StructuredCochainLayout<Rank, NbComponents> const coarse_layout = coarsen(fine_layout);
+    Kokkos::parallel_for(
+            "similie_multigrid_prolongate",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, fine_layout.size()),
+            KOKKOS_LAMBDA(std::size_t row) {
+                std::array<std::size_t, Rank> fine_node {};
+                std::size_t component = 0;
+                detail::decode_row(fine_layout, row, fine_node, component);
+                unsigned int const directions = fine_layout.directions[component];
+                double value = 0.;
+                for (std::size_t corner = 0; corner < (std::size_t(1) << Rank); ++corner) {
+                    std::array<std::size_t, Rank> coarse_node {};
+                    double weight = 1.;
+                    for (std::size_t dim = 0; dim < Rank; ++dim) {
+                        coarse_node[dim] = fine_node[dim] / 2 + ((corner >> dim) & 1);
+                        if (coarse_node[dim] >= coarse_layout.extents[dim]) {
+                            weight = 0.;
+                            break;
+                        }
+                        weight *= detail::prolongation_weight_1d(
+                                fine_node[dim],
+                                coarse_node[dim],
+                                fine_layout.extents[dim],
+                                ((directions >> dim) & 1) != 0);
+                    }
+                    if (weight != 0.) {
+                        value += weight
+                                 * coarse(detail::encode_row(coarse_layout, coarse_node, component),
+                                          0);
+                    }
+                }
+                fine(row, 0) += value;
+            });
+    exec_space.fence();
+}
+
+// coarse = P^T fine, which transfers residuals (dual cochains) to the coarse grid.
+template <
+        class ExecSpace,
+        std::size_t Rank,
+        std::size_t NbComponents,
+        class FineView,
+        class CoarseView>
+void restrict_to_coarse(
+        ExecSpace exec_space,
+        StructuredCochainLayout<Rank, NbComponents> const& fine_layout,
+        FineView fine,
+        CoarseView coarse)
+{
+    StructuredCochainLayout<Rank, NbComponents> const coarse_layout = coarsen(fine_layout);
+    std::size_t nb_neighbours = 1;
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+        nb_neighbours *= 3;
+    }
+    Kokkos::parallel_for(
+            "similie_multigrid_restrict",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, coarse_layout.size()),
+            KOKKOS_LAMBDA(std::size_t row) {
+                std::array<std::size_t, Rank> coarse_node {};
+                std::size_t component = 0;
+                detail::decode_row(coarse_layout, row, coarse_node, component);
+                unsigned int const directions = fine_layout.directions[component];
+                double value = 0.;
+                for (std::size_t neighbour = 0; neighbour < nb_neighbours; ++neighbour) {
+                    std::array<std::size_t, Rank> fine_node {};
+                    double weight = 1.;
+                    std::size_t offsets = neighbour;
+                    for (std::size_t dim = 0; dim < Rank; ++dim) {
+                        std::size_t const center
+                                = coarse_to_fine_node(coarse_node[dim], fine_layout.extents[dim]);
+                        std::size_t const offset = offsets % 3;
+                        offsets /= 3;
+                        if (center + offset < 1 || center + offset > fine_layout.extents[dim]) {
+                            weight = 0.;
+                            break;
+                        }
+                        fine_node[dim] = center + offset - 1;
+                        weight *= detail::prolongation_weight_1d(
+                                fine_node[dim],
+                                coarse_node[dim],
+                                fine_layout.extents[dim],
+                                ((directions >> dim) & 1) != 0);
+                        if (weight == 0.) {
+                            break;
+                        }
+                    }
+                    if (weight != 0.) {
+                        value += weight
+                                 * fine(detail::encode_row(fine_layout, fine_node, component), 0);
+                    }
+                }
+                coarse(row, 0) = value;
+            });
+    exec_space.fence();
+}
+
+/*
+ * Extracts the diagonal of a matrix-free operator with (stencil_radius + 1)^Rank * NbComponents
+ * applications: rows probed together are never coupled by the operator.
+ */
+template <
+        class ExecSpace,
+        std::size_t Rank,
+        std::size_t NbComponents,
+        class ApplyOperator,
+        class WorkView,
+        class DiagonalView>
+void probe_diagonal(
+        ExecSpace exec_space,
+        StructuredCochainLayout<Rank, NbComponents> const& layout,
+        ApplyOperator&& apply_operator,
+        WorkView probe,
+        WorkView applied,
+        DiagonalView diagonal)
+{
+    std::size_t const period = layout.stencil_radius + 1;
+    std::size_t nb_node_colors = 1;
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+        nb_node_colors *= period;
+    }
+    for (std::size_t color = 0; color < nb_node_colors * NbComponents; ++color) {
+        auto const is_probed = KOKKOS_LAMBDA(std::size_t row)
+        {
+            std::array<std::size_t, Rank> node {};
+            std::size_t component = 0;
+            detail::decode_row(layout, row, node, component);
+            std::size_t row_color = 0;
+            for (std::size_t dim = Rank; dim-- > 0;) {
+                row_color = row_color * period + node[dim] % period;
+            }
+            return row_color * NbComponents + component == color;
+        };
+        Kokkos::parallel_for(
+                "similie_multigrid_fill_diagonal_probe",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, layout.size()),
+                KOKKOS_LAMBDA(std::size_t row) { probe(row, 0) = is_probed(row) ? 1. : 0.; });
+        exec_space.fence();
+        apply_operator(probe, applied);
+        Kokkos::parallel_for(
+                "similie_multigrid_gather_diagonal_probe",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, layout.size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    if (is_probed(row)) {
+                        diagonal(row) = applied(row, 0);
+                    }
+                });
+        exec_space.fence();
+    }
+}
+
+} // namespace similie::solvers
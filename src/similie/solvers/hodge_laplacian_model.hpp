@@ -0,0 +1,385 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <similie/exterior/fourier_laplacian.hpp>
+#include <similie/exterior/laplacian.hpp>
+#include <similie/exterior/sparse_assembly.hpp>
+#include <similie/misc/specialization.hpp>
+#include <similie/misc/tiled_domain.hpp>
+#include <similie/tensor/tensor_impl.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "minimize_strong_formulation_residual.hpp"
+
+namespace similie::solvers {
+
+enum class HodgeLaplacianBoundary {
+    // The operator is used as is, with the one-sided stencils of StagedLaplacian on the boundary.
+    Natural,
+    // Every component of the cochain is prescribed on the points of the domain boundary.
+    Dirichlet
+};
+
+namespace detail {
+
+template <class... DDim, class Elem>
+KOKKOS_FUNCTION bool on_domain_boundary(ddc::DiscreteDomain<DDim...> const& domain, Elem elem)
+{
+    return ((elem.template uid<DDim>() == domain.front().template uid<DDim>()
+             || elem.template uid<DDim>() == domain.back().template uid<DDim>())
+            || ...);
+}
+
+/*
+ * Classifies the rows (flat indices in the layout_right representation of a cochain) prescribed by
+ * Dirichlet boundary conditions. Trivially copyable, so it can be captured by device kernels.
+ */
+template <class Domain, class BatchDomain>
+struct DirichletRows
+{
+    Domain domain;
+    bool enabled;
+
+    KOKKOS_FUNCTION bool operator()(std::size_t row) const
+    {
+        return enabled
+               && on_domain_boundary(
+                       BatchDomain(domain),
+                       sil::misc::linear_index_to_element(domain, row));
+    }
+};
+
+} // namespace detail
+
+/*
+ * Linear operator model (see minimize_strong_formulation_residual) of the Hodge-Laplacian of
+ * k-forms, wrapping a StagedLaplacian. Cochains are exchanged with the solver as (size, 1) views
+ * of the layout_right representation of TensorType. The Hodge stars and the cochain workspaces are
+ * allocated once and shared by the copies of the model, so applications allocate nothing.
+ *
+ * With Dirichlet boundary conditions, boundary rows are the identity and interior rows ignore the
+ * boundary values, which are moved to the right-hand side by lift_dirichlet.
+ *
+ * On a uniform mesh with a constant metric, apply_fourier_preconditioner provides the Fourier
+ * preconditioner (PreconditionerType::Fourier).
+ *
+ * The kernels of the model run on the execution space it is built with, to which the
+ * StagedLaplacian and the Fourier solver are bound, and are fenced before returning.
+ */
+template <
+        sil::tensor::TensorIndex MetricIndex,
+        sil::tensor::TensorNatIndex LaplacianDummyIndex,
+        sil::tensor::TensorIndex CochainTag,
+        sil::misc::Specialization<sil::tensor::Tensor> TensorType,
+        sil::misc::Specialization<sil::tensor::Tensor> MetricType,
+        sil::misc::Specialization<sil::tensor::Tensor> PositionType,
+        class ExecSpace>
+class HodgeLaplacianModel
+{
+public:
+    static constexpr bool IS_LINEAR = true;
+
+    using memory_space = typename TensorType::memory_space;
+    using laplacian_type = sil::exterior::StagedLaplacian<
+            MetricIndex,
+            LaplacianDummyIndex,
+            CochainTag,
+            TensorType,
+            MetricType,
+            PositionType,
+            ExecSpace>;
+    using fourier_solver_type = sil::exterior::FourierLaplacianSolver<
+            MetricIndex,
+            LaplacianDummyIndex,
+            CochainTag,
+            TensorType,
+            MetricType,
+            PositionType,
+            ExecSpace>;
+
+private:
+    using domain_type = typename TensorType::discrete_domain_type;
+    using batch_domain_type = typename TensorType::non_indices_domain_t;
+    using alloc_type = ddc::Chunk<double, domain_type, ddc::KokkosAllocator<double, memory_space>>;
+    using flat_view_type = Kokkos::View<double*, memory_space, Kokkos::MemoryUnmanaged>;
+    using dirichlet_rows_type = detail::DirichletRows<domain_type, batch_domain_type>;
+
+    struct Workspace
+    {
+        alloc_type input_alloc;
+        alloc_type output_alloc;
+        TensorType input;
+        TensorType output;
+        MetricType metric;
+        PositionType position;
+        laplacian_type laplacian;
+        // Built by the first call to apply_fourier_preconditioner.
+        std::unique_ptr<fourier_solver_type> fourier_solver;
+
+        Workspace(
+                ExecSpace const& exec_space,
+                domain_type const& domain,
+                MetricType metric,
+                PositionType position,
+                sil::exterior::LaplacianMode mode)
+            : input_alloc(domain, ddc::KokkosAllocator<double, memory_space>())
+            , output_alloc(domain, ddc::KokkosAllocator<double, memory_space>())
+            , input(input_alloc)
+            , output(output_alloc)
+            , metric(metric)
+            , position(position)
+            , laplacian(exec_space, output, input, metric, position, mode)
+        {
+        }
+    };
+
+    ExecSpace m_exec_space;
+    domain_type m_domain;
+    HodgeLaplacianBoundary m_boundary;
+    std::shared_ptr<Workspace> m_workspace;
+
+    static flat_view_type flatten(TensorType tensor)
+    {
+        return flat_view_type(tensor.data_handle(), tensor.domain().size());
+    }
+
+    /*
+     * output = L input, L being the raw Hodge-Laplacian applied to the Dirichlet rows of input only
+     * (if from_dirichlet_rows) or to the other ones only.
+     */
+    template <class InputView, class OutputView>
+    void apply_laplacian(InputView input, OutputView output, bool from_dirichlet_rows) const
+    {
+        flat_view_type const input_workspace = flatten(m_workspace->input);
+        flat_view_type const output_workspace = flatten(m_workspace->output);
+        dirichlet_rows_type const dirichlet_rows = this->dirichlet_rows();
+        Kokkos::parallel_for(
+                "similie_hodge_laplacian_model_load",
+                Kokkos::RangePolicy<ExecSpace>(m_exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    input_workspace(row)
+                            = dirichlet_rows(row) == from_dirichlet_rows ? input(row, 0) : 0.;
+                });
+        m_workspace->laplacian.run(m_workspace->output, m_workspace->input);
+        Kokkos::parallel_for(
+                "similie_hodge_laplacian_model_store",
+                Kokkos::RangePolicy<ExecSpace>(m_exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t row) { output(row, 0) = output_workspace(row); });
+    }
+
+public:
+    HodgeLaplacianModel(
+            ExecSpace const& exec_space,
+            TensorType tensor,
+            MetricType metric,
+            PositionType position,
+            HodgeLaplacianBoundary boundary = HodgeLaplacianBoundary::Dirichlet,
+            sil::exterior::LaplacianMode mode = sil::exterior::LaplacianMode::Staged)
+        : m_exec_space(exec_space)
+        , m_domain(tensor.domain())
+        , m_boundary(boundary)
+        , m_workspace(std::make_shared<
+                      Workspace>(exec_space, tensor.domain(), metric, position, mode))
+    {
+    }
+
+    ExecSpace execution_space() const
+    {
+        return m_exec_space;
+    }
+
+    domain_type domain() const
+    {
+        return m_domain;
+    }
+
+    std::size_t size() const
+    {
+        return m_domain.size();
+    }
+
+    dirichlet_rows_type dirichlet_rows() const
+    {
+        return {m_domain, m_boundary == HodgeLaplacianBoundary::Dirichlet};
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace, InputView input, OutputView output) const
+    {
+        apply_laplacian(input, output, false);
+        if (m_boundary == HodgeLaplacianBoundary::Dirichlet) {
+            dirichlet_rows_type const dirichlet_rows = this->dirichlet_rows();
+            Kokkos::parallel_for(
+                    "similie_hodge_laplacian_model_dirichlet_rows",
+                    Kokkos::RangePolicy<ExecSpace>(m_exec_space, 0, size()),
+                    KOKKOS_LAMBDA(std::size_t row) {
+                        if (dirichlet_rows(row)) {
+                            output(row, 0) = input(row, 0);
+                        }
+                    });
+        }
+        m_exec_space.fence();
+    }
+
+    /*
+     * Moves the boundary values held by the Dirichlet rows of rhs to its interior rows:
+     * rhs_interior -= L_interior,boundary rhs_boundary.
+     */
+    template <class RHSView>
+    void lift_dirichlet(ExecSpace exec_space, RHSView rhs) const
+    {
+        if (m_boundary != HodgeLaplacianBoundary::Dirichlet) {
+            return;
+        }
+        dirichlet_rows_type const dirichlet_rows = this->dirichlet_rows();
+        Kokkos::View<double**, Kokkos::LayoutRight, memory_space>
+                lifted("similie_hodge_laplacian_model_lifted", size(), 1);
+        // rhs may still be written by kernels of the caller on exec_space.
+        exec_space.fence();
+        apply_laplacian(rhs, lifted, true);
+        Kokkos::parallel_for(
+                "similie_hodge_laplacian_model_lift_dirichlet",
+                Kokkos::RangePolicy<ExecSpace>(m_exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    if (!dirichlet_rows(row)) {
+                        rhs(row, 0) -= lifted(row, 0);
+                    }
+                });
+        m_exec_space.fence();
+    }
+
+    /*
+     * output = P input, P approximating the inverse of the operator: the interior rows are solved
+     * by the FFT-based inverse of the Hodge-Laplacian made periodic over the mesh (see
+     * sil::exterior::FourierLaplacianSolver), the Dirichlet rows are copied. The mesh must be
+     * uniform with a constant metric, and have at least 5 points along every dimension.
+     */
+    template <class InputView, class OutputView>
+    void apply_fourier_preconditioner(ExecSpace, InputView input, OutputView output) const
+    {
+        if (!m_workspace->fourier_solver) {
+            m_workspace->fourier_solver = std::make_unique<fourier_solver_type>(
+                    m_exec_space,
+                    m_workspace->input,
+                    m_workspace->metric,
+                    m_workspace->position);
+        }
+        flat_view_type const input_workspace = flatten(m_workspace->input);
+        flat_view_type const output_workspace = flatten(m_workspace->output);
+        dirichlet_rows_type const dirichlet_rows = this->dirichlet_rows();
+        Kokkos::parallel_for(
+                "similie_hodge_laplacian_model_fourier_load",
+                Kokkos::RangePolicy<ExecSpace>(m_exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    input_workspace(row) = dirichlet_rows(row) ? 0. : input(row, 0);
+                });
+        m_exec_space.fence();
+        m_workspace->fourier_solver->solve(m_workspace->output, m_workspace->input);
+        Kokkos::parallel_for(
+                "similie_hodge_laplacian_model_fourier_store",
+                Kokkos::RangePolicy<ExecSpace>(m_exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    output(row, 0) = dirichlet_rows(row) ? input(row, 0) : output_workspace(row);
+                });
+        m_exec_space.fence();
+    }
+
+    // Assembled on the device by probing apply (see sil::exterior::assemble_sparse_operator).
+    sil::exterior::SparseOperator<memory_space> assemble_sparse_operator() const
+    {
+        using probe_view_type = Kokkos::
+                View<double**, Kokkos::LayoutRight, memory_space, Kokkos::MemoryUnmanaged>;
+        return sil::exterior::assemble_sparse_operator<ddc::to_type_seq_t<batch_domain_type>>(
+                m_exec_space,
+                m_domain,
+                m_domain,
+                [&](auto probe, auto applied) {
+                    apply(m_exec_space,
+                          probe_view_type(probe.data_handle(), size(), 1),
+                          probe_view_type(applied.data_handle(), size(), 1));
+                });
+    }
+};
+
+template <
+        sil::tensor::TensorIndex MetricIndex,
+        sil::tensor::TensorNatIndex LaplacianDummyIndex,
+        sil::tensor::TensorIndex CochainTag,
+        class ExecSpace,
+        sil::misc::Specialization<sil::tensor::Tensor> TensorType,
+        sil::misc::Specialization<sil::tensor::Tensor> MetricType,
+        sil::misc::Specialization<sil::tensor::Tensor> PositionType>
+HodgeLaplacianModel<
+        MetricIndex,
+        LaplacianDummyIndex,
+        CochainTag,
+        TensorType,
+        MetricType,
+        PositionType,
+        ExecSpace>
+make_hodge_laplacian_model(
+        ExecSpace const& exec_space,
+        TensorType tensor,
+        MetricType metric,
+        PositionType position,
+        HodgeLaplacianBoundary boundary = HodgeLaplacianBoundary::Dirichlet,
+        sil::exterior::LaplacianMode mode = sil::exterior::LaplacianMode::Staged)
+{
+    return HodgeLaplacianModel<
+            MetricIndex,
+            LaplacianDummyIndex,
+            CochainTag,
+            TensorType,
+            MetricType,
+            PositionType,
+            ExecSpace>(exec_space, tensor, metric, position, boundary, mode);
+}
+
+/*
+ * Solves laplacian(solution) = rhs with the Krylov solvers of minimize_strong_formulation_residual
+ * (matrix-free if settings.use_matrix_free is set). With Dirichlet boundary conditions, the
+ * boundary values are read from solution. rhs is left untouched.
+ */
+template <class ExecSpace, class Model, class TensorType>
+StrongFormulationSolverDiagnostics solve_hodge_laplacian(
+        ExecSpace exec_space,
+        Model const& model,
+        TensorType solution,
+        TensorType rhs,
+        StrongFormulationSolverSettings settings = {})
+{
+    using memory_space = typename TensorType::memory_space;
+    using view_type
+            = Kokkos::View<double**, Kokkos::LayoutRight, memory_space, Kokkos::MemoryUnmanaged>;
+    view_type const solution_view(solution.data_handle(), model.size(), 1);
+    view_type const rhs_view(rhs.data_handle(), model.size(), 1);
+    Kokkos::View<double**, Kokkos::LayoutRight, memory_space>
+            system_rhs("similie_hodge_laplacian_rhs", model.size(), 1);
+    auto const dirichlet_rows = model.dirichlet_rows();
+    Kokkos::parallel_for(
+            "similie_hodge_laplacian_fill_rhs",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, model.size()),
+            KOKKOS_LAMBDA(std::size_t row) {
+                system_rhs(row, 0)
+                        = dirichlet_rows(row) ? solution_view(row, 0) : rhs_view(row, 0);
+            });
+    exec_space.fence();
+    model.lift_dirichlet(exec_space, system_rhs);
+    return minimize_strong_formulation_residual(
+            exec_space,
+            model,
+            system_rhs,
+            solution_view,
+            settings);
+}
+
+} // namespace similie::solvers
@@ -17,13 +17,18 @@
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/log/convergence.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
 #include <ginkgo/core/preconditioner/gauss_seidel.hpp>
 #include <ginkgo/core/preconditioner/isai.hpp>
 #include <ginkgo/core/preconditioner/jacobi.hpp>
@@ -37,12 +42,16 @@
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
 #include <ginkgo/core/solver/minres.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 #include <ginkgo/extensions/kokkos.hpp>
 
 #include <Kokkos_Core.hpp>
 
+#include "geometric_multigrid.hpp"
+#include "vector_operations.hpp"
+
 namespace similie::solvers {
 
 enum class Criterion {
@@ -60,6 +69,52 @@ enum class PreconditionerType {
     ChebyshevJacobi,
     IrJacobi,
     GeneralIsai,
+    Fourier,
+    GeometricMultigrid,
+    AlgebraicMultigrid,
+};
+
+enum class MultigridCycle {
+    V,
+    W,
+};
+
+// Smoother of the levels of the algebraic multigrid preconditioner.
+enum class MultigridSmoother {
+    // Damped Jacobi iterations.
+    Jacobi,
+    SymmetricGaussSeidel,
+    // Chebyshev-Jacobi iterations on the foci chebyshev_lower_bound and chebyshev_upper_bound.
+    Chebyshev,
+};
+
+// Solver of the coarsest level of the algebraic multigrid preconditioner.
+enum class MultigridCoarseSolver {
+    // Jacobi-preconditioned CG.
+    Cg,
+    // Iterations of the level smoother.
+    Smoother,
+};
+
+// Relative tolerance of the inner Krylov solves of the Newton loop.
+enum class NewtonForcing {
+    // settings.relative_tolerance at every iteration.
+    Constant,
+    // Eisenstat-Walker choice 1, from the agreement of the linear model with the residual.
+    EisenstatWalker1,
+    // Eisenstat-Walker choice 2, from the nonlinear residual reduction.
+    EisenstatWalker2,
+};
+
+// Storage of the assembled matrix in the sparse matrix-vector products of the Krylov solvers.
+enum class MatrixFormat {
+    Csr,
+    // Rows padded to the longest one, stored column by column.
+    Ell,
+    // Sliced ELL: rows padded to the longest one of their slice of 64 rows.
+    Sellp,
+    // ELL for the typical row length, CSR for the overflow of the longer rows.
+    Hybrid,
 };
 
 inline constexpr std::string_view preconditioner_name(PreconditionerType preconditioner)
@@ -81,6 +136,12 @@ inline constexpr std::string_view preconditioner_name(PreconditionerType precond
         return "IrJacobi";
     case PreconditionerType::GeneralIsai:
         return "GeneralIsai";
+    case PreconditionerType::Fourier:
+        return "Fourier";
+    case PreconditionerType::GeometricMultigrid:
+        return "GeometricMultigrid";
+    case PreconditionerType::AlgebraicMultigrid:
+        return "AlgebraicMultigrid";
     }
     return "Jacobi";
 }
@@ -113,9 +174,52 @@ inline PreconditionerType parse_preconditioner(std::string_view name)
         || name == "isai") {
         return PreconditionerType::GeneralIsai;
     }
+    if (name == "Fourier" || name == "fourier" || name == "fft") {
+        return PreconditionerType::Fourier;
+    }
+    if (name == "GeometricMultigrid" || name == "geometric-multigrid"
+        || name == "geometric_multigrid" || name == "gmg" || name == "multigrid") {
+        return PreconditionerType::GeometricMultigrid;
+    }
+    if (name == "AlgebraicMultigrid" || name == "algebraic-multigrid"
+        || name == "algebraic_multigrid" || name == "amg" || name == "pgm") {
+        return PreconditionerType::AlgebraicMultigrid;
+    }
     throw std::runtime_error("unknown strong-formulation preconditioner: " + std::string(name));
 }
 
+inline constexpr std::string_view matrix_format_name(MatrixFormat matrix_format)
+{
+    switch (matrix_format) {
+    case MatrixFormat::Csr:
+        return "Csr";
+    case MatrixFormat::Ell:
+        return "Ell";
+    case MatrixFormat::Sellp:
+        return "Sellp";
+    case MatrixFormat::Hybrid:
+        return "Hybrid";
+    }
+    return "Csr";
+}
+
+inline MatrixFormat parse_matrix_format(std::string_view name)
+{
+    if (name == "Csr" || name == "CSR" || name == "csr") {
+        return MatrixFormat::Csr;
+    }
+    if (name == "Ell" || name == "ELL" || name == "ell") {
+        return MatrixFormat::Ell;
+    }
+    if (name == "Sellp" || name == "SELLP" || name == "sellp" || name == "sell-p") {
+        return MatrixFormat::Sellp;
+    }
+    if (name == "Hybrid" || name == "hybrid") {
+        return MatrixFormat::Hybrid;
+    }
+    throw std::runtime_error("unknown strong-formulation matrix format: " + std::string(name));
+}
+
 struct StrongFormulationSolverSettings
 {
     unsigned int max_iterations = 2000U;
@@ -131,6 +235,37 @@ struct StrongFormulationSolverSettings
     double chebyshev_upper_bound = 1.5;
     unsigned int ir_iterations = 8U;
     double ir_relaxation_factor = 1.0;
+    MultigridCycle multigrid_cycle = MultigridCycle::V;
+    unsigned int multigrid_max_levels = 10U;
+    unsigned int multigrid_smoothing_steps = 2U;
+    unsigned int multigrid_coarse_iterations = 40U;
+    std::size_t multigrid_coarse_size = 1000U;
+    // Algebraic multigrid only, the geometric one smooths by Chebyshev-Jacobi iterations.
+    MultigridSmoother multigrid_smoother = MultigridSmoother::Jacobi;
+    double multigrid_relaxation_factor = 0.9;
+    MultigridCoarseSolver multigrid_coarse_solver = MultigridCoarseSolver::Cg;
+    // The Newton loop reuses its preconditioner for at most this many iterations (0 or 1 rebuilds
+    // it at every iteration), and rebuilds it earlier when the inner Krylov iterations per decade
+    // of residual reduction grow by more than the given fraction.
+    unsigned int preconditioner_reuse_iterations = 0U;
+    double preconditioner_reuse_iterations_growth = 0.5;
+    // Jacobian-free Newton-Krylov: the Newton loop approximates the Jacobian-vector products by
+    // finite differences of apply, and assembles no Jacobian.
+    bool use_jacobian_free = false;
+    // The content of solution is used as the initial guess instead of zero (see
+    // SolutionExtrapolator to predict it from previous solves).
+    bool use_initial_guess = false;
+    NewtonForcing newton_forcing = NewtonForcing::Constant;
+    double newton_forcing_initial = 0.3;
+    double newton_forcing_max = 0.9;
+    // The preconditioners are always built from the CSR matrix.
+    MatrixFormat matrix_format = MatrixFormat::Csr;
+    // Linear solves iteratively refine in double precision a CG solve whose matrix and
+    // preconditioner are stored in single precision, each inner solve reducing its residual by
+    // mixed_precision_inner_reduction. Also selected by SIMILIE_SOLVER=mixed. The iterations of
+    // the diagnostics are then the refinement steps.
+    bool use_mixed_precision = false;
+    double mixed_precision_inner_reduction = 1.0e-3;
 };
 
 struct StrongFormulationSolverDiagnostics
@@ -141,6 +276,7 @@ struct StrongFormulationSolverDiagnostics
     double final_relative_residual = 0.0;
     double duration = 0.0;
     bool converged = true;
+    unsigned int preconditioner_rebuilds = 0U;
 };
 
 namespace detail {
@@ -399,7 +535,54 @@ inline void log_nonlinear_progress(
     }
     std::cout << "SimiLie nonlinear progress: iteration=" << iteration
               << " residual_l2=" << diagnostics.final_residual_l2
-              << " relative_residual=" << diagnostics.final_relative_residual << std::endl;
+              << " relative_residual=" << diagnostics.final_relative_residual
+              << " preconditioner_rebuilds=" << diagnostics.preconditioner_rebuilds << std::endl;
+}
+
+/*
+ * Forcing term of a Newton iteration with residual norm residual_l2, following Eisenstat and
+ * Walker, "Choosing the forcing terms in an inexact Newton method" (1996), with their safeguards
+ * against a sudden decrease of the forcing term. It never goes below settings.relative_tolerance
+ * nor below what is needed to reach it on the nonlinear residual (to avoid oversolving the last
+ * iteration), and never above settings.newton_forcing_max.
+ */
+inline double newton_forcing_term(
+        StrongFormulationSolverSettings const& settings,
+        unsigned int iteration,
+        double initial_residual_l2,
+        double residual_l2,
+        double previous_residual_l2,
+        double previous_linear_residual_l2,
+        double previous_forcing)
+{
+    if (settings.newton_forcing == NewtonForcing::Constant) {
+        return settings.relative_tolerance;
+    }
+    constexpr double golden_ratio = 1.618033988749895;
+    constexpr double gamma = 0.9;
+    constexpr double safeguard_threshold = 0.1;
+    double forcing = settings.newton_forcing_initial;
+    if (iteration > 0U && previous_residual_l2 > 0.0) {
+        if (settings.newton_forcing == NewtonForcing::EisenstatWalker1) {
+            forcing = std::abs(residual_l2 - previous_linear_residual_l2) / previous_residual_l2;
+            double const safeguard = std::pow(previous_forcing, golden_ratio);
+            if (safeguard > safeguard_threshold) {
+                forcing = std::max(forcing, safeguard);
+            }
+        } else {
+            forcing = gamma * std::pow(residual_l2 / previous_residual_l2, 2.0);
+            double const safeguard = gamma * previous_forcing * previous_forcing;
+            if (safeguard > safeguard_threshold) {
+                forcing = std::max(forcing, safeguard);
+            }
+        }
+    }
+    if (residual_l2 > 0.0) {
+        forcing = std::max(
+                forcing,
+                0.5 * settings.relative_tolerance * initial_residual_l2 / residual_l2);
+    }
+    return std::min(std::max(forcing, settings.relative_tolerance), settings.newton_forcing_max);
 }
 
 template <class ExecSpace, class OperatorModel, class = void>
@@ -432,90 +615,43 @@ bool uses_precomputed_matrix_free_stencils(OperatorModel const& operator_model)
     return false;
 }
 
-template <class ExecSpace, class ViewType1, class ViewType2>
-double dot(ExecSpace exec_space, ViewType1 lhs, ViewType2 rhs)
-{
-    double result = 0.0;
-    Kokkos::parallel_reduce(
-            "similie_dot",
-            Kokkos::MDRangePolicy<
-                    ExecSpace,
-                    Kokkos::Rank<2>>(exec_space, {0, 0}, {lhs.extent(0), lhs.extent(1)}),
-            KOKKOS_LAMBDA(std::size_t row, std::size_t column, double& local_sum) {
-                local_sum += lhs(row, column) * rhs(row, column);
-            },
-            result);
-    exec_space.fence();
-    return result;
-}
-
-template <class ExecSpace, class ViewType>
-double residual_norm_l2(ExecSpace exec_space, ViewType residual)
-{
-    return std::sqrt(dot(exec_space, residual, residual));
-}
-
-template <class ExecSpace, class ViewType>
-void fill(ExecSpace exec_space, ViewType view, double value)
-{
-    Kokkos::parallel_for(
-            "similie_fill",
-            Kokkos::MDRangePolicy<
-                    ExecSpace,
-                    Kokkos::Rank<2>>(exec_space, {0, 0}, {view.extent(0), view.extent(1)}),
-            KOKKOS_LAMBDA(std::size_t row, std::size_t column) { view(row, column) = value; });
-    exec_space.fence();
-}
-
-template <class ExecSpace, class DestinationView, class SourceView>
-void copy(ExecSpace exec_space, DestinationView destination, SourceView source)
-{
-    Kokkos::parallel_for(
-            "similie_copy",
-            Kokkos::MDRangePolicy<
-                    ExecSpace,
-                    Kokkos::Rank<
-                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
-            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
-                destination(row, column) = source(row, column);
-            });
-    exec_space.fence();
-}
-
-template <class ExecSpace, class ViewType1, class ViewType2, class ViewType3>
-void update_axpby(
+/*
+ * Applies the operator model, through its matrix-free workspace when it relies on one (the
+ * workspace is then created on first use).
+ */
+template <class ExecSpace, class OperatorModel, class InputView, class OutputView>
+void apply_operator_model(
         ExecSpace exec_space,
-        ViewType1 destination,
-        double alpha,
-        ViewType2 x,
-        double beta,
-        ViewType3 y)
-{
-    Kokkos::parallel_for(
-            "similie_axpby",
-            Kokkos::MDRangePolicy<
-                    ExecSpace,
-                    Kokkos::Rank<
-                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
-            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
-                destination(row, column) = alpha * x(row, column) + beta * y(row, column);
-            });
-    exec_space.fence();
-}
-
-template <class ExecSpace, class ViewType1, class ViewType2>
-void axpy_inplace(ExecSpace exec_space, ViewType1 destination, double alpha, ViewType2 source)
+        OperatorModel const& operator_model,
+        std::shared_ptr<typename MatrixFreeWorkspaceTraits<ExecSpace, OperatorModel>::type>&
+                workspace,
+        InputView input,
+        OutputView output)
 {
-    Kokkos::parallel_for(
-            "similie_axpy_inplace",
-            Kokkos::MDRangePolicy<
-                    ExecSpace,
-                    Kokkos::Rank<
-                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
-            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
-                destination(row, column) += alpha * source(row, column);
-            });
-    exec_space.fence();
+    using workspace_traits = MatrixFreeWorkspaceTraits<ExecSpace, OperatorModel>;
+    using workspace_type = typename workspace_traits::type;
+    if constexpr (workspace_traits::enabled) {
+        if constexpr (requires(
+                              OperatorModel const& model,
+                              ExecSpace ex,
+                              InputView in,
+                              OutputView out,
+                              workspace_type& ws) { model.apply(ex, in, out, ws); }) {
+            if (uses_precomputed_matrix_free_stencils(operator_model)) {
+                operator_model.apply(exec_space, input, output);
+            } else {
+                if (workspace == nullptr) {
+                    workspace = std::make_shared<workspace_type>(
+                            operator_model.create_matrix_free_workspace(exec_space));
+                }
+                operator_model.apply(exec_space, input, output, *workspace);
+            }
+        } else {
+            operator_model.apply(exec_space, input, output);
+        }
+    } else {
+        operator_model.apply(exec_space, input, output);
+    }
 }
 
 template <class KokkosViewType>
@@ -621,16 +757,59 @@ inline std::shared_ptr<gko::matrix::Csr<double, gko::int32>> csr_from_matrix_dat
                             .release());
 }
 
+/*
+ * Wraps a CSR matrix assembled by sil::exterior::assemble_sparse_operator. The arrays are copied
+ * by the executor from the memory space they live in, without going through matrix_data.
+ */
+template <class SparseOperator>
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> csr_from_sparse_operator(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        std::shared_ptr<gko::Executor const> const& source_exec,
+        SparseOperator const& sparse_operator)
+{
+    static_assert(std::is_same_v<typename SparseOperator::index_type, gko::int32>);
+    using matrix_type = gko::matrix::Csr<double, gko::int32>;
+    auto const copy_view = [&](auto const& view) {
+        using value_type = typename std::decay_t<decltype(view)>::non_const_value_type;
+        gko::array<value_type> array(gko_exec, view.extent(0));
+        gko_exec->copy_from(source_exec.get(), view.extent(0), view.data(), array.get_data());
+        return array;
+    };
+    return std::shared_ptr<matrix_type>(
+            matrix_type::
+                    create(gko_exec,
+                           gko::dim<2>(sparse_operator.nb_rows, sparse_operator.nb_columns),
+                           copy_view(sparse_operator.values),
+                           copy_view(sparse_operator.columns),
+                           copy_view(sparse_operator.row_ptrs))
+                            .release());
+}
+
 template <class OperatorModel>
 std::shared_ptr<gko::matrix::Csr<double, gko::int32>> build_matrix(
         std::shared_ptr<gko::Executor const> const& gko_exec,
         OperatorModel const& operator_model)
 {
-    auto matrix_data = assemble_matrix_data(operator_model);
-    if (env_flag_enabled("SIMILIE_MATRIX_DIAGNOSTICS")) {
+    // Models assembling themselves on the device skip the host matrix_data.
+    if constexpr (requires { operator_model.assemble_sparse_operator(); }) {
+        return csr_from_sparse_operator(
+                gko_exec,
+                gko::ext::kokkos::create_executor(operator_model.execution_space()),
+                operator_model.assemble_sparse_operator());
+    } else if constexpr (requires { assemble_csr_matrix(gko_exec, operator_model); }) {
+        if (!env_flag_enabled("SIMILIE_MATRIX_DIAGNOSTICS")) {
+            return assemble_csr_matrix(gko_exec, operator_model);
+        }
+        auto matrix_data = assemble_matrix_data(operator_model);
         log_matrix_diagnostics(matrix_data);
+        return csr_from_matrix_data(gko_exec, matrix_data);
+    } else {
+        auto matrix_data = assemble_matrix_data(operator_model);
+        if (env_flag_enabled("SIMILIE_MATRIX_DIAGNOSTICS")) {
+            log_matrix_diagnostics(matrix_data);
+        }
+        return csr_from_matrix_data(gko_exec, matrix_data);
     }
-    return csr_from_matrix_data(gko_exec, matrix_data);
 }
 
 template <class OperatorModel, class StateView>
@@ -639,6 +818,13 @@ std::shared_ptr<gko::matrix::Csr<double, gko::int32>> build_matrix(
         OperatorModel const& operator_model,
         StateView state)
 {
+    // Models writing their CSR arrays on the device skip the host matrix_data, which is only kept
+    // for the matrix diagnostics.
+    if constexpr (requires { assemble_csr_matrix(gko_exec, operator_model, state); }) {
+        if (!env_flag_enabled("SIMILIE_MATRIX_DIAGNOSTICS")) {
+            return assemble_csr_matrix(gko_exec, operator_model, state);
+        }
+    }
     auto matrix_data = assemble_matrix_data(operator_model, state);
     if (env_flag_enabled("SIMILIE_MATRIX_DIAGNOSTICS")) {
         log_matrix_diagnostics(matrix_data);
@@ -646,6 +832,41 @@ std::shared_ptr<gko::matrix::Csr<double, gko::int32>> build_matrix(
     return csr_from_matrix_data(gko_exec, matrix_data);
 }
 
+/*
+ * Jacobian of operator_model at state, refilling the values of matrix in place when the model
+ * provides refill_matrix_values and the sparsity pattern of matrix still matches. Otherwise, the
+ * matrix is fully reassembled.
+ */
+template <class OperatorModel, class StateView>
+std::shared_ptr<gko::matrix::Csr<double, gko::int32>> update_matrix(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        OperatorModel const& operator_model,
+        StateView state,
+        std::shared_ptr<gko::matrix::Csr<double, gko::int32>> matrix)
+{
+    using memory_space = typename StateView::memory_space;
+    using index_view_type
+            = Kokkos::View<gko::int32 const*, memory_space, Kokkos::MemoryUnmanaged>;
+    using value_view_type = Kokkos::View<double*, memory_space, Kokkos::MemoryUnmanaged>;
+    if constexpr (requires(index_view_type indices, value_view_type values) {
+                      refill_matrix_values(operator_model, state, indices, indices, values);
+                  }) {
+        if (matrix != nullptr) {
+            std::size_t const nb_rows = matrix->get_size()[0];
+            std::size_t const nnz = matrix->get_num_stored_elements();
+            if (refill_matrix_values(
+                        operator_model,
+                        state,
+                        index_view_type(matrix->get_const_row_ptrs(), nb_rows + 1),
+                        index_view_type(matrix->get_const_col_idxs(), nnz),
+                        value_view_type(matrix->get_values(), nnz))) {
+                return matrix;
+            }
+        }
+    }
+    return build_matrix(gko_exec, operator_model, state);
+}
+
 template <class ExecSpace, class OperatorModel>
 class MatrixFreeLinOp : public gko::EnableLinOp<MatrixFreeLinOp<ExecSpace, OperatorModel>>
 {
@@ -700,30 +921,7 @@ public:
         }
         auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
         auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
-        if constexpr (workspace_traits::enabled) {
-            if constexpr (requires(
-                                  OperatorModel const& model,
-                                  ExecSpace ex,
-                                  decltype(b_view) input,
-                                  decltype(x_view) output,
-                                  workspace_type& workspace) {
-                              model.apply(ex, input, output, workspace);
-                          }) {
-                if (uses_precomputed_matrix_free_stencils(*m_operator_model)) {
-                    m_operator_model->apply(m_exec_space, b_view, x_view);
-                } else {
-                    if (m_workspace == nullptr) {
-                        m_workspace = std::make_shared<workspace_type>(
-                                m_operator_model->create_matrix_free_workspace(m_exec_space));
-                    }
-                    m_operator_model->apply(m_exec_space, b_view, x_view, *m_workspace);
-                }
-            } else {
-                m_operator_model->apply(m_exec_space, b_view, x_view);
-            }
-        } else {
-            m_operator_model->apply(m_exec_space, b_view, x_view);
-        }
+        apply_operator_model(m_exec_space, *m_operator_model, m_workspace, b_view, x_view);
         m_exec_space.fence();
         auto const apply_end = std::chrono::steady_clock::now();
         ++m_apply_count;
@@ -755,30 +953,7 @@ public:
         auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
         Kokkos::View<double**, Kokkos::LayoutRight, memory_space>
                 applied("similie_matrix_free_linop_apply", x_view.extent(0), x_view.extent(1));
-        if constexpr (workspace_traits::enabled) {
-            if constexpr (requires(
-                                  OperatorModel const& model,
-                                  ExecSpace ex,
-                                  decltype(b_view) input,
-                                  decltype(applied) output,
-                                  workspace_type& workspace) {
-                              model.apply(ex, input, output, workspace);
-                          }) {
-                if (uses_precomputed_matrix_free_stencils(*m_operator_model)) {
-                    m_operator_model->apply(m_exec_space, b_view, applied);
-                } else {
-                    if (m_workspace == nullptr) {
-                        m_workspace = std::make_shared<workspace_type>(
-                                m_operator_model->create_matrix_free_workspace(m_exec_space));
-                    }
-                    m_operator_model->apply(m_exec_space, b_view, applied, *m_workspace);
-                }
-            } else {
-                m_operator_model->apply(m_exec_space, b_view, applied);
-            }
-        } else {
-            m_operator_model->apply(m_exec_space, b_view, applied);
-        }
+        apply_operator_model(m_exec_space, *m_operator_model, m_workspace, b_view, applied);
         Kokkos::parallel_for(
                 "similie_matrix_free_linop_advanced_apply",
                 Kokkos::MDRangePolicy<
@@ -920,167 +1095,992 @@ public:
     }
 };
 
-inline auto build_jacobi_preconditioner_factory(
-        std::shared_ptr<gko::Executor const> const& gko_exec,
-        StrongFormulationSolverSettings const& settings)
+/*
+ * Jacobian of the operator model at state, applied without apply_jacobian by the forward finite
+ * difference J v ~ (F(state + epsilon v) - F(state)) / epsilon, F(state) being operator_value.
+ * The step is epsilon = sqrt(machine_epsilon (1 + |state|)) / |v|. The perturbed state, its image
+ * and the matrix-free workspace of the model are allocated once and reused by every application.
+ */
+template <class ExecSpace, class OperatorModel, class StateView, class OperatorValueView>
+class FiniteDifferenceJacobianLinOp
+    : public gko::EnableLinOp<
+              FiniteDifferenceJacobianLinOp<ExecSpace, OperatorModel, StateView, OperatorValueView>>
 {
-    return gko::preconditioner::Jacobi<double>::build()
-            .with_max_block_size(settings.jacobi_max_block_size)
-            .on(gko_exec);
-}
+    using value_type = double;
+    using dense_type = gko::matrix::Dense<value_type>;
+    using memory_space = typename ExecSpace::memory_space;
+    using base_type = gko::EnableLinOp<
+            FiniteDifferenceJacobianLinOp<ExecSpace, OperatorModel, StateView, OperatorValueView>>;
+    using buffer_type = Kokkos::View<double**, Kokkos::LayoutRight, memory_space>;
+    using workspace_type = typename MatrixFreeWorkspaceTraits<ExecSpace, OperatorModel>::type;
 
-inline PreconditionerType selected_preconditioner(StrongFormulationSolverSettings const& settings)
-{
-    char const* const value = std::getenv("SIMILIE_PRECONDITIONER");
-    if (value == nullptr || value[0] == '\0') {
-        if (env_flag_enabled("SIMILIE_DISABLE_JACOBI_PRECONDITIONER")) {
-            return PreconditionerType::Identity;
+    ExecSpace m_exec_space;
+    std::shared_ptr<OperatorModel const> m_operator_model;
+    StateView m_state;
+    OperatorValueView m_operator_value;
+    buffer_type m_perturbed_state;
+    buffer_type m_perturbed_value;
+    double m_state_norm = 0.0;
+    mutable std::shared_ptr<workspace_type> m_workspace;
+
+    /*
+     * Fills m_perturbed_value with F(state + epsilon input) and returns epsilon, or 0 if input
+     * vanishes.
+     */
+    template <class InputView>
+    double apply_perturbed(InputView input) const
+    {
+        double const input_norm = residual_norm_l2(m_exec_space, input);
+        if (input_norm == 0.0) {
+            return 0.0;
         }
-        return settings.preconditioner;
+        double const epsilon
+                = std::sqrt(std::numeric_limits<double>::epsilon() * (1.0 + m_state_norm))
+                  / input_norm;
+        update_axpby(m_exec_space, m_perturbed_state, 1.0, m_state, epsilon, input);
+        apply_operator_model(
+                m_exec_space,
+                *m_operator_model,
+                m_workspace,
+                m_perturbed_state,
+                m_perturbed_value);
+        return epsilon;
     }
-    return parse_preconditioner(value);
-}
-
-inline std::shared_ptr<gko::LinOp const> build_identity_preconditioner(
-        std::shared_ptr<gko::Executor const> const& gko_exec,
-        gko::size_type size)
-{
-    return gko::matrix::Identity<double>::create(gko_exec, size);
-}
 
-inline std::shared_ptr<gko::LinOp const> build_preconditioner(
-        std::shared_ptr<gko::Executor const> const& gko_exec,
-        std::shared_ptr<gko::LinOp const> const& matrix,
-        StrongFormulationSolverSettings const& settings)
-{
-    PreconditionerType const preconditioner = selected_preconditioner(settings);
-    std::cout << "SimiLie Ginkgo preconditioner: " << preconditioner_name(preconditioner) << '\n';
-    switch (preconditioner) {
-    case PreconditionerType::Identity:
-        return build_identity_preconditioner(gko_exec, matrix->get_size()[0]);
-    case PreconditionerType::Jacobi: {
-        auto preconditioner_factory = build_jacobi_preconditioner_factory(gko_exec, settings);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
-    }
-    case PreconditionerType::SpdIsai: {
-        auto preconditioner_factory
-                = gko::preconditioner::SpdIsai<double, gko::int32>::build().on(gko_exec);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
+public:
+    explicit FiniteDifferenceJacobianLinOp(std::shared_ptr<gko::Executor const> exec)
+        : base_type(std::move(exec))
+        , m_exec_space()
+        , m_operator_model()
+        , m_state()
+        , m_operator_value()
+    {
     }
-    case PreconditionerType::GeneralIsai: {
-        auto preconditioner_factory
-                = gko::preconditioner::GeneralIsai<double, gko::int32>::build().on(gko_exec);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
-    }
-    case PreconditionerType::SymmetricGaussSeidel: {
-        auto preconditioner_factory = gko::preconditioner::GaussSeidel<double, gko::int32>::build()
-                                              .with_symmetric(true)
-                                              .on(gko_exec);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
-    }
-    case PreconditionerType::Ssor: {
-        auto preconditioner_factory = gko::preconditioner::Sor<double, gko::int32>::build()
-                                              .with_symmetric(true)
-                                              .with_relaxation_factor(env_double_or(
-                                                      "SIMILIE_SOR_RELAXATION_FACTOR",
-                                                      settings.sor_relaxation_factor))
-                                              .on(gko_exec);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
+
+    FiniteDifferenceJacobianLinOp(
+            std::shared_ptr<gko::Executor const> exec,
+            ExecSpace exec_space,
+            std::shared_ptr<OperatorModel const> operator_model,
+            StateView state,
+            OperatorValueView operator_value)
+        : base_type(exec, gko::dim<2>(operator_model->size(), operator_model->size()))
+        , m_exec_space(exec_space)
+        , m_operator_model(std::move(operator_model))
+        , m_state(state)
+        , m_operator_value(operator_value)
+        , m_perturbed_state(
+                  "similie_finite_difference_jacobian_perturbed_state",
+                  state.extent(0),
+                  state.extent(1))
+        , m_perturbed_value(
+                  "similie_finite_difference_jacobian_perturbed_value",
+                  state.extent(0),
+                  state.extent(1))
+    {
+        update_state(operator_value);
     }
-    case PreconditionerType::ChebyshevJacobi: {
-        auto jacobi_factory = build_jacobi_preconditioner_factory(gko_exec, settings);
-        auto iterations_criterion = gko::stop::Iteration::build()
-                                            .with_max_iters(settings.chebyshev_iterations)
-                                            .on(gko_exec);
-        auto preconditioner_factory
-                = gko::solver::Chebyshev<double>::build()
-                          .with_criteria(std::move(iterations_criterion))
-                          .with_preconditioner(std::move(jacobi_factory))
-                          .with_foci(settings.chebyshev_lower_bound, settings.chebyshev_upper_bound)
-                          .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
-                          .on(gko_exec);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
+
+    // To be called whenever the values of state change, operator_value holding their image.
+    void update_state(OperatorValueView operator_value)
+    {
+        m_operator_value = operator_value;
+        m_state_norm = residual_norm_l2(m_exec_space, m_state);
     }
-    case PreconditionerType::IrJacobi: {
-        auto jacobi_factory = build_jacobi_preconditioner_factory(gko_exec, settings);
-        auto iterations_criterion
-                = gko::stop::Iteration::build().with_max_iters(settings.ir_iterations).on(gko_exec);
-        auto preconditioner_factory
-                = gko::solver::Ir<double>::build()
-                          .with_criteria(std::move(iterations_criterion))
-                          .with_solver(std::move(jacobi_factory))
-                          .with_relaxation_factor(settings.ir_relaxation_factor)
-                          .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
-                          .on(gko_exec);
-        return std::shared_ptr<gko::LinOp const>(
-                preconditioner_factory->generate(matrix).release());
+
+public:
+    void apply_impl(gko::LinOp const* b, gko::LinOp* x) const override
+    {
+        auto const* b_dense = dynamic_cast<dense_type const*>(b);
+        auto* x_dense = dynamic_cast<dense_type*>(x);
+        if (b_dense == nullptr || x_dense == nullptr) {
+            throw std::invalid_argument(
+                    "FiniteDifferenceJacobianLinOp expects dense inputs and outputs");
+        }
+        auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
+        auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
+        double const epsilon = apply_perturbed(b_view);
+        if (epsilon == 0.0) {
+            fill(m_exec_space, x_view, 0.0);
+            return;
+        }
+        update_axpby(
+                m_exec_space,
+                x_view,
+                1.0 / epsilon,
+                m_perturbed_value,
+                -1.0 / epsilon,
+                m_operator_value);
     }
+
+    void apply_impl(
+            gko::LinOp const* alpha,
+            gko::LinOp const* b,
+            gko::LinOp const* beta,
+            gko::LinOp* x) const override
+    {
+        auto const* alpha_dense = dynamic_cast<dense_type const*>(alpha);
+        auto const* b_dense = dynamic_cast<dense_type const*>(b);
+        auto const* beta_dense = dynamic_cast<dense_type const*>(beta);
+        auto* x_dense = dynamic_cast<dense_type*>(x);
+        if (alpha_dense == nullptr || b_dense == nullptr || beta_dense == nullptr
+            || x_dense == nullptr) {
+            throw std::invalid_argument(
+                    "FiniteDifferenceJacobianLinOp expects dense alpha, beta, input, and output");
+        }
+        auto alpha_view = gko::ext::kokkos::map_data<memory_space>(*alpha_dense);
+        auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
+        auto beta_view = gko::ext::kokkos::map_data<memory_space>(*beta_dense);
+        auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
+        double const epsilon = apply_perturbed(b_view);
+        double const inverse_epsilon = epsilon == 0.0 ? 0.0 : 1.0 / epsilon;
+        buffer_type const perturbed_value = m_perturbed_value;
+        OperatorValueView const operator_value = m_operator_value;
+        Kokkos::parallel_for(
+                "similie_finite_difference_jacobian_advanced_apply",
+                Kokkos::MDRangePolicy<
+                        ExecSpace,
+                        Kokkos::Rank<
+                                2>>(m_exec_space, {0, 0}, {x_view.extent(0), x_view.extent(1)}),
+                KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                    double const applied = inverse_epsilon
+                                           * (perturbed_value(row, column)
+                                              - operator_value(row, column));
+                    x_view(row, column) = alpha_view(0, 0) * applied
+                                          + beta_view(0, 0) * x_view(row, column);
+                });
+        m_exec_space.fence();
     }
-    throw std::runtime_error("unsupported strong-formulation preconditioner");
-}
+};
 
-template <class ExecSpace, class OperatorModel, class RHSViewType, class SolutionViewType>
-StrongFormulationSolverDiagnostics solve_linearized_system(
-        ExecSpace exec_space,
-        std::shared_ptr<gko::Executor const> const& gko_exec,
-        OperatorModel const& operator_model,
-        RHSViewType rhs,
-        SolutionViewType solution,
-        StrongFormulationSolverSettings const& settings,
-        std::shared_ptr<gko::LinOp const> const& assembled_matrix,
-        std::shared_ptr<gko::LinOp const> const& preconditioner)
+/*
+ * Preconditioner applied by the operator model itself, for instance an FFT-based inverse of the
+ * constant-coefficient part of the operator (see exterior::FourierLaplacianSolver).
+ */
+template <class ExecSpace, class OperatorModel>
+class FourierPreconditionerLinOp
+    : public gko::EnableLinOp<FourierPreconditionerLinOp<ExecSpace, OperatorModel>>
 {
-    StrongFormulationSolverDiagnostics diagnostics;
-    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
-        std::cout << "SimiLie linear solve stage: computing initial residual norm" << std::endl;
-    }
-    auto const initial_residual_start = std::chrono::steady_clock::now();
-    diagnostics.initial_residual_l2 = residual_norm_l2(exec_space, rhs);
-    auto const initial_residual_end = std::chrono::steady_clock::now();
-    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
-        std::cout << "SimiLie linear solve stage: initial residual norm computed duration="
-                  << std::chrono::duration<double>(initial_residual_end - initial_residual_start)
-                             .count()
-                  << std::endl;
+    using value_type = double;
+    using dense_type = gko::matrix::Dense<value_type>;
+    using memory_space = typename ExecSpace::memory_space;
+    using base_type = gko::EnableLinOp<FourierPreconditionerLinOp<ExecSpace, OperatorModel>>;
+
+    ExecSpace m_exec_space;
+    std::shared_ptr<OperatorModel const> m_operator_model;
+
+public:
+    explicit FourierPreconditionerLinOp(std::shared_ptr<gko::Executor const> exec)
+        : base_type(std::move(exec))
+        , m_exec_space()
+        , m_operator_model()
+    {
     }
-    diagnostics.final_residual_l2 = diagnostics.initial_residual_l2;
-    diagnostics.final_relative_residual = diagnostics.initial_residual_l2 == 0.0 ? 0.0 : 1.0;
-    if (diagnostics.initial_residual_l2 == 0.0) {
-        fill(exec_space, solution, 0.0);
-        return diagnostics;
+
+    FourierPreconditionerLinOp(
+            std::shared_ptr<gko::Executor const> exec,
+            ExecSpace exec_space,
+            std::shared_ptr<OperatorModel const> operator_model)
+        : base_type(exec, gko::dim<2>(operator_model->size(), operator_model->size()))
+        , m_exec_space(exec_space)
+        , m_operator_model(std::move(operator_model))
+    {
     }
 
-    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
-        std::cout << "SimiLie linear solve stage: building solver factory" << std::endl;
+public:
+    void apply_impl(gko::LinOp const* b, gko::LinOp* x) const override
+    {
+        auto const* b_dense = dynamic_cast<dense_type const*>(b);
+        auto* x_dense = dynamic_cast<dense_type*>(x);
+        if (b_dense == nullptr || x_dense == nullptr) {
+            throw std::invalid_argument(
+                    "FourierPreconditionerLinOp expects dense inputs and outputs");
+        }
+        auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
+        auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
+        m_operator_model->apply_fourier_preconditioner(m_exec_space, b_view, x_view);
+        m_exec_space.fence();
+    }
+
+    void apply_impl(
+            gko::LinOp const* alpha,
+            gko::LinOp const* b,
+            gko::LinOp const* beta,
+            gko::LinOp* x) const override
+    {
+        auto const* alpha_dense = dynamic_cast<dense_type const*>(alpha);
+        auto const* b_dense = dynamic_cast<dense_type const*>(b);
+        auto const* beta_dense = dynamic_cast<dense_type const*>(beta);
+        auto* x_dense = dynamic_cast<dense_type*>(x);
+        if (alpha_dense == nullptr || b_dense == nullptr || beta_dense == nullptr
+            || x_dense == nullptr) {
+            throw std::invalid_argument(
+                    "FourierPreconditionerLinOp expects dense alpha, beta, input, and output");
+        }
+        auto alpha_view = gko::ext::kokkos::map_data<memory_space>(*alpha_dense);
+        auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
+        auto beta_view = gko::ext::kokkos::map_data<memory_space>(*beta_dense);
+        auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
+        Kokkos::View<double**, Kokkos::LayoutRight, memory_space> applied(
+                "similie_fourier_preconditioner_apply",
+                x_view.extent(0),
+                x_view.extent(1));
+        m_operator_model->apply_fourier_preconditioner(m_exec_space, b_view, applied);
+        Kokkos::parallel_for(
+                "similie_fourier_preconditioner_advanced_apply",
+                Kokkos::MDRangePolicy<
+                        ExecSpace,
+                        Kokkos::Rank<
+                                2>>(m_exec_space, {0, 0}, {x_view.extent(0), x_view.extent(1)}),
+                KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                    x_view(row, column) = alpha_view(0, 0) * applied(row, column)
+                                          + beta_view(0, 0) * x_view(row, column);
+                });
+        m_exec_space.fence();
+    }
+};
+
+template <class ExecSpace, class OperatorModel>
+std::shared_ptr<gko::LinOp const> build_fourier_preconditioner(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        ExecSpace exec_space,
+        OperatorModel const& operator_model)
+{
+    using view_type = Kokkos::View<double**, Kokkos::LayoutRight, typename ExecSpace::memory_space>;
+    if constexpr (requires(OperatorModel const& model, view_type input, view_type output) {
+                      model.apply_fourier_preconditioner(exec_space, input, output);
+                  }) {
+        auto operator_model_ptr
+                = std::shared_ptr<OperatorModel const>(&operator_model, [](OperatorModel const*) {
+                  });
+        return std::make_shared<FourierPreconditionerLinOp<
+                ExecSpace,
+                OperatorModel>>(gko_exec, exec_space, std::move(operator_model_ptr));
+    } else {
+        throw std::runtime_error(
+                "the Fourier preconditioner requires an operator model providing "
+                "apply_fourier_preconditioner");
+    }
+}
+
+template <class ValueType = double>
+std::shared_ptr<gko::LinOp const> build_identity_preconditioner(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        gko::size_type size)
+{
+    return gko::matrix::Identity<ValueType>::create(gko_exec, size);
+}
+
+/*
+ * Preconditioner of the Jacobian-free Newton-Krylov mode, in which no Jacobian is assembled: the
+ * Fourier preconditioner of the operator model if it is selected, the identity otherwise.
+ */
+template <class ExecSpace, class OperatorModel>
+std::shared_ptr<gko::LinOp const> build_jacobian_free_preconditioner(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        ExecSpace exec_space,
+        OperatorModel const& operator_model,
+        StrongFormulationSolverSettings const& settings)
+{
+    PreconditionerType const preconditioner = selected_preconditioner(settings);
+    if (preconditioner == PreconditionerType::Fourier) {
+        std::cout << "SimiLie Ginkgo preconditioner: " << preconditioner_name(preconditioner)
+                  << '\n';
+        return build_fourier_preconditioner(gko_exec, exec_space, operator_model);
+    }
+    std::cout << "SimiLie Ginkgo preconditioner: "
+              << preconditioner_name(PreconditionerType::Identity) << " ("
+              << preconditioner_name(preconditioner)
+              << " requires an assembled Jacobian, unavailable in Jacobian-free mode)\n";
+    return build_identity_preconditioner(gko_exec, operator_model.size());
+}
+
+/*
+ * One level of the geometric multigrid hierarchy: the operator model discretized on the level grid
+ * with the inverse of its diagonal and the work vectors of the cycle. The finest level has no rhs
+ * nor solution, the cycle working there on the vectors passed to the preconditioner.
+ */
+template <class ExecSpace, class OperatorModel>
+struct MultigridLevel
+{
+    using memory_space = typename ExecSpace::memory_space;
+    using view_type = Kokkos::View<double**, Kokkos::LayoutRight, memory_space>;
+    using layout_type = decltype(std::declval<OperatorModel const&>().multigrid_layout());
+    using workspace_type = typename MatrixFreeWorkspaceTraits<ExecSpace, OperatorModel>::type;
+
+    std::shared_ptr<OperatorModel const> operator_model;
+    layout_type layout;
+    mutable std::shared_ptr<workspace_type> workspace;
+    Kokkos::View<double*, memory_space> inverse_diagonal;
+    view_type rhs;
+    view_type solution;
+    view_type residual;
+    view_type direction;
+    double max_eigenvalue = 1.0;
+
+    MultigridLevel(
+            ExecSpace exec_space,
+            std::shared_ptr<OperatorModel const> model,
+            bool is_finest_level)
+        : operator_model(std::move(model))
+        , layout(operator_model->multigrid_layout())
+        , inverse_diagonal("similie_multigrid_inverse_diagonal", layout.size())
+        , rhs(is_finest_level ? view_type() : view_type("similie_multigrid_rhs", layout.size(), 1))
+        , solution(
+                  is_finest_level ? view_type()
+                                  : view_type("similie_multigrid_solution", layout.size(), 1))
+        , residual("similie_multigrid_residual", layout.size(), 1)
+        , direction("similie_multigrid_direction", layout.size(), 1)
+    {
+        if (layout.size() != operator_model->size()) {
+            throw std::runtime_error(
+                    "the multigrid layout does not match the size of the operator model");
+        }
+        if constexpr (requires(OperatorModel const& op, Kokkos::View<double*, memory_space> d) {
+                          op.fill_diagonal(exec_space, d);
+                      }) {
+            operator_model->fill_diagonal(exec_space, inverse_diagonal);
+        } else {
+            probe_diagonal(
+                    exec_space,
+                    layout,
+                    [&](view_type input, view_type output) { apply(exec_space, input, output); },
+                    direction,
+                    residual,
+                    inverse_diagonal);
+        }
+        auto const inverse_diagonal_view = inverse_diagonal;
+        Kokkos::parallel_for(
+                "similie_multigrid_invert_diagonal",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, layout.size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    double const diagonal = inverse_diagonal_view(row);
+                    inverse_diagonal_view(row) = diagonal != 0.0 ? 1.0 / diagonal : 1.0;
+                });
+        exec_space.fence();
+        max_eigenvalue = estimate_max_eigenvalue(exec_space);
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace exec_space, InputView input, OutputView output) const
+    {
+        apply_operator_model(exec_space, *operator_model, workspace, input, output);
+    }
+
+    // Power iteration on D^-1 A, which bounds the spectrum targeted by the Chebyshev smoother.
+    double estimate_max_eigenvalue(ExecSpace exec_space) const
+    {
+        static constexpr int s_nb_power_iterations = 12;
+        auto const vector = direction;
+        auto const applied = residual;
+        auto const inverse_diagonal_view = inverse_diagonal;
+        Kokkos::parallel_for(
+                "similie_multigrid_fill_power_iteration",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, layout.size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    vector(row, 0) = 0.5 + static_cast<double>((row * 2654435761U) % 1024U) / 1024.;
+                });
+        exec_space.fence();
+        double norm = residual_norm_l2(exec_space, vector);
+        double eigenvalue = 1.0;
+        for (int iteration = 0; iteration < s_nb_power_iterations && norm > 0.0; ++iteration) {
+            apply(exec_space, vector, applied);
+            double const inverse_norm = 1.0 / norm;
+            Kokkos::parallel_for(
+                    "similie_multigrid_power_iteration",
+                    Kokkos::RangePolicy<ExecSpace>(exec_space, 0, layout.size()),
+                    KOKKOS_LAMBDA(std::size_t row) {
+                        vector(row, 0) = inverse_norm * inverse_diagonal_view(row)
+                                         * applied(row, 0);
+                    });
+            exec_space.fence();
+            norm = residual_norm_l2(exec_space, vector);
+            eigenvalue = norm;
+        }
+        return eigenvalue;
+    }
+};
+
+/*
+ * Chebyshev iteration on D^-1 A targeting [1.1 max_eigenvalue / range, 1.1 max_eigenvalue]. As a
+ * polynomial in D^-1 A, it keeps the multigrid cycle symmetric.
+ */
+template <class ExecSpace, class Level, class RhsView, class SolutionView>
+void chebyshev_smooth(
+        ExecSpace exec_space,
+        Level const& level,
+        RhsView rhs,
+        SolutionView solution,
+        unsigned int degree,
+        double range,
+        bool zero_initial_guess)
+{
+    double const upper = 1.1 * level.max_eigenvalue;
+    double const lower = upper / range;
+    double const theta = 0.5 * (upper + lower);
+    double const delta = 0.5 * (upper - lower);
+    double const sigma = theta / delta;
+    double rho = 1.0 / sigma;
+    auto const residual = level.residual;
+    auto const direction = level.direction;
+    auto const inverse_diagonal = level.inverse_diagonal;
+    std::size_t const size = level.layout.size();
+
+    if (zero_initial_guess) {
+        fill(exec_space, residual, 0.0);
+    } else {
+        level.apply(exec_space, solution, residual);
+    }
+    Kokkos::parallel_for(
+            "similie_multigrid_chebyshev_start",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, size),
+            KOKKOS_LAMBDA(std::size_t row) {
+                direction(row, 0) = inverse_diagonal(row) * (rhs(row, 0) - residual(row, 0))
+                                    / theta;
+            });
+    exec_space.fence();
+    for (unsigned int step = 0; step < degree; ++step) {
+        axpy_inplace(exec_space, solution, 1.0, direction);
+        if (step + 1 == degree) {
+            break;
+        }
+        level.apply(exec_space, solution, residual);
+        double const next_rho = 1.0 / (2.0 * sigma - rho);
+        double const direction_factor = next_rho * rho;
+        double const residual_factor = 2.0 * next_rho / delta;
+        Kokkos::parallel_for(
+                "similie_multigrid_chebyshev_step",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, size),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    direction(row, 0) = direction_factor * direction(row, 0)
+                                        + residual_factor * inverse_diagonal(row)
+                                                  * (rhs(row, 0) - residual(row, 0));
+                });
+        exec_space.fence();
+        rho = next_rho;
+    }
+}
+
+/*
+ * Geometric multigrid V- or W-cycle. Coarse operators are rediscretized by the operator model
+ * itself on coarsened grids (OperatorModel::coarsen), cochains are transferred with the
+ * form-degree-aware prolongation of StructuredCochainLayout and its transpose, and every level is
+ * smoothed by Chebyshev-Jacobi iterations, so that the whole cycle stays matrix-free.
+ */
+template <class ExecSpace, class OperatorModel>
+class GeometricMultigridLinOp
+    : public gko::EnableLinOp<GeometricMultigridLinOp<ExecSpace, OperatorModel>>
+{
+    using value_type = double;
+    using dense_type = gko::matrix::Dense<value_type>;
+    using memory_space = typename ExecSpace::memory_space;
+    using base_type = gko::EnableLinOp<GeometricMultigridLinOp<ExecSpace, OperatorModel>>;
+    using coarse_operator_model_type = typename std::remove_cvref_t<
+            decltype(std::declval<OperatorModel const&>().coarsen(
+                    std::declval<ExecSpace>()))>::value_type;
+    using fine_level_type = MultigridLevel<ExecSpace, OperatorModel>;
+    using coarse_level_type = MultigridLevel<ExecSpace, coarse_operator_model_type>;
+
+    static_assert(
+            std::is_same_v<
+                    std::remove_cvref_t<
+                            decltype(std::declval<coarse_operator_model_type const&>().coarsen(
+                                    std::declval<ExecSpace>()))>,
+                    std::optional<coarse_operator_model_type>>,
+            "coarsening a coarse operator model must give an operator model of the same type");
+
+    static constexpr double s_smoothing_range = 30.0;
+    static constexpr double s_coarse_range = 1000.0;
+
+    ExecSpace m_exec_space;
+    std::shared_ptr<fine_level_type> m_fine_level;
+    std::vector<std::shared_ptr<coarse_level_type>> m_coarse_levels;
+    MultigridCycle m_cycle = MultigridCycle::V;
+    unsigned int m_smoothing_steps = 2U;
+    unsigned int m_coarse_iterations = 40U;
+
+public:
+    explicit GeometricMultigridLinOp(std::shared_ptr<gko::Executor const> exec)
+        : base_type(std::move(exec))
+        , m_exec_space()
+    {
+    }
+
+    GeometricMultigridLinOp(
+            std::shared_ptr<gko::Executor const> exec,
+            ExecSpace exec_space,
+            std::shared_ptr<OperatorModel const> operator_model,
+            StrongFormulationSolverSettings const& settings)
+        : base_type(exec, gko::dim<2>(operator_model->size(), operator_model->size()))
+        , m_exec_space(exec_space)
+        , m_fine_level(std::make_shared<fine_level_type>(exec_space, operator_model, true))
+        , m_cycle(settings.multigrid_cycle)
+        , m_smoothing_steps(std::max(1U, settings.multigrid_smoothing_steps))
+        , m_coarse_iterations(std::max(1U, settings.multigrid_coarse_iterations))
+    {
+        auto const keep_coarsening = [&](std::size_t size) {
+            return m_coarse_levels.size() + 1 < settings.multigrid_max_levels
+                   && size > settings.multigrid_coarse_size;
+        };
+        std::optional<coarse_operator_model_type> coarse_model;
+        if (keep_coarsening(operator_model->size())) {
+            coarse_model = operator_model->coarsen(exec_space);
+        }
+        auto fine_layout = m_fine_level->layout;
+        while (coarse_model.has_value()) {
+            auto coarse_model_ptr
+                    = std::make_shared<coarse_operator_model_type const>(std::move(*coarse_model));
+            coarse_model.reset();
+            auto level = std::make_shared<coarse_level_type>(exec_space, coarse_model_ptr, false);
+            if (level->layout.extents != coarsen(fine_layout).extents) {
+                throw std::runtime_error(
+                        "the coarse operator model is not discretized on the coarsened grid");
+            }
+            fine_layout = level->layout;
+            m_coarse_levels.push_back(std::move(level));
+            if (keep_coarsening(coarse_model_ptr->size())) {
+                coarse_model = coarse_model_ptr->coarsen(exec_space);
+            }
+        }
+
+        std::cout << "SimiLie geometric multigrid: levels=" << m_coarse_levels.size() + 1
+                  << " cycle=" << (m_cycle == MultigridCycle::W ? "W" : "V") << " sizes="
+                  << m_fine_level->layout.size();
+        for (auto const& level : m_coarse_levels) {
+            std::cout << '/' << level->layout.size();
+        }
+        std::cout << '\n';
+    }
+
+public:
+    void apply_impl(gko::LinOp const* b, gko::LinOp* x) const override
+    {
+        auto const* b_dense = dynamic_cast<dense_type const*>(b);
+        auto* x_dense = dynamic_cast<dense_type*>(x);
+        if (b_dense == nullptr || x_dense == nullptr) {
+            throw std::invalid_argument(
+                    "GeometricMultigridLinOp expects dense inputs and outputs");
+        }
+        auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
+        auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
+        if (b_view.extent(1) != 1) {
+            throw std::invalid_argument("GeometricMultigridLinOp expects a single right-hand side");
+        }
+        fill(m_exec_space, x_view, 0.0);
+        cycle(*m_fine_level, 0, b_view, x_view, true);
+    }
+
+    void apply_impl(
+            gko::LinOp const* alpha,
+            gko::LinOp const* b,
+            gko::LinOp const* beta,
+            gko::LinOp* x) const override
+    {
+        auto const* alpha_dense = dynamic_cast<dense_type const*>(alpha);
+        auto const* b_dense = dynamic_cast<dense_type const*>(b);
+        auto const* beta_dense = dynamic_cast<dense_type const*>(beta);
+        auto* x_dense = dynamic_cast<dense_type*>(x);
+        if (alpha_dense == nullptr || b_dense == nullptr || beta_dense == nullptr
+            || x_dense == nullptr) {
+            throw std::invalid_argument(
+                    "GeometricMultigridLinOp expects dense alpha, beta, input, and output");
+        }
+        auto alpha_view = gko::ext::kokkos::map_data<memory_space>(*alpha_dense);
+        auto b_view = gko::ext::kokkos::map_data<memory_space>(*b_dense);
+        auto beta_view = gko::ext::kokkos::map_data<memory_space>(*beta_dense);
+        auto x_view = gko::ext::kokkos::map_data<memory_space>(*x_dense);
+        if (b_view.extent(1) != 1) {
+            throw std::invalid_argument("GeometricMultigridLinOp expects a single right-hand side");
+        }
+        Kokkos::View<double**, Kokkos::LayoutRight, memory_space>
+                applied("similie_geometric_multigrid_apply", x_view.extent(0), x_view.extent(1));
+        cycle(*m_fine_level, 0, b_view, applied, true);
+        Kokkos::parallel_for(
+                "similie_geometric_multigrid_advanced_apply",
+                Kokkos::MDRangePolicy<
+                        ExecSpace,
+                        Kokkos::Rank<
+                                2>>(m_exec_space, {0, 0}, {x_view.extent(0), x_view.extent(1)}),
+                KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                    x_view(row, column) = alpha_view(0, 0) * applied(row, column)
+                                          + beta_view(0, 0) * x_view(row, column);
+                });
+        m_exec_space.fence();
+    }
+
+private:
+    // Improves the approximate solution of level.apply(solution) = rhs on the level of index depth.
+    template <class Level, class RhsView, class SolutionView>
+    void cycle(
+            Level const& level,
+            std::size_t depth,
+            RhsView rhs,
+            SolutionView solution,
+            bool zero_initial_guess) const
+    {
+        if (depth == m_coarse_levels.size()) {
+            chebyshev_smooth(
+                    m_exec_space,
+                    level,
+                    rhs,
+                    solution,
+                    m_coarse_iterations,
+                    s_coarse_range,
+                    zero_initial_guess);
+            return;
+        }
+        chebyshev_smooth(
+                m_exec_space,
+                level,
+                rhs,
+                solution,
+                m_smoothing_steps,
+                s_smoothing_range,
+                zero_initial_guess);
+
+        level.apply(m_exec_space, solution, level.residual);
+        update_axpby(m_exec_space, level.residual, 1.0, rhs, -1.0, level.residual);
+        coarse_level_type const& coarse_level = *m_coarse_levels[depth];
+        restrict_to_coarse(m_exec_space, level.layout, level.residual, coarse_level.rhs);
+        fill(m_exec_space, coarse_level.solution, 0.0);
+        unsigned int const nb_visits = m_cycle == MultigridCycle::W ? 2U : 1U;
+        for (unsigned int visit = 0; visit < nb_visits; ++visit) {
+            cycle(coarse_level,
+                  depth + 1,
+                  coarse_level.rhs,
+                  coarse_level.solution,
+                  visit == 0);
+        }
+        prolongate_and_add(m_exec_space, level.layout, coarse_level.solution, solution);
+
+        chebyshev_smooth(
+                m_exec_space,
+                level,
+                rhs,
+                solution,
+                m_smoothing_steps,
+                s_smoothing_range,
+                false);
+    }
+};
+
+template <class ExecSpace, class OperatorModel>
+std::shared_ptr<gko::LinOp const> build_geometric_multigrid_preconditioner(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        ExecSpace exec_space,
+        OperatorModel const& operator_model,
+        StrongFormulationSolverSettings const& settings)
+{
+    if constexpr (requires(OperatorModel const& model) {
+                      model.multigrid_layout();
+                      model.coarsen(exec_space);
+                  }) {
+        auto operator_model_ptr
+                = std::shared_ptr<OperatorModel const>(&operator_model, [](OperatorModel const*) {
+                  });
+        return std::make_shared<GeometricMultigridLinOp<ExecSpace, OperatorModel>>(
+                gko_exec,
+                exec_space,
+                std::move(operator_model_ptr),
+                settings);
+    } else {
+        throw std::runtime_error(
+                "the geometric multigrid preconditioner requires an operator model providing "
+                "multigrid_layout() and coarsen()");
+    }
+}
+
+template <class ValueType = double>
+auto build_jacobi_preconditioner_factory(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        StrongFormulationSolverSettings const& settings)
+{
+    return gko::preconditioner::Jacobi<ValueType>::build()
+            .with_max_block_size(settings.jacobi_max_block_size)
+            .on(gko_exec);
+}
+
+inline PreconditionerType selected_preconditioner(StrongFormulationSolverSettings const& settings)
+{
+    char const* const value = std::getenv("SIMILIE_PRECONDITIONER");
+    if (value == nullptr || value[0] == '\0') {
+        if (env_flag_enabled("SIMILIE_DISABLE_JACOBI_PRECONDITIONER")) {
+            return PreconditionerType::Identity;
+        }
+        return settings.preconditioner;
+    }
+    return parse_preconditioner(value);
+}
+
+inline MatrixFormat selected_matrix_format(StrongFormulationSolverSettings const& settings)
+{
+    char const* const value = std::getenv("SIMILIE_MATRIX_FORMAT");
+    if (value == nullptr || value[0] == '\0') {
+        return settings.matrix_format;
+    }
+    return parse_matrix_format(value);
+}
+
+/*
+ * The assembled matrix in the storage format selected by settings, converted on the executor of
+ * matrix. Matrices other than CSR matrices of ValueType are returned as is.
+ */
+template <class ValueType = double>
+std::shared_ptr<gko::LinOp const> convert_matrix_format(
+        std::shared_ptr<gko::LinOp const> const& matrix,
+        StrongFormulationSolverSettings const& settings)
+{
+    using csr_type = gko::matrix::Csr<ValueType, gko::int32>;
+    auto const csr = std::dynamic_pointer_cast<csr_type const>(matrix);
+    if (csr == nullptr) {
+        return matrix;
+    }
+    switch (selected_matrix_format(settings)) {
+    case MatrixFormat::Csr:
+        return matrix;
+    case MatrixFormat::Ell: {
+        auto ell = gko::matrix::Ell<ValueType, gko::int32>::create(csr->get_executor());
+        csr->convert_to(ell.get());
+        return ell;
+    }
+    case MatrixFormat::Sellp: {
+        auto sellp = gko::matrix::Sellp<ValueType, gko::int32>::create(csr->get_executor());
+        csr->convert_to(sellp.get());
+        return sellp;
+    }
+    case MatrixFormat::Hybrid: {
+        auto hybrid = gko::matrix::Hybrid<ValueType, gko::int32>::create(csr->get_executor());
+        csr->convert_to(hybrid.get());
+        return hybrid;
+    }
+    }
+    return matrix;
+}
+
+/*
+ * Factory of one cycle of algebraic multigrid. The levels are coarsened by parallel graph matching
+ * aggregation (Ginkgo Pgm) until multigrid_coarse_size rows or multigrid_max_levels levels, and
+ * are smoothed by multigrid_smoothing_steps iterations of multigrid_smoother.
+ */
+template <class ValueType = double>
+std::shared_ptr<gko::LinOpFactory const> build_algebraic_multigrid_factory(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        StrongFormulationSolverSettings const& settings)
+{
+    // Smoothers improve the current approximation of the cycle.
+    gko::solver::initial_guess_mode const provided = gko::solver::initial_guess_mode::provided;
+    auto const build_smoother = [&](unsigned int iterations) {
+        auto iterations_criterion
+                = gko::stop::Iteration::build().with_max_iters(iterations).on(gko_exec);
+        std::shared_ptr<gko::LinOpFactory const> smoother;
+        switch (settings.multigrid_smoother) {
+        case MultigridSmoother::Jacobi:
+            smoother = gko::solver::Ir<ValueType>::build()
+                               .with_solver(
+                                       build_jacobi_preconditioner_factory<
+                                               ValueType>(gko_exec, settings))
+                               .with_relaxation_factor(
+                                       static_cast<ValueType>(settings.multigrid_relaxation_factor))
+                               .with_criteria(std::move(iterations_criterion))
+                               .with_default_initial_guess(provided)
+                               .on(gko_exec);
+            break;
+        case MultigridSmoother::SymmetricGaussSeidel:
+            smoother = gko::solver::Ir<ValueType>::build()
+                               .with_solver(
+                                       gko::preconditioner::GaussSeidel<ValueType, gko::int32>::
+                                               build()
+                                                       .with_symmetric(true)
+                                                       .on(gko_exec))
+                               .with_criteria(std::move(iterations_criterion))
+                               .with_default_initial_guess(provided)
+                               .on(gko_exec);
+            break;
+        case MultigridSmoother::Chebyshev:
+            smoother = gko::solver::Chebyshev<ValueType>::build()
+                               .with_preconditioner(
+                                       build_jacobi_preconditioner_factory<
+                                               ValueType>(gko_exec, settings))
+                               .with_foci(
+                                       settings.chebyshev_lower_bound,
+                                       settings.chebyshev_upper_bound)
+                               .with_criteria(std::move(iterations_criterion))
+                               .with_default_initial_guess(provided)
+                               .on(gko_exec);
+            break;
+        }
+        return smoother;
+    };
+    unsigned int const coarse_iterations = std::max(1U, settings.multigrid_coarse_iterations);
+    std::shared_ptr<gko::LinOpFactory const> coarse_solver;
+    if (settings.multigrid_coarse_solver == MultigridCoarseSolver::Cg) {
+        coarse_solver = gko::solver::Cg<ValueType>::build()
+                                .with_preconditioner(
+                                        build_jacobi_preconditioner_factory<
+                                                ValueType>(gko_exec, settings))
+                                .with_criteria(
+                                        gko::stop::Iteration::build()
+                                                .with_max_iters(coarse_iterations)
+                                                .on(gko_exec))
+                                .on(gko_exec);
+    } else {
+        coarse_solver = build_smoother(coarse_iterations);
+    }
+    return gko::solver::Multigrid::build()
+            .with_mg_level(gko::multigrid::Pgm<ValueType, gko::int32>::build()
+                                   .with_deterministic(true)
+                                   .on(gko_exec))
+            .with_pre_smoother(build_smoother(std::max(1U, settings.multigrid_smoothing_steps)))
+            .with_post_uses_pre(true)
+            .with_coarsest_solver(coarse_solver)
+            .with_max_levels(settings.multigrid_max_levels)
+            .with_min_coarse_rows(settings.multigrid_coarse_size)
+            .with_cycle(
+                    settings.multigrid_cycle == MultigridCycle::W
+                            ? gko::solver::multigrid::cycle::w
+                            : gko::solver::multigrid::cycle::v)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(1U).on(gko_exec))
+            .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
+            .on(gko_exec);
+}
+
+/*
+ * Factory of the algebraic preconditioner selected by settings (nullptr for the identity). It can
+ * be kept to regenerate the preconditioner of matrices sharing a sparsity pattern. ValueType is the
+ * precision of the matrix and of the preconditioner.
+ */
+template <class ValueType = double>
+std::shared_ptr<gko::LinOpFactory const> build_preconditioner_factory(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        StrongFormulationSolverSettings const& settings)
+{
+    PreconditionerType const preconditioner = selected_preconditioner(settings);
+    std::cout << "SimiLie Ginkgo preconditioner: " << preconditioner_name(preconditioner) << '\n';
+    switch (preconditioner) {
+    case PreconditionerType::Identity:
+        return nullptr;
+    case PreconditionerType::Jacobi:
+        return build_jacobi_preconditioner_factory<ValueType>(gko_exec, settings);
+    case PreconditionerType::SpdIsai:
+        return gko::preconditioner::SpdIsai<ValueType, gko::int32>::build().on(gko_exec);
+    case PreconditionerType::GeneralIsai:
+        return gko::preconditioner::GeneralIsai<ValueType, gko::int32>::build().on(gko_exec);
+    case PreconditionerType::SymmetricGaussSeidel:
+        return gko::preconditioner::GaussSeidel<ValueType, gko::int32>::build()
+                .with_symmetric(true)
+                .on(gko_exec);
+    case PreconditionerType::Ssor:
+        return gko::preconditioner::Sor<ValueType, gko::int32>::build()
+                .with_symmetric(true)
+                .with_relaxation_factor(env_double_or(
+                        "SIMILIE_SOR_RELAXATION_FACTOR",
+                        settings.sor_relaxation_factor))
+                .on(gko_exec);
+    case PreconditionerType::ChebyshevJacobi: {
+        auto jacobi_factory = build_jacobi_preconditioner_factory<ValueType>(gko_exec, settings);
+        auto iterations_criterion = gko::stop::Iteration::build()
+                                            .with_max_iters(settings.chebyshev_iterations)
+                                            .on(gko_exec);
+        auto preconditioner_factory
+                = gko::solver::Chebyshev<ValueType>::build()
+                          .with_criteria(std::move(iterations_criterion))
+                          .with_preconditioner(std::move(jacobi_factory))
+                          .with_foci(settings.chebyshev_lower_bound, settings.chebyshev_upper_bound)
+                          .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
+                          .on(gko_exec);
+        return preconditioner_factory;
+    }
+    case PreconditionerType::IrJacobi: {
+        auto jacobi_factory = build_jacobi_preconditioner_factory<ValueType>(gko_exec, settings);
+        auto iterations_criterion
+                = gko::stop::Iteration::build().with_max_iters(settings.ir_iterations).on(gko_exec);
+        auto preconditioner_factory
+                = gko::solver::Ir<ValueType>::build()
+                          .with_criteria(std::move(iterations_criterion))
+                          .with_solver(std::move(jacobi_factory))
+                          .with_relaxation_factor(settings.ir_relaxation_factor)
+                          .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
+                          .on(gko_exec);
+        return preconditioner_factory;
+    }
+    case PreconditionerType::AlgebraicMultigrid:
+        return build_algebraic_multigrid_factory<ValueType>(gko_exec, settings);
+    case PreconditionerType::Fourier:
+        throw std::runtime_error(
+                "the Fourier preconditioner is only available for linear operator models");
+    case PreconditionerType::GeometricMultigrid:
+        throw std::runtime_error(
+                "the geometric multigrid preconditioner is only available for linear operator "
+                "models");
+    }
+    throw std::runtime_error("unsupported strong-formulation preconditioner");
+}
+
+// ValueType is the precision of matrix and of the identity returned without factory.
+template <class ValueType = double>
+std::shared_ptr<gko::LinOp const> generate_preconditioner(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        std::shared_ptr<gko::LinOpFactory const> const& preconditioner_factory,
+        std::shared_ptr<gko::LinOp const> const& matrix)
+{
+    if (preconditioner_factory == nullptr) {
+        return build_identity_preconditioner<ValueType>(gko_exec, matrix->get_size()[0]);
+    }
+    return std::shared_ptr<gko::LinOp const>(preconditioner_factory->generate(matrix).release());
+}
+
+inline std::shared_ptr<gko::LinOp const> build_preconditioner(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        std::shared_ptr<gko::LinOp const> const& matrix,
+        StrongFormulationSolverSettings const& settings)
+{
+    return generate_preconditioner(
+            gko_exec,
+            build_preconditioner_factory(gko_exec, settings),
+            matrix);
+}
+
+/*
+ * Factory of the Krylov solver selected by SIMILIE_SOLVER (minres, fcg, gmres, bicgstab, gcr, idr,
+ * or cg), default_solver otherwise, stopping on the relative residual or the iteration limit of
+ * settings. SIMILIE_SOLVER=mixed only selects the refinement of linear sessions (see
+ * mixed_precision_selected) and falls back to default_solver here.
+ */
+inline std::unique_ptr<gko::LinOpFactory> build_krylov_solver_factory(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        StrongFormulationSolverSettings const& settings,
+        std::shared_ptr<gko::LinOp const> const& preconditioner,
+        std::string_view default_solver = "cg")
+{
+    char const* const selected_solver = std::getenv("SIMILIE_SOLVER");
+    std::string_view solver
+            = selected_solver == nullptr || selected_solver[0] == '\0' ? default_solver
+                                                                        : selected_solver;
+    if (solver == "mixed") {
+        std::cout << "SimiLie Ginkgo solver: mixed precision is only used by linear solves, using "
+                  << default_solver << '\n';
+        solver = default_solver;
     }
-    auto const solver_factory_start = std::chrono::steady_clock::now();
     auto residual_criterion = gko::stop::ResidualNorm<double>::build()
                                       .with_reduction_factor(settings.relative_tolerance)
                                       .on(gko_exec);
     auto iterations_criterion
             = gko::stop::Iteration::build().with_max_iters(settings.max_iterations).on(gko_exec);
     std::unique_ptr<gko::LinOpFactory> solver_factory;
-    if (detail::env_value_equals("SIMILIE_SOLVER", "minres")) {
+    if (solver == "minres") {
         solver_factory = gko::solver::Minres<double>::build()
                                  .with_generated_preconditioner(preconditioner)
                                  .with_criteria(
                                          std::move(residual_criterion),
                                          std::move(iterations_criterion))
                                  .on(gko_exec);
-    } else if (detail::env_value_equals("SIMILIE_SOLVER", "fcg")) {
+    } else if (solver == "fcg") {
         solver_factory = gko::solver::Fcg<double>::build()
                                  .with_generated_preconditioner(preconditioner)
                                  .with_criteria(
                                          std::move(residual_criterion),
                                          std::move(iterations_criterion))
                                  .on(gko_exec);
-    } else if (detail::env_value_equals("SIMILIE_SOLVER", "gmres")) {
+    } else if (solver == "gmres") {
         solver_factory = gko::solver::Gmres<double>::build()
                                  .with_generated_preconditioner(preconditioner)
                                  .with_criteria(
@@ -1090,14 +2090,14 @@ StrongFormulationSolverDiagnostics solve_linearized_system(
                                          static_cast<gko::size_type>(
                                                  env_int_or("SIMILIE_GMRES_KRYLOV_DIM", 100)))
                                  .on(gko_exec);
-    } else if (detail::env_value_equals("SIMILIE_SOLVER", "bicgstab")) {
+    } else if (solver == "bicgstab") {
         solver_factory = gko::solver::Bicgstab<double>::build()
                                  .with_generated_preconditioner(preconditioner)
                                  .with_criteria(
                                          std::move(residual_criterion),
                                          std::move(iterations_criterion))
                                  .on(gko_exec);
-    } else if (detail::env_value_equals("SIMILIE_SOLVER", "gcr")) {
+    } else if (solver == "gcr") {
         solver_factory
                 = gko::solver::Gcr<double>::build()
                           .with_generated_preconditioner(preconditioner)
@@ -1108,7 +2108,7 @@ StrongFormulationSolverDiagnostics solve_linearized_system(
                                   static_cast<gko::size_type>(
                                           std::max(1, env_int_or("SIMILIE_GCR_KRYLOV_DIM", 100))))
                           .on(gko_exec);
-    } else if (detail::env_value_equals("SIMILIE_SOLVER", "idr")) {
+    } else if (solver == "idr") {
         solver_factory
                 = gko::solver::Idr<double>::build()
                           .with_generated_preconditioner(preconditioner)
@@ -1121,13 +2121,282 @@ StrongFormulationSolverDiagnostics solve_linearized_system(
                           .with_deterministic(true)
                           .on(gko_exec);
     } else {
-        solver_factory = gko::solver::Cg<double>::build()
-                                 .with_generated_preconditioner(preconditioner)
-                                 .with_criteria(
-                                         std::move(residual_criterion),
-                                         std::move(iterations_criterion))
-                                 .on(gko_exec);
+        solver_factory = gko::solver::Cg<double>::build()
+                                 .with_generated_preconditioner(preconditioner)
+                                 .with_criteria(
+                                         std::move(residual_criterion),
+                                         std::move(iterations_criterion))
+                                 .on(gko_exec);
+    }
+    return solver_factory;
+}
+
+inline bool mixed_precision_selected(StrongFormulationSolverSettings const& settings)
+{
+    return settings.use_mixed_precision || env_value_equals("SIMILIE_SOLVER", "mixed");
+}
+
+// Single-precision copy of an assembled CSR matrix, converted on its executor.
+inline std::shared_ptr<gko::LinOp const> convert_to_single_precision(
+        std::shared_ptr<gko::LinOp const> const& matrix)
+{
+    auto const csr = std::dynamic_pointer_cast<gko::matrix::Csr<double, gko::int32> const>(matrix);
+    if (csr == nullptr) {
+        throw std::runtime_error("the mixed-precision solver requires an assembled CSR matrix");
+    }
+    auto single_precision_csr = gko::matrix::Csr<float, gko::int32>::create(csr->get_executor());
+    csr->convert_to(single_precision_csr.get());
+    return single_precision_csr;
+}
+
+/*
+ * Iterative refinement of the solutions of system_matrix, the residuals being computed in double
+ * precision, around a single-precision CG solve of single_precision_matrix preconditioned by
+ * single_precision_preconditioner. The refinement stops on the relative residual or the iteration
+ * limit of settings, so the final accuracy is that of a double-precision solve.
+ */
+inline std::unique_ptr<gko::LinOp> build_mixed_precision_solver(
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        StrongFormulationSolverSettings const& settings,
+        std::shared_ptr<gko::LinOp const> const& system_matrix,
+        std::shared_ptr<gko::LinOp const> const& single_precision_matrix,
+        std::shared_ptr<gko::LinOp const> const& single_precision_preconditioner)
+{
+    auto inner_residual_criterion
+            = gko::stop::ResidualNorm<float>::build()
+                      .with_reduction_factor(
+                              static_cast<float>(settings.mixed_precision_inner_reduction))
+                      .on(gko_exec);
+    auto inner_iterations_criterion
+            = gko::stop::Iteration::build().with_max_iters(settings.max_iterations).on(gko_exec);
+    std::shared_ptr<gko::LinOp const> const inner_solver
+            = gko::solver::Cg<float>::build()
+                      .with_generated_preconditioner(single_precision_preconditioner)
+                      .with_criteria(
+                              std::move(inner_residual_criterion),
+                              std::move(inner_iterations_criterion))
+                      .on(gko_exec)
+                      ->generate(single_precision_matrix);
+    auto residual_criterion = gko::stop::ResidualNorm<double>::build()
+                                      .with_reduction_factor(settings.relative_tolerance)
+                                      .on(gko_exec);
+    auto iterations_criterion
+            = gko::stop::Iteration::build().with_max_iters(settings.max_iterations).on(gko_exec);
+    return gko::solver::Ir<double>::build()
+            .with_generated_solver(inner_solver)
+            .with_criteria(std::move(residual_criterion), std::move(iterations_criterion))
+            .on(gko_exec)
+            ->generate(system_matrix);
+}
+
+/*
+ * Applies a generated Krylov solver and fills the iteration count and residuals of diagnostics,
+ * whose initial_residual_l2 must be set. The solution is zeroed first unless warm_start is set.
+ */
+template <class ExecSpace, class RHSViewType, class SolutionViewType>
+void apply_krylov_solver(
+        ExecSpace exec_space,
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        gko::LinOp& solver,
+        RHSViewType rhs,
+        SolutionViewType solution,
+        StrongFormulationSolverDiagnostics& diagnostics,
+        bool warm_start = false)
+{
+    auto convergence_logger = std::shared_ptr<gko::log::Convergence<double>>(
+            gko::log::Convergence<double>::create().release());
+    solver.add_logger(convergence_logger);
+    std::shared_ptr<SolverProgressLogger> progress_logger;
+    if (unsigned int const progress_stride = solver_progress_stride(); progress_stride != 0U) {
+        progress_logger = std::make_shared<SolverProgressLogger>(
+                gko_exec->get_master(),
+                diagnostics.initial_residual_l2,
+                progress_stride);
+        solver.add_logger(progress_logger);
+    }
+
+    if (!warm_start) {
+        fill(exec_space, solution, 0.0);
+    }
+    auto rhs_gko = to_gko_dense(gko_exec, rhs);
+    auto solution_gko = to_gko_dense(gko_exec, solution);
+    auto const optimization_start = std::chrono::steady_clock::now();
+    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
+        std::cout << "SimiLie linear solve stage: applying solver" << std::endl;
+    }
+    solver.apply(rhs_gko.dense, solution_gko.dense);
+    gko_exec->synchronize();
+    copy_back_from_gko_dense_bridge(solution, solution_gko);
+    auto const optimization_end = std::chrono::steady_clock::now();
+    diagnostics.duration
+            = std::chrono::duration<double>(optimization_end - optimization_start).count();
+    if (progress_logger != nullptr) {
+        solver.remove_logger(progress_logger);
+    }
+    solver.remove_logger(convergence_logger);
+    diagnostics.iterations = static_cast<unsigned int>(convergence_logger->get_num_iterations());
+    diagnostics.converged = convergence_logger->has_converged();
+    auto residual_norm_dense = dynamic_cast<gko::matrix::Dense<double> const*>(
+            convergence_logger->get_residual_norm());
+    if (residual_norm_dense != nullptr) {
+        auto host_dense = gko::matrix::Dense<
+                double>::create(gko_exec->get_master(), residual_norm_dense->get_size());
+        residual_norm_dense->convert_to(host_dense.get());
+        diagnostics.final_residual_l2 = host_dense->at(0, 0);
+    }
+    diagnostics.final_relative_residual
+            = diagnostics.initial_residual_l2 == 0.0
+                      ? 0.0
+                      : diagnostics.final_residual_l2 / diagnostics.initial_residual_l2;
+}
+
+// Compares the matrix-free and assembled applications of the system matrix on a probe vector.
+template <class ExecSpace, class RHSViewType>
+void log_matrix_free_apply_comparison(
+        ExecSpace exec_space,
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        gko::LinOp const& matrix_free_matrix,
+        gko::LinOp const& assembled_matrix,
+        RHSViewType rhs)
+{
+    using memory_space = typename RHSViewType::memory_space;
+    Kokkos::View<double**, memory_space> matrix_free_applied(
+            "similie_compare_matrix_free_applied",
+            rhs.extent(0),
+            rhs.extent(1));
+    Kokkos::View<double**, memory_space> assembled_applied(
+            "similie_compare_assembled_applied",
+            rhs.extent(0),
+            rhs.extent(1));
+    Kokkos::View<double**, memory_space>
+            difference("similie_compare_apply_difference", rhs.extent(0), rhs.extent(1));
+    auto probe_gko = to_gko_dense(gko_exec, rhs);
+    auto matrix_free_applied_gko = to_gko_dense(gko_exec, matrix_free_applied);
+    auto assembled_applied_gko = to_gko_dense(gko_exec, assembled_applied);
+    matrix_free_matrix.apply(probe_gko.dense, matrix_free_applied_gko.dense);
+    assembled_matrix.apply(probe_gko.dense, assembled_applied_gko.dense);
+    gko_exec->synchronize();
+    copy_back_from_gko_dense_bridge(matrix_free_applied, matrix_free_applied_gko);
+    copy_back_from_gko_dense_bridge(assembled_applied, assembled_applied_gko);
+    copy_axpy(exec_space, difference, matrix_free_applied, -1.0, assembled_applied);
+    std::array<double, 2> const squared_norms = multi_dot(
+            exec_space,
+            Kokkos::Array<decltype(difference), 2> {difference, assembled_applied},
+            Kokkos::Array<decltype(difference), 2> {difference, assembled_applied});
+    double const difference_norm = std::sqrt(squared_norms[0]);
+    double const assembled_norm = std::sqrt(squared_norms[1]);
+    std::cout << "SimiLie matrix-free apply comparison: difference_l2=" << difference_norm
+              << " assembled_l2=" << assembled_norm << " relative_difference="
+              << (assembled_norm == 0.0 ? 0.0 : difference_norm / assembled_norm) << '\n';
+    if (rhs.extent(1) == 1 && rhs.extent(0) % 3 == 0) {
+        auto const difference_host
+                = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), difference);
+        auto const assembled_host
+                = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), assembled_applied);
+        std::array<double, 3> component_difference_norms {};
+        std::array<double, 3> component_assembled_norms {};
+        for (std::size_t row = 0; row < rhs.extent(0); ++row) {
+            std::size_t const component = row % 3;
+            component_difference_norms[component]
+                    += difference_host(row, 0) * difference_host(row, 0);
+            component_assembled_norms[component]
+                    += assembled_host(row, 0) * assembled_host(row, 0);
+        }
+        std::cout << "SimiLie matrix-free apply component comparison:";
+        for (std::size_t component = 0; component < 3; ++component) {
+            double const component_difference
+                    = std::sqrt(component_difference_norms[component]);
+            double const component_assembled = std::sqrt(component_assembled_norms[component]);
+            std::cout << " component" << component << "_difference_l2=" << component_difference
+                      << " component" << component << "_relative_difference="
+                      << (component_assembled == 0.0
+                                  ? 0.0
+                                  : component_difference / component_assembled);
+        }
+        std::cout << '\n';
+    }
+}
+
+/*
+ * Recomputes the residual of the solution with the operator (through the matrix-free LinOp if
+ * given), independently of the residual estimated by the Krylov solver.
+ */
+template <
+        class ExecSpace,
+        class OperatorModel,
+        class MatrixFreeMatrix,
+        class RHSViewType,
+        class SolutionViewType>
+void log_true_residual(
+        ExecSpace exec_space,
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        OperatorModel const& operator_model,
+        MatrixFreeMatrix const* matrix_free_matrix,
+        RHSViewType rhs,
+        SolutionViewType solution,
+        StrongFormulationSolverDiagnostics const& diagnostics)
+{
+    using memory_space = typename SolutionViewType::memory_space;
+    Kokkos::View<double**, memory_space>
+            applied("similie_true_residual_applied", rhs.extent(0), rhs.extent(1));
+    Kokkos::View<double**, memory_space>
+            true_residual("similie_true_residual", rhs.extent(0), rhs.extent(1));
+    if (matrix_free_matrix != nullptr) {
+        auto solution_gko_for_residual = to_gko_dense(gko_exec, solution);
+        auto applied_gko_for_residual = to_gko_dense(gko_exec, applied);
+        matrix_free_matrix->apply(solution_gko_for_residual.dense, applied_gko_for_residual.dense);
+        gko_exec->synchronize();
+        copy_back_from_gko_dense_bridge(applied, applied_gko_for_residual);
+    } else {
+        operator_model.apply(exec_space, solution, applied);
+    }
+    double const true_residual_l2
+            = axpby_and_norm(exec_space, true_residual, 1.0, rhs, -1.0, applied);
+    double const true_relative_residual
+            = diagnostics.initial_residual_l2 == 0.0
+                      ? 0.0
+                      : true_residual_l2 / diagnostics.initial_residual_l2;
+    std::cout << "SimiLie true residual diagnostics: residual_l2=" << true_residual_l2
+              << " relative_residual=" << true_relative_residual << '\n';
+}
+
+template <class ExecSpace, class OperatorModel, class RHSViewType, class SolutionViewType>
+StrongFormulationSolverDiagnostics solve_linearized_system(
+        ExecSpace exec_space,
+        std::shared_ptr<gko::Executor const> const& gko_exec,
+        OperatorModel const& operator_model,
+        RHSViewType rhs,
+        SolutionViewType solution,
+        StrongFormulationSolverSettings const& settings,
+        std::shared_ptr<gko::LinOp const> const& assembled_matrix,
+        std::shared_ptr<gko::LinOp const> const& preconditioner)
+{
+    StrongFormulationSolverDiagnostics diagnostics;
+    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
+        std::cout << "SimiLie linear solve stage: computing initial residual norm" << std::endl;
+    }
+    auto const initial_residual_start = std::chrono::steady_clock::now();
+    diagnostics.initial_residual_l2 = residual_norm_l2(exec_space, rhs);
+    auto const initial_residual_end = std::chrono::steady_clock::now();
+    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
+        std::cout << "SimiLie linear solve stage: initial residual norm computed duration="
+                  << std::chrono::duration<double>(initial_residual_end - initial_residual_start)
+                             .count()
+                  << std::endl;
+    }
+    diagnostics.final_residual_l2 = diagnostics.initial_residual_l2;
+    diagnostics.final_relative_residual = diagnostics.initial_residual_l2 == 0.0 ? 0.0 : 1.0;
+    if (diagnostics.initial_residual_l2 == 0.0) {
+        fill(exec_space, solution, 0.0);
+        return diagnostics;
+    }
+
+    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
+        std::cout << "SimiLie linear solve stage: building solver factory" << std::endl;
     }
+    auto const solver_factory_start = std::chrono::steady_clock::now();
+    std::unique_ptr<gko::LinOpFactory> const solver_factory
+            = build_krylov_solver_factory(gko_exec, settings, preconditioner);
     auto const solver_factory_end = std::chrono::steady_clock::now();
     if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
         std::cout << "SimiLie linear solve stage: solver factory built duration="
@@ -1158,63 +2427,16 @@ StrongFormulationSolverDiagnostics solve_linearized_system(
         }
         system_matrix = matrix_free_system_matrix;
     } else {
-        system_matrix = assembled_matrix;
+        system_matrix = convert_matrix_format(assembled_matrix, settings);
     }
-    if (settings.use_matrix_free && matrix_free_system_matrix != nullptr
-        && assembled_matrix != nullptr && env_flag_enabled("SIMILIE_COMPARE_MATRIX_FREE_APPLY")) {
-        using memory_space = typename RHSViewType::memory_space;
-        Kokkos::View<double**, memory_space> matrix_free_applied(
-                "similie_compare_matrix_free_applied",
-                rhs.extent(0),
-                rhs.extent(1));
-        Kokkos::View<double**, memory_space> assembled_applied(
-                "similie_compare_assembled_applied",
-                rhs.extent(0),
-                rhs.extent(1));
-        Kokkos::View<double**, memory_space>
-                difference("similie_compare_apply_difference", rhs.extent(0), rhs.extent(1));
-        auto probe_gko = to_gko_dense(gko_exec, rhs);
-        auto matrix_free_applied_gko = to_gko_dense(gko_exec, matrix_free_applied);
-        auto assembled_applied_gko = to_gko_dense(gko_exec, assembled_applied);
-        matrix_free_system_matrix->apply(probe_gko.dense, matrix_free_applied_gko.dense);
-        assembled_matrix->apply(probe_gko.dense, assembled_applied_gko.dense);
-        gko_exec->synchronize();
-        copy_back_from_gko_dense_bridge(matrix_free_applied, matrix_free_applied_gko);
-        copy_back_from_gko_dense_bridge(assembled_applied, assembled_applied_gko);
-        copy(exec_space, difference, matrix_free_applied);
-        axpy_inplace(exec_space, difference, -1.0, assembled_applied);
-        double const difference_norm = residual_norm_l2(exec_space, difference);
-        double const assembled_norm = residual_norm_l2(exec_space, assembled_applied);
-        std::cout << "SimiLie matrix-free apply comparison: difference_l2=" << difference_norm
-                  << " assembled_l2=" << assembled_norm << " relative_difference="
-                  << (assembled_norm == 0.0 ? 0.0 : difference_norm / assembled_norm) << '\n';
-        if (rhs.extent(1) == 1 && rhs.extent(0) % 3 == 0) {
-            auto const difference_host
-                    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), difference);
-            auto const assembled_host
-                    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), assembled_applied);
-            std::array<double, 3> component_difference_norms {};
-            std::array<double, 3> component_assembled_norms {};
-            for (std::size_t row = 0; row < rhs.extent(0); ++row) {
-                std::size_t const component = row % 3;
-                component_difference_norms[component]
-                        += difference_host(row, 0) * difference_host(row, 0);
-                component_assembled_norms[component]
-                        += assembled_host(row, 0) * assembled_host(row, 0);
-            }
-            std::cout << "SimiLie matrix-free apply component comparison:";
-            for (std::size_t component = 0; component < 3; ++component) {
-                double const component_difference
-                        = std::sqrt(component_difference_norms[component]);
-                double const component_assembled = std::sqrt(component_assembled_norms[component]);
-                std::cout << " component" << component << "_difference_l2=" << component_difference
-                          << " component" << component << "_relative_difference="
-                          << (component_assembled == 0.0
-                                      ? 0.0
-                                      : component_difference / component_assembled);
-            }
-            std::cout << '\n';
-        }
+    if (settings.use_matrix_free && assembled_matrix != nullptr
+        && env_flag_enabled("SIMILIE_COMPARE_MATRIX_FREE_APPLY")) {
+        log_matrix_free_apply_comparison(
+                exec_space,
+                gko_exec,
+                *matrix_free_system_matrix,
+                *assembled_matrix,
+                rhs);
     }
     if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
         std::cout << "SimiLie linear solve stage: generating solver" << std::endl;
@@ -1228,138 +2450,129 @@ StrongFormulationSolverDiagnostics solve_linearized_system(
                              .count()
                   << std::endl;
     }
-    auto convergence_logger = std::shared_ptr<gko::log::Convergence<double>>(
-            gko::log::Convergence<double>::create().release());
-    solver->add_logger(convergence_logger);
-    std::shared_ptr<SolverProgressLogger> progress_logger;
-    if (unsigned int const progress_stride = solver_progress_stride(); progress_stride != 0U) {
-        progress_logger = std::make_shared<SolverProgressLogger>(
-                gko_exec->get_master(),
-                diagnostics.initial_residual_l2,
-                progress_stride);
-        solver->add_logger(progress_logger);
-    }
-
-    fill(exec_space, solution, 0.0);
-    auto rhs_gko = to_gko_dense(gko_exec, rhs);
-    auto solution_gko = to_gko_dense(gko_exec, solution);
-    auto const optimization_start = std::chrono::steady_clock::now();
-    if (env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
-        std::cout << "SimiLie linear solve stage: applying solver" << std::endl;
-    }
-    solver->apply(rhs_gko.dense, solution_gko.dense);
-    gko_exec->synchronize();
-    copy_back_from_gko_dense_bridge(solution, solution_gko);
-    auto const optimization_end = std::chrono::steady_clock::now();
-    diagnostics.duration
-            = std::chrono::duration<double>(optimization_end - optimization_start).count();
+    apply_krylov_solver(exec_space, gko_exec, *solver, rhs, solution, diagnostics);
     if (matrix_free_system_matrix != nullptr) {
         matrix_free_system_matrix->log_timing();
     }
-    if (progress_logger != nullptr) {
-        solver->remove_logger(progress_logger);
-    }
-    solver->remove_logger(convergence_logger);
-    diagnostics.iterations = static_cast<unsigned int>(convergence_logger->get_num_iterations());
-    diagnostics.converged = convergence_logger->has_converged();
-    auto residual_norm_dense = dynamic_cast<gko::matrix::Dense<double> const*>(
-            convergence_logger->get_residual_norm());
-    if (residual_norm_dense != nullptr) {
-        auto host_dense = gko::matrix::Dense<
-                double>::create(gko_exec->get_master(), residual_norm_dense->get_size());
-        residual_norm_dense->convert_to(host_dense.get());
-        diagnostics.final_residual_l2 = host_dense->at(0, 0);
-    }
-    diagnostics.final_relative_residual
-            = diagnostics.initial_residual_l2 == 0.0
-                      ? 0.0
-                      : diagnostics.final_residual_l2 / diagnostics.initial_residual_l2;
     if (env_flag_enabled("SIMILIE_TRUE_RESIDUAL_DIAGNOSTICS")) {
-        using memory_space = typename SolutionViewType::memory_space;
-        Kokkos::View<double**, memory_space>
-                applied("similie_true_residual_applied", rhs.extent(0), rhs.extent(1));
-        Kokkos::View<double**, memory_space>
-                true_residual("similie_true_residual", rhs.extent(0), rhs.extent(1));
-        if (settings.use_matrix_free && matrix_free_system_matrix != nullptr) {
-            auto solution_gko_for_residual = to_gko_dense(gko_exec, solution);
-            auto applied_gko_for_residual = to_gko_dense(gko_exec, applied);
-            matrix_free_system_matrix
-                    ->apply(solution_gko_for_residual.dense, applied_gko_for_residual.dense);
-            gko_exec->synchronize();
-            copy_back_from_gko_dense_bridge(applied, applied_gko_for_residual);
-        } else {
-            operator_model.apply(exec_space, solution, applied);
-        }
-        copy(exec_space, true_residual, rhs);
-        axpy_inplace(exec_space, true_residual, -1.0, applied);
-        double const true_residual_l2 = residual_norm_l2(exec_space, true_residual);
-        double const true_relative_residual
-                = diagnostics.initial_residual_l2 == 0.0
-                          ? 0.0
-                          : true_residual_l2 / diagnostics.initial_residual_l2;
-        std::cout << "SimiLie true residual diagnostics: residual_l2=" << true_residual_l2
-                  << " relative_residual=" << true_relative_residual << '\n';
+        log_true_residual(
+                exec_space,
+                gko_exec,
+                operator_model,
+                matrix_free_system_matrix.get(),
+                rhs,
+                solution,
+                diagnostics);
     }
     return diagnostics;
 }
 
 } // namespace detail
 
-template <class ExecSpace, class OperatorModel, class RHSViewType, class SolutionViewType>
-StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
-        ExecSpace exec_space,
-        OperatorModel const& operator_model,
-        RHSViewType rhs,
-        SolutionViewType solution,
-        StrongFormulationSolverSettings settings = {})
+/*
+ * Solver session of a linear operator model. The Ginkgo executor, the system matrix (assembled
+ * and/or matrix-free), the preconditioner and the generated Krylov solver with its workspace are
+ * built once, so that repeated solves with new right-hand sides (parameter sweeps, time steps) only
+ * pay for the Krylov iterations. The operator model must outlive the session.
+ */
+template <class ExecSpace, class OperatorModel>
+class StrongFormulationSolver
 {
-    StrongFormulationSolverDiagnostics diagnostics;
+    static_assert(
+            OperatorModel::IS_LINEAR,
+            "StrongFormulationSolver requires a linear operator model");
 
-    detail::fill(exec_space, solution, 0.0);
-    auto const gko_exec = gko::ext::kokkos::create_executor(exec_space);
-    if constexpr (OperatorModel::IS_LINEAR) {
-        diagnostics.initial_residual_l2 = detail::residual_norm_l2(exec_space, rhs);
-        diagnostics.final_residual_l2 = diagnostics.initial_residual_l2;
-        diagnostics.final_relative_residual = diagnostics.initial_residual_l2 == 0.0 ? 0.0 : 1.0;
-        if (diagnostics.initial_residual_l2 == 0.0) {
-            return diagnostics;
-        }
+    ExecSpace m_exec_space;
+    std::shared_ptr<gko::Executor const> m_gko_exec;
+    OperatorModel const* m_operator_model;
+    StrongFormulationSolverSettings m_settings;
+    std::shared_ptr<gko::LinOp const> m_assembled_matrix;
+    std::shared_ptr<detail::MatrixFreeLinOp<ExecSpace, OperatorModel> const> m_matrix_free_matrix;
+    std::shared_ptr<gko::LinOp const> m_preconditioner;
+    std::shared_ptr<gko::LinOp> m_solver;
+
+public:
+    StrongFormulationSolver(
+            ExecSpace exec_space,
+            OperatorModel const& operator_model,
+            StrongFormulationSolverSettings settings = {})
+        : StrongFormulationSolver(
+                  exec_space,
+                  gko::ext::kokkos::create_executor(exec_space),
+                  operator_model,
+                  settings)
+    {
+    }
+
+    StrongFormulationSolver(
+            ExecSpace exec_space,
+            std::shared_ptr<gko::Executor const> gko_exec,
+            OperatorModel const& operator_model,
+            StrongFormulationSolverSettings settings = {})
+        : m_exec_space(exec_space)
+        , m_gko_exec(std::move(gko_exec))
+        , m_operator_model(&operator_model)
+        , m_settings(settings)
+    {
         auto const matrix_build_start = std::chrono::steady_clock::now();
-        std::shared_ptr<gko::matrix::Csr<double, gko::int32>> matrix;
-        auto const matrix_build_end = std::chrono::steady_clock::now();
-        std::shared_ptr<gko::LinOp const> preconditioner;
+        auto matrix_build_end = matrix_build_start;
         PreconditionerType const preconditioner_type = detail::selected_preconditioner(settings);
-        if (settings.use_matrix_free && preconditioner_type == PreconditionerType::Identity) {
+        bool const mixed_precision = detail::mixed_precision_selected(settings);
+        // The single-precision copies of the matrix and of the preconditioner of the inner solves.
+        std::shared_ptr<gko::LinOp const> single_precision_matrix;
+        if (mixed_precision) {
+            if (preconditioner_type == PreconditionerType::Fourier
+                || preconditioner_type == PreconditionerType::GeometricMultigrid) {
+                throw std::runtime_error(
+                        "the mixed-precision solver requires an algebraic preconditioner");
+            }
+            std::cout << "SimiLie Ginkgo solver: mixed-precision iterative refinement\n";
+            // Matrix-free, the residuals of the refinement use the operator and the double
+            // precision matrix is not kept.
+            std::shared_ptr<gko::LinOp const> const matrix
+                    = detail::build_matrix(m_gko_exec, operator_model);
+            if (!settings.use_matrix_free) {
+                m_assembled_matrix = matrix;
+            }
+            matrix_build_end = std::chrono::steady_clock::now();
+            single_precision_matrix = detail::convert_to_single_precision(matrix);
+            m_preconditioner = detail::generate_preconditioner<float>(
+                    m_gko_exec,
+                    detail::build_preconditioner_factory<float>(m_gko_exec, settings),
+                    single_precision_matrix);
+            single_precision_matrix
+                    = detail::convert_matrix_format<float>(single_precision_matrix, settings);
+        } else if (
+                preconditioner_type == PreconditionerType::Fourier
+                || preconditioner_type == PreconditionerType::GeometricMultigrid
+                || (settings.use_matrix_free
+                    && preconditioner_type == PreconditionerType::Identity)) {
             std::cout << "SimiLie Ginkgo preconditioner: "
                       << preconditioner_name(preconditioner_type) << '\n';
-            preconditioner = detail::build_identity_preconditioner(gko_exec, operator_model.size());
-        } else {
-            matrix = detail::build_matrix(gko_exec, operator_model);
-            auto const actual_matrix_build_end = std::chrono::steady_clock::now();
-            preconditioner = detail::build_preconditioner(
-                    gko_exec,
-                    std::static_pointer_cast<gko::LinOp const>(matrix),
-                    settings);
-            if (detail::env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
-                std::cout << "SimiLie linear setup timing: matrix_build_duration="
-                          << std::chrono::duration<double>(
-                                     actual_matrix_build_end - matrix_build_start)
-                                     .count()
-                          << " preconditioner_build_duration="
-                          << std::chrono::duration<double>(
-                                     std::chrono::steady_clock::now() - actual_matrix_build_end)
-                                     .count()
-                          << '\n';
+            if (!settings.use_matrix_free) {
+                m_assembled_matrix = detail::build_matrix(m_gko_exec, operator_model);
             }
-            return detail::solve_linearized_system(
-                    exec_space,
-                    gko_exec,
-                    operator_model,
-                    rhs,
-                    solution,
-                    settings,
-                    std::static_pointer_cast<gko::LinOp const>(matrix),
-                    preconditioner);
+            matrix_build_end = std::chrono::steady_clock::now();
+            if (preconditioner_type == PreconditionerType::Fourier) {
+                m_preconditioner = detail::build_fourier_preconditioner(
+                        m_gko_exec,
+                        exec_space,
+                        operator_model);
+            } else if (preconditioner_type == PreconditionerType::GeometricMultigrid) {
+                m_preconditioner = detail::build_geometric_multigrid_preconditioner(
+                        m_gko_exec,
+                        exec_space,
+                        operator_model,
+                        settings);
+            } else {
+                m_preconditioner
+                        = detail::build_identity_preconditioner(m_gko_exec, operator_model.size());
+            }
+        } else {
+            m_assembled_matrix = detail::build_matrix(m_gko_exec, operator_model);
+            matrix_build_end = std::chrono::steady_clock::now();
+            m_preconditioner
+                    = detail::build_preconditioner(m_gko_exec, m_assembled_matrix, settings);
         }
         auto const preconditioner_build_end = std::chrono::steady_clock::now();
         if (detail::env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
@@ -1371,15 +2584,127 @@ StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
                                  .count()
                       << '\n';
         }
-        return detail::solve_linearized_system(
-                exec_space,
-                gko_exec,
-                operator_model,
+
+        std::shared_ptr<gko::LinOp const> system_matrix
+                = detail::convert_matrix_format(m_assembled_matrix, settings);
+        if (settings.use_matrix_free) {
+            m_matrix_free_matrix = std::make_shared<
+                    detail::MatrixFreeLinOp<ExecSpace, OperatorModel>>(
+                    m_gko_exec,
+                    exec_space,
+                    std::shared_ptr<OperatorModel const>(
+                            &operator_model,
+                            [](OperatorModel const*) {}));
+            system_matrix = m_matrix_free_matrix;
+        }
+        if (mixed_precision) {
+            m_solver = detail::build_mixed_precision_solver(
+                    m_gko_exec,
+                    settings,
+                    system_matrix,
+                    single_precision_matrix,
+                    m_preconditioner);
+        } else {
+            m_solver = std::shared_ptr<gko::LinOp>(
+                    detail::build_krylov_solver_factory(m_gko_exec, settings, m_preconditioner)
+                            ->generate(system_matrix)
+                            .release());
+        }
+    }
+
+    std::shared_ptr<gko::Executor const> const& gko_executor() const
+    {
+        return m_gko_exec;
+    }
+
+    // The assembled matrix, or nullptr if the solver never needed it.
+    std::shared_ptr<gko::LinOp const> const& assembled_matrix() const
+    {
+        return m_assembled_matrix;
+    }
+
+    std::shared_ptr<gko::LinOp const> const& preconditioner() const
+    {
+        return m_preconditioner;
+    }
+
+    /*
+     * Solves operator(solution) = rhs. With warm_start, the Krylov iterations start from the
+     * current content of solution instead of zero.
+     */
+    template <class RHSViewType, class SolutionViewType>
+    StrongFormulationSolverDiagnostics solve(
+            RHSViewType rhs,
+            SolutionViewType solution,
+            bool warm_start = false)
+    {
+        StrongFormulationSolverDiagnostics diagnostics;
+        diagnostics.initial_residual_l2 = detail::residual_norm_l2(m_exec_space, rhs);
+        diagnostics.final_residual_l2 = diagnostics.initial_residual_l2;
+        diagnostics.final_relative_residual = diagnostics.initial_residual_l2 == 0.0 ? 0.0 : 1.0;
+        if (diagnostics.initial_residual_l2 == 0.0) {
+            detail::fill(m_exec_space, solution, 0.0);
+            return diagnostics;
+        }
+        if (m_matrix_free_matrix != nullptr && m_assembled_matrix != nullptr
+            && detail::env_flag_enabled("SIMILIE_COMPARE_MATRIX_FREE_APPLY")) {
+            detail::log_matrix_free_apply_comparison(
+                    m_exec_space,
+                    m_gko_exec,
+                    *m_matrix_free_matrix,
+                    *m_assembled_matrix,
+                    rhs);
+        }
+        detail::apply_krylov_solver(
+                m_exec_space,
+                m_gko_exec,
+                *m_solver,
                 rhs,
                 solution,
-                settings,
-                std::static_pointer_cast<gko::LinOp const>(matrix),
-                preconditioner);
+                diagnostics,
+                warm_start);
+        if (m_matrix_free_matrix != nullptr) {
+            m_matrix_free_matrix->log_timing();
+        }
+        if (detail::env_flag_enabled("SIMILIE_TRUE_RESIDUAL_DIAGNOSTICS")) {
+            detail::log_true_residual(
+                    m_exec_space,
+                    m_gko_exec,
+                    *m_operator_model,
+                    m_matrix_free_matrix.get(),
+                    rhs,
+                    solution,
+                    diagnostics);
+        }
+        return diagnostics;
+    }
+};
+
+template <class ExecSpace, class OperatorModel, class RHSViewType, class SolutionViewType>
+StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
+        ExecSpace exec_space,
+        OperatorModel const& operator_model,
+        RHSViewType rhs,
+        SolutionViewType solution,
+        StrongFormulationSolverSettings settings = {})
+{
+    StrongFormulationSolverDiagnostics diagnostics;
+
+    if (!settings.use_initial_guess) {
+        detail::fill(exec_space, solution, 0.0);
+    }
+    auto const gko_exec = gko::ext::kokkos::create_executor(exec_space);
+    if constexpr (OperatorModel::IS_LINEAR) {
+        diagnostics.initial_residual_l2 = detail::residual_norm_l2(exec_space, rhs);
+        diagnostics.final_residual_l2 = diagnostics.initial_residual_l2;
+        diagnostics.final_relative_residual = diagnostics.initial_residual_l2 == 0.0 ? 0.0 : 1.0;
+        if (diagnostics.initial_residual_l2 == 0.0) {
+            detail::fill(exec_space, solution, 0.0);
+            return diagnostics;
+        }
+        StrongFormulationSolver<ExecSpace, OperatorModel>
+                solver(exec_space, gko_exec, operator_model, settings);
+        return solver.solve(rhs, solution, settings.use_initial_guess);
     } else {
         using memory_space = typename SolutionViewType::memory_space;
         Kokkos::View<double**, memory_space>
@@ -1402,13 +2727,24 @@ StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
                 "similie_nonlinear_candidate_operator_value",
                 rhs.extent(0),
                 rhs.extent(1));
+        // Best line-search candidate, exchanged with the trial buffers instead of recomputed.
+        Kokkos::View<double**, memory_space>
+                best_solution("similie_nonlinear_best_solution", rhs.extent(0), rhs.extent(1));
+        Kokkos::View<double**, memory_space>
+                best_residual("similie_nonlinear_best_residual", rhs.extent(0), rhs.extent(1));
+        Kokkos::View<double**, memory_space> best_operator_value(
+                "similie_nonlinear_best_operator_value",
+                rhs.extent(0),
+                rhs.extent(1));
         auto const optimization_start = std::chrono::steady_clock::now();
         diagnostics.converged = false;
+        if (settings.use_mixed_precision) {
+            std::cout << "SimiLie Ginkgo solver: mixed precision is only used by linear solves\n";
+        }
 
         operator_model.apply(exec_space, solution, operator_value);
-        detail::copy(exec_space, residual, rhs);
-        detail::axpy_inplace(exec_space, residual, -1.0, operator_value);
-        diagnostics.initial_residual_l2 = detail::residual_norm_l2(exec_space, residual);
+        diagnostics.initial_residual_l2 = detail::
+                axpby_and_norm(exec_space, residual, 1.0, rhs, -1.0, operator_value);
         diagnostics.final_residual_l2 = diagnostics.initial_residual_l2;
         diagnostics.final_relative_residual = diagnostics.initial_residual_l2 == 0.0 ? 0.0 : 1.0;
         if (diagnostics.initial_residual_l2 == 0.0) {
@@ -1416,9 +2752,52 @@ StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
             return diagnostics;
         }
 
+        // The sparsity pattern of the Jacobian and the preconditioner factory are kept across
+        // Newton iterations, only the values are refreshed.
+        std::shared_ptr<gko::matrix::Csr<double, gko::int32>> matrix;
+        std::shared_ptr<gko::LinOpFactory const> preconditioner_factory;
+        bool preconditioner_factory_built = false;
+        std::shared_ptr<gko::LinOp const> preconditioner;
+        unsigned int preconditioner_age = 0U;
+        // Inner Krylov iterations per decade of residual reduction, which does not depend on the
+        // forcing term.
+        double reference_inner_iteration_rate = 0.0;
+        double last_inner_iteration_rate = 0.0;
+        double forcing = settings.relative_tolerance;
+        double previous_residual_l2 = 0.0;
+        double previous_linear_residual_l2 = 0.0;
+        auto const operator_model_ptr = std::shared_ptr<
+                OperatorModel const>(&operator_model, [](OperatorModel const*) {});
+        using jacobian_free_type = detail::FiniteDifferenceJacobianLinOp<
+                ExecSpace,
+                OperatorModel,
+                SolutionViewType,
+                decltype(operator_value)>;
+        std::shared_ptr<jacobian_free_type> jacobian_free_matrix;
+        // Models without Jacobian hooks can only be solved in Jacobian-free mode.
+        constexpr bool has_jacobian = requires {
+            assemble_matrix_data(operator_model, solution);
+            apply_jacobian(exec_space, operator_model, solution, solution, solution);
+        };
+        bool const jacobian_free = !has_jacobian || settings.use_jacobian_free;
+        if (jacobian_free) {
+            jacobian_free_matrix = std::make_shared<jacobian_free_type>(
+                    gko_exec,
+                    exec_space,
+                    operator_model_ptr,
+                    solution,
+                    operator_value);
+            preconditioner = detail::build_jacobian_free_preconditioner(
+                    gko_exec,
+                    exec_space,
+                    operator_model,
+                    settings);
+            ++diagnostics.preconditioner_rebuilds;
+        }
         constexpr unsigned int NONLINEAR_MAX_ITERS = 30U;
+        double residual_l2 = diagnostics.initial_residual_l2;
         for (unsigned int iteration = 0; iteration < NONLINEAR_MAX_ITERS; ++iteration) {
-            diagnostics.final_residual_l2 = detail::residual_norm_l2(exec_space, residual);
+            diagnostics.final_residual_l2 = residual_l2;
             diagnostics.final_relative_residual
                     = diagnostics.initial_residual_l2 == 0.0
                               ? 0.0
@@ -1429,81 +2808,101 @@ StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
                 break;
             }
 
-            auto matrix = detail::build_matrix(gko_exec, operator_model, solution);
-            auto preconditioner = detail::build_preconditioner(
-                    gko_exec,
-                    std::static_pointer_cast<gko::LinOp const>(matrix),
-                    settings);
+            if (jacobian_free) {
+                jacobian_free_matrix->update_state(operator_value);
+            } else if constexpr (has_jacobian) {
+                matrix = detail::update_matrix(gko_exec, operator_model, solution, matrix);
+            }
+            if (!jacobian_free && !preconditioner_factory_built) {
+                preconditioner_factory = detail::build_preconditioner_factory(gko_exec, settings);
+                preconditioner_factory_built = true;
+            }
+            // The lagged preconditioner only slows the Krylov solve down, the Newton correction
+            // is still computed with the current Jacobian.
+            unsigned int const max_preconditioner_age
+                    = std::max(1U, settings.preconditioner_reuse_iterations);
+            bool const rebuild_preconditioner
+                    = !jacobian_free
+                      && (preconditioner == nullptr || preconditioner_age >= max_preconditioner_age
+                          || last_inner_iteration_rate
+                                     > (1.0 + settings.preconditioner_reuse_iterations_growth)
+                                               * reference_inner_iteration_rate);
+            if (rebuild_preconditioner) {
+                preconditioner = detail::generate_preconditioner(
+                        gko_exec,
+                        preconditioner_factory,
+                        std::static_pointer_cast<gko::LinOp const>(matrix));
+                preconditioner_age = 0U;
+                ++diagnostics.preconditioner_rebuilds;
+            }
+            ++preconditioner_age;
+
+            double const current_residual_l2 = diagnostics.final_residual_l2;
+            forcing = detail::newton_forcing_term(
+                    settings,
+                    iteration,
+                    diagnostics.initial_residual_l2,
+                    current_residual_l2,
+                    previous_residual_l2,
+                    previous_linear_residual_l2,
+                    forcing);
+            if (detail::solver_progress_enabled()) {
+                std::cout << "SimiLie nonlinear forcing: iteration=" << iteration
+                          << " forcing=" << forcing << std::endl;
+            }
+            StrongFormulationSolverSettings inner_settings = settings;
+            inner_settings.relative_tolerance = forcing;
+            StrongFormulationSolverDiagnostics inner;
+            inner.initial_residual_l2 = current_residual_l2;
 
             detail::copy(exec_space, correction_rhs, residual);
-            if (settings.use_matrix_free) {
-                using solver_type = gko::solver::Cg<double>;
-                auto residual_criterion
-                        = gko::stop::ResidualNorm<double>::build()
-                                  .with_reduction_factor(settings.relative_tolerance)
-                                  .on(gko_exec);
-                auto iterations_criterion = gko::stop::Iteration::build()
-                                                    .with_max_iters(settings.max_iterations)
-                                                    .on(gko_exec);
-                auto solver_factory = solver_type::build()
-                                              .with_generated_preconditioner(preconditioner)
-                                              .with_criteria(
-                                                      std::move(residual_criterion),
-                                                      std::move(iterations_criterion))
-                                              .on(gko_exec);
-                auto operator_model_ptr = std::shared_ptr<
-                        OperatorModel const>(&operator_model, [](OperatorModel const*) {});
-                auto system_matrix = std::shared_ptr<gko::LinOp const>(
-                        std::make_shared<detail::StateDependentMatrixFreeLinOp<
+            if (settings.use_matrix_free || jacobian_free) {
+                // The finite-difference Jacobian is not symmetric, so CG does not apply to it.
+                auto solver_factory = detail::build_krylov_solver_factory(
+                        gko_exec,
+                        inner_settings,
+                        preconditioner,
+                        jacobian_free ? "gmres" : "cg");
+                std::shared_ptr<gko::LinOp const> system_matrix = jacobian_free_matrix;
+                if constexpr (has_jacobian) {
+                    if (!jacobian_free) {
+                        system_matrix = std::make_shared<detail::StateDependentMatrixFreeLinOp<
                                 ExecSpace,
                                 OperatorModel,
                                 SolutionViewType>>(
                                 gko_exec,
                                 exec_space,
                                 operator_model_ptr,
-                                solution));
-                auto solver = solver_factory->generate(system_matrix);
-                auto convergence_logger = std::shared_ptr<gko::log::Convergence<double>>(
-                        gko::log::Convergence<double>::create().release());
-                solver->add_logger(convergence_logger);
-                std::shared_ptr<detail::SolverProgressLogger> progress_logger;
-                if (unsigned int const progress_stride = detail::solver_progress_stride();
-                    progress_stride != 0U) {
-                    progress_logger = std::make_shared<detail::SolverProgressLogger>(
-                            gko_exec->get_master(),
-                            detail::residual_norm_l2(exec_space, correction_rhs),
-                            progress_stride);
-                    solver->add_logger(progress_logger);
-                }
-                detail::fill(exec_space, delta, 0.0);
-                auto rhs_gko = detail::to_gko_dense(gko_exec, correction_rhs);
-                auto delta_gko = detail::to_gko_dense(gko_exec, delta);
-                if (detail::env_flag_enabled("SIMILIE_SOLVER_TIMING")) {
-                    std::cout << "SimiLie nonlinear linear solve stage: applying solver"
-                              << std::endl;
-                }
-                solver->apply(rhs_gko.dense, delta_gko.dense);
-                gko_exec->synchronize();
-                detail::copy_back_from_gko_dense_bridge(delta, delta_gko);
-                if (progress_logger != nullptr) {
-                    solver->remove_logger(progress_logger);
+                                solution);
+                    }
                 }
-                solver->remove_logger(convergence_logger);
-                diagnostics.iterations
-                        += static_cast<unsigned int>(convergence_logger->get_num_iterations());
+                auto solver = solver_factory->generate(system_matrix);
+                detail::apply_krylov_solver(
+                        exec_space,
+                        gko_exec,
+                        *solver,
+                        correction_rhs,
+                        delta,
+                        inner);
             } else {
-                auto inner = detail::solve_linearized_system(
+                inner = detail::solve_linearized_system(
                         exec_space,
                         gko_exec,
                         operator_model,
                         correction_rhs,
                         delta,
-                        settings,
+                        inner_settings,
                         std::static_pointer_cast<gko::LinOp const>(matrix),
                         preconditioner);
-                diagnostics.iterations += inner.iterations;
             }
-            double const current_residual_l2 = detail::residual_norm_l2(exec_space, residual);
+            diagnostics.iterations += inner.iterations;
+            last_inner_iteration_rate = static_cast<double>(inner.iterations)
+                                        / std::max(1.0, -std::log10(forcing));
+            if (rebuild_preconditioner) {
+                reference_inner_iteration_rate = last_inner_iteration_rate;
+            }
+            previous_residual_l2 = current_residual_l2;
+            previous_linear_residual_l2 = inner.final_residual_l2;
             double alpha = 1.0;
             double best_alpha = 0.0;
             double best_residual_l2 = std::numeric_limits<double>::infinity();
@@ -1515,52 +2914,48 @@ StrongFormulationSolverDiagnostics minimize_strong_formulation_residual(
                           0.99);
             for (unsigned int line_search_step = 0; line_search_step < max_line_search_steps;
                  ++line_search_step) {
-                detail::copy(exec_space, candidate_solution, solution);
-                detail::axpy_inplace(exec_space, candidate_solution, alpha, delta);
+                detail::copy_axpy(exec_space, candidate_solution, solution, alpha, delta);
                 operator_model.apply(exec_space, candidate_solution, candidate_operator_value);
-                detail::copy(exec_space, candidate_residual, rhs);
-                detail::axpy_inplace(
+                double const candidate_residual_l2 = detail::axpby_and_norm(
                         exec_space,
                         candidate_residual,
+                        1.0,
+                        rhs,
                         -1.0,
                         candidate_operator_value);
-                double const candidate_residual_l2
-                        = detail::residual_norm_l2(exec_space, candidate_residual);
                 if (candidate_residual_l2 < best_residual_l2) {
                     best_alpha = alpha;
                     best_residual_l2 = candidate_residual_l2;
+                    std::swap(best_solution, candidate_solution);
+                    std::swap(best_residual, candidate_residual);
+                    std::swap(best_operator_value, candidate_operator_value);
                 }
                 if (candidate_residual_l2 < current_residual_l2) {
                     break;
                 }
                 alpha *= line_search_reduction;
             }
-            if (best_alpha != alpha) {
-                alpha = best_alpha;
-                detail::copy(exec_space, candidate_solution, solution);
-                detail::axpy_inplace(exec_space, candidate_solution, alpha, delta);
-                operator_model.apply(exec_space, candidate_solution, candidate_operator_value);
-                detail::copy(exec_space, candidate_residual, rhs);
-                detail::axpy_inplace(
-                        exec_space,
-                        candidate_residual,
-                        -1.0,
-                        candidate_operator_value);
-                best_residual_l2 = detail::residual_norm_l2(exec_space, candidate_residual);
+            if (best_residual_l2 == std::numeric_limits<double>::infinity()) {
+                // No finite candidate residual: the iterate is kept.
+                best_alpha = 0.0;
+                best_residual_l2 = current_residual_l2;
+            } else {
+                detail::copy(exec_space, solution, best_solution);
+                std::swap(residual, best_residual);
+                std::swap(operator_value, best_operator_value);
             }
+            alpha = best_alpha;
             if (detail::solver_progress_enabled()) {
                 std::cout << "SimiLie nonlinear line search: iteration=" << iteration
                           << " alpha=" << alpha << " residual_l2=" << best_residual_l2
                           << " previous_residual_l2=" << current_residual_l2 << std::endl;
             }
-            detail::copy(exec_space, solution, candidate_solution);
-            detail::copy(exec_space, operator_value, candidate_operator_value);
-            detail::copy(exec_space, residual, candidate_residual);
+            residual_l2 = best_residual_l2;
         }
         auto const optimization_end = std::chrono::steady_clock::now();
         diagnostics.duration
                 = std::chrono::duration<double>(optimization_end - optimization_start).count();
-        diagnostics.final_residual_l2 = detail::residual_norm_l2(exec_space, residual);
+        diagnostics.final_residual_l2 = residual_l2;
         diagnostics.final_relative_residual
                 = diagnostics.initial_residual_l2 == 0.0
                           ? 0.0
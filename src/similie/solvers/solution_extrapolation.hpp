@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "vector_operations.hpp"
+
+namespace similie::solvers {
+
+enum class SolutionExtrapolation {
+    // Straight line through the last two solutions, as a function of the parameter.
+    Linear,
+    // Parabola through the last three solutions, as a function of the parameter.
+    Quadratic,
+    /*
+     * Minimizer of the residual of a linear operator model over the span of the recorded
+     * solutions (proper orthogonal decomposition of the snapshots).
+     */
+    ProperOrthogonalDecomposition,
+};
+
+namespace detail {
+
+// Solves the dense system matrix x = rhs (row-major, size x size) by Gaussian elimination.
+inline std::vector<double> solve_small_dense_system(
+        std::vector<double> matrix,
+        std::vector<double> rhs)
+{
+    std::size_t const size = rhs.size();
+    for (std::size_t pivot = 0; pivot < size; ++pivot) {
+        std::size_t best_row = pivot;
+        for (std::size_t row = pivot + 1; row < size; ++row) {
+            if (std::abs(matrix[row * size + pivot]) > std::abs(matrix[best_row * size + pivot])) {
+                best_row = row;
+            }
+        }
+        if (matrix[best_row * size + pivot] == 0.0) {
+            throw std::runtime_error("singular reduced system in solution extrapolation");
+        }
+        for (std::size_t column = 0; column < size; ++column) {
+            std::swap(matrix[pivot * size + column], matrix[best_row * size + column]);
+        }
+        std::swap(rhs[pivot], rhs[best_row]);
+        for (std::size_t row = pivot + 1; row < size; ++row) {
+            double const factor = matrix[row * size + pivot] / matrix[pivot * size + pivot];
+            for (std::size_t column = pivot; column < size; ++column) {
+                matrix[row * size + column] -= factor * matrix[pivot * size + column];
+            }
+            rhs[row] -= factor * rhs[pivot];
+        }
+    }
+    std::vector<double> solution(size);
+    for (std::size_t row = size; row-- > 0;) {
+        double value = rhs[row];
+        for (std::size_t column = row + 1; column < size; ++column) {
+            value -= matrix[row * size + column] * solution[column];
+        }
+        solution[row] = value / matrix[row * size + row];
+    }
+    return solution;
+}
+
+} // namespace detail
+
+/*
+ * Predicts initial guesses for successive solves (parameter sweeps, quasi-static stepping) from the
+ * last solutions recorded, to be used with StrongFormulationSolverSettings::use_initial_guess or
+ * StrongFormulationSolver::solve(rhs, solution, true). Solutions are (size, nb_columns) views. The
+ * snapshots are stored in a ring of preallocated buffers.
+ */
+template <class ExecSpace>
+class SolutionExtrapolator
+{
+public:
+    using memory_space = typename ExecSpace::memory_space;
+    using view_type = Kokkos::View<double**, Kokkos::LayoutRight, memory_space>;
+
+private:
+    ExecSpace m_exec_space;
+    SolutionExtrapolation m_extrapolation;
+    std::vector<view_type> m_buffers;
+    std::vector<double> m_parameters;
+    std::size_t m_nb_snapshots = 0;
+    // Orthonormal basis of the snapshots and its image by the operator, for the POD prediction.
+    std::vector<view_type> m_basis;
+    std::vector<view_type> m_applied_basis;
+
+public:
+    SolutionExtrapolator(
+            ExecSpace const& exec_space,
+            std::size_t size,
+            std::size_t nb_columns = 1,
+            SolutionExtrapolation extrapolation = SolutionExtrapolation::Linear,
+            std::size_t nb_snapshots_max = 3)
+        : m_exec_space(exec_space)
+        , m_extrapolation(extrapolation)
+        , m_parameters(nb_snapshots_max)
+    {
+        for (std::size_t snapshot = 0; snapshot < nb_snapshots_max; ++snapshot) {
+            m_buffers.emplace_back("similie_extrapolation_snapshot", size, nb_columns);
+            if (extrapolation == SolutionExtrapolation::ProperOrthogonalDecomposition) {
+                m_basis.emplace_back("similie_extrapolation_basis", size, nb_columns);
+                m_applied_basis.emplace_back(
+                        "similie_extrapolation_applied_basis",
+                        size,
+                        nb_columns);
+            }
+        }
+    }
+
+    std::size_t nb_snapshots() const
+    {
+        return m_nb_snapshots;
+    }
+
+    // Records the solution obtained for parameter, evicting the oldest snapshot if needed.
+    template <class SolutionView>
+    void record(double parameter, SolutionView solution)
+    {
+        if (m_buffers.empty()) {
+            return;
+        }
+        if (m_nb_snapshots == m_buffers.size()) {
+            std::rotate(m_buffers.begin(), m_buffers.begin() + 1, m_buffers.end());
+            std::rotate(m_parameters.begin(), m_parameters.begin() + 1, m_parameters.end());
+        } else {
+            ++m_nb_snapshots;
+        }
+        detail::copy(m_exec_space, m_buffers[m_nb_snapshots - 1], solution);
+        m_parameters[m_nb_snapshots - 1] = parameter;
+    }
+
+    /*
+     * guess = Lagrange extrapolation at parameter of the last (degree + 1) snapshots, degree being
+     * 1 (Linear) or 2 (Quadratic) and capped by the number of snapshots. The snapshots must have
+     * distinct parameters. guess is zero if no solution has been recorded yet.
+     */
+    template <class GuessView>
+    void predict(double parameter, GuessView guess) const
+    {
+        std::size_t const degree = m_extrapolation == SolutionExtrapolation::Quadratic ? 2 : 1;
+        std::size_t const nb_points = std::min(degree + 1, m_nb_snapshots);
+        detail::fill(m_exec_space, guess, 0.0);
+        for (std::size_t point = m_nb_snapshots - nb_points; point < m_nb_snapshots; ++point) {
+            double weight = 1.0;
+            for (std::size_t other = m_nb_snapshots - nb_points; other < m_nb_snapshots;
+                 ++other) {
+                if (other != point) {
+                    weight *= (parameter - m_parameters[other])
+                              / (m_parameters[point] - m_parameters[other]);
+                }
+            }
+            detail::axpy_inplace(m_exec_space, guess, weight, m_buffers[point]);
+        }
+    }
+
+    /*
+     * guess = the combination of the snapshots minimizing |rhs - operator(guess)|, the operator
+     * model being linear. It costs one application of the operator per snapshot and the solution
+     * of a dense system of the size of the snapshot basis. Nearly dependent snapshots are dropped.
+     */
+    template <class OperatorModel, class RHSView, class GuessView>
+    void predict(OperatorModel const& operator_model, RHSView rhs, GuessView guess)
+    {
+        static_assert(
+                OperatorModel::IS_LINEAR,
+                "the POD prediction requires a linear operator model");
+        if (m_extrapolation != SolutionExtrapolation::ProperOrthogonalDecomposition) {
+            throw std::runtime_error(
+                    "the POD prediction requires a ProperOrthogonalDecomposition extrapolator");
+        }
+        constexpr double dependency_tolerance = 1.0e-10;
+        std::size_t nb_basis = 0;
+        for (std::size_t snapshot = 0; snapshot < m_nb_snapshots; ++snapshot) {
+            view_type const vector = m_basis[nb_basis];
+            detail::copy(m_exec_space, vector, m_buffers[snapshot]);
+            double const snapshot_norm = detail::residual_norm_l2(m_exec_space, vector);
+            // Modified Gram-Schmidt, repeated once for stability.
+            for (int pass = 0; pass < 2; ++pass) {
+                for (std::size_t basis = 0; basis < nb_basis; ++basis) {
+                    detail::axpy_inplace(
+                            m_exec_space,
+                            vector,
+                            -detail::dot(m_exec_space, m_basis[basis], vector),
+                            m_basis[basis]);
+                }
+            }
+            double const norm = detail::residual_norm_l2(m_exec_space, vector);
+            if (norm > dependency_tolerance * snapshot_norm && norm > 0.0) {
+                detail::update_axpby(m_exec_space, vector, 1.0 / norm, vector, 0.0, vector);
+                operator_model.apply(m_exec_space, vector, m_applied_basis[nb_basis]);
+                ++nb_basis;
+            }
+        }
+        detail::fill(m_exec_space, guess, 0.0);
+        if (nb_basis == 0) {
+            return;
+        }
+        std::vector<double> normal_matrix(nb_basis * nb_basis);
+        std::vector<double> normal_rhs(nb_basis);
+        for (std::size_t row = 0; row < nb_basis; ++row) {
+            for (std::size_t column = 0; column <= row; ++column) {
+                normal_matrix[row * nb_basis + column] = detail::
+                        dot(m_exec_space, m_applied_basis[row], m_applied_basis[column]);
+                normal_matrix[column * nb_basis + row] = normal_matrix[row * nb_basis + column];
+            }
+            normal_rhs[row] = detail::dot(m_exec_space, m_applied_basis[row], rhs);
+        }
+        std::vector<double> const coefficients
+                = detail::solve_small_dense_system(normal_matrix, normal_rhs);
+        for (std::size_t basis = 0; basis < nb_basis; ++basis) {
+            detail::axpy_inplace(m_exec_space, guess, coefficients[basis], m_basis[basis]);
+        }
+    }
+};
+
+} // namespace similie::solvers
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+namespace similie::solvers {
+
+/*
+ * BLAS-1 operations on the (size, nb_columns) views exchanged with the solvers. The fused variants
+ * (axpby_and_norm, copy_axpy, multi_dot) replace sequences of these operations by a single kernel,
+ * saving passes over memory and kernel launches.
+ */
+namespace detail {
+
+template <class ExecSpace, class ViewType1, class ViewType2>
+double dot(ExecSpace exec_space, ViewType1 lhs, ViewType2 rhs)
+{
+    double result = 0.0;
+    Kokkos::parallel_reduce(
+            "similie_dot",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<2>>(exec_space, {0, 0}, {lhs.extent(0), lhs.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column, double& local_sum) {
+                local_sum += lhs(row, column) * rhs(row, column);
+            },
+            result);
+    exec_space.fence();
+    return result;
+}
+
+template <class ExecSpace, class ViewType>
+double residual_norm_l2(ExecSpace exec_space, ViewType residual)
+{
+    return std::sqrt(dot(exec_space, residual, residual));
+}
+
+template <class ExecSpace, class ViewType>
+void fill(ExecSpace exec_space, ViewType view, double value)
+{
+    Kokkos::parallel_for(
+            "similie_fill",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<2>>(exec_space, {0, 0}, {view.extent(0), view.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column) { view(row, column) = value; });
+    exec_space.fence();
+}
+
+template <class ExecSpace, class DestinationView, class SourceView>
+void copy(ExecSpace exec_space, DestinationView destination, SourceView source)
+{
+    Kokkos::parallel_for(
+            "similie_copy",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<
+                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                destination(row, column) = source(row, column);
+            });
+    exec_space.fence();
+}
+
+template <class ExecSpace, class ViewType1, class ViewType2, class ViewType3>
+void update_axpby(
+        ExecSpace exec_space,
+        ViewType1 destination,
+        double alpha,
+        ViewType2 x,
+        double beta,
+        ViewType3 y)
+{
+    Kokkos::parallel_for(
+            "similie_axpby",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<
+                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                destination(row, column) = alpha * x(row, column) + beta * y(row, column);
+            });
+    exec_space.fence();
+}
+
+template <class ExecSpace, class ViewType1, class ViewType2>
+void axpy_inplace(ExecSpace exec_space, ViewType1 destination, double alpha, ViewType2 source)
+{
+    Kokkos::parallel_for(
+            "similie_axpy_inplace",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<
+                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                destination(row, column) += alpha * source(row, column);
+            });
+    exec_space.fence();
+}
+
+// destination = x + alpha * y.
+template <class ExecSpace, class DestinationView, class ViewType1, class ViewType2>
+void copy_axpy(
+        ExecSpace exec_space,
+        DestinationView destination,
+        ViewType1 x,
+        double alpha,
+        ViewType2 y)
+{
+    Kokkos::parallel_for(
+            "similie_copy_axpy",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<
+                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column) {
+                destination(row, column) = x(row, column) + alpha * y(row, column);
+            });
+    exec_space.fence();
+}
+
+// destination = alpha * x + beta * y, returning the L2 norm of destination.
+template <class ExecSpace, class DestinationView, class ViewType1, class ViewType2>
+double axpby_and_norm(
+        ExecSpace exec_space,
+        DestinationView destination,
+        double alpha,
+        ViewType1 x,
+        double beta,
+        ViewType2 y)
+{
+    double result = 0.0;
+    Kokkos::parallel_reduce(
+            "similie_axpby_and_norm",
+            Kokkos::MDRangePolicy<
+                    ExecSpace,
+                    Kokkos::Rank<
+                            2>>(exec_space, {0, 0}, {destination.extent(0), destination.extent(1)}),
+            KOKKOS_LAMBDA(std::size_t row, std::size_t column, double& local_sum) {
+                double const value = alpha * x(row, column) + beta * y(row, column);
+                destination(row, column) = value;
+                local_sum += value * value;
+            },
+            result);
+    exec_space.fence();
+    return std::sqrt(result);
+}
+
+template <class LhsView, class RhsView, std::size_t NbDots>
+struct MultiDotFunctor
+{
+    using value_type = double[];
+    using size_type = std::size_t;
+
+    size_type value_count = NbDots;
+    Kokkos::Array<LhsView, NbDots> lhs;
+    Kokkos::Array<RhsView, NbDots> rhs;
+    std::size_t nb_columns;
+
+    KOKKOS_FUNCTION void operator()(std::size_t index, value_type sums) const
+    {
+        std::size_t const row = index / nb_columns;
+        std::size_t const column = index % nb_columns;
+        for (std::size_t dot_index = 0; dot_index < NbDots; ++dot_index) {
+            sums[dot_index] += lhs[dot_index](row, column) * rhs[dot_index](row, column);
+        }
+    }
+};
+
+// The NbDots dot products (lhs[i], rhs[i]), computed by a single reduction.
+template <class ExecSpace, class LhsView, class RhsView, std::size_t NbDots>
+std::array<double, NbDots> multi_dot(
+        ExecSpace exec_space,
+        Kokkos::Array<LhsView, NbDots> const& lhs,
+        Kokkos::Array<RhsView, NbDots> const& rhs)
+{
+    std::array<double, NbDots> result {};
+    std::size_t const nb_columns = lhs[0].extent(1);
+    Kokkos::parallel_reduce(
+            "similie_multi_dot",
+            Kokkos::RangePolicy<ExecSpace>(exec_space, 0, lhs[0].extent(0) * nb_columns),
+            MultiDotFunctor<LhsView, RhsView, NbDots> {NbDots, lhs, rhs, nb_columns},
+            result.data());
+    exec_space.fence();
+    return result;
+}
+
+} // namespace detail
+
+} // namespace similie::solvers
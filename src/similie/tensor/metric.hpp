@@ -7,6 +7,7 @@
 
 #include <similie/misc/macros.hpp>
 #include <similie/misc/small_matrix.hpp>
+#include <similie/misc/tuned_parallel_for_each.hpp>
 #include <similie/misc/unsecure_parallel_deepcopy.hpp>
 
 #include "character.hpp"
@@ -291,7 +292,7 @@ fill_metric_prod(
         MetricType metric)
 {
     SIMILIE_DEBUG_LOG("similie_compute_metric_prod");
-    ddc::parallel_for_each(
+    misc::tuned_parallel_for_each(
             "similie_compute_metric_prod",
             exec_space,
             metric_prod.non_indices_domain(),
@@ -498,7 +499,7 @@ invert_metric_t<MetricType> fill_inverse_metric(
         MetricType metric)
 {
     SIMILIE_DEBUG_LOG("similie_invert_metric");
-    ddc::parallel_for_each(
+    misc::tuned_parallel_for_each(
             "similie_invert_metric",
             exec_space,
             inv_metric.non_indices_domain(),
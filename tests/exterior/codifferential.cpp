@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: 2026 Baptiste Legouix
 // SPDX-License-Identifier: AGPL-3.0-or-later
 
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <type_traits>
 
 #include <ddc/ddc.hpp>
@@ -243,3 +246,158 @@ TEST(Codifferential, Staged2D1Form)
         staged_codifferential.run(codifferential_tensor, tensor);
     });
 }
+
+TEST(Codifferential, StagedBatched2D1Form)
+{
+    run_codifferential_test([](auto codifferential_tensor,
+                               auto tensor,
+                               auto metric,
+                               auto position) {
+        ddc::Chunk scaled_tensor_alloc(tensor.domain(), ddc::HostAllocator<double>());
+        sil::tensor::Tensor scaled_tensor(scaled_tensor_alloc);
+        ddc::host_for_each(tensor.domain(), [&](auto elem) {
+            scaled_tensor(elem) = 2. * tensor(elem);
+        });
+        ddc::Chunk scaled_codifferential_alloc(
+                codifferential_tensor.domain(),
+                ddc::HostAllocator<double>());
+        sil::tensor::Tensor scaled_codifferential_tensor(scaled_codifferential_alloc);
+
+        auto staged_codifferential = sil::exterior::make_staged_codifferential<
+                MetricIndex<X, Y>,
+                sil::tensor::Covariant<Mu2>,
+                sil::tensor::Covariant<
+                        Mu2>>(Kokkos::DefaultHostExecutionSpace(), tensor, metric, position);
+        staged_codifferential.run(
+                std::array {codifferential_tensor, scaled_codifferential_tensor},
+                std::array {tensor, scaled_tensor});
+
+        ddc::host_for_each(codifferential_tensor.domain(), [&](auto elem) {
+            EXPECT_NEAR(
+                    scaled_codifferential_tensor(elem),
+                    2. * codifferential_tensor(elem),
+                    1e-12);
+        });
+    });
+}
+
+TEST(Codifferential, PrefilledBatched2D1Form)
+{
+    run_codifferential_test([](auto codifferential_tensor,
+                               auto tensor,
+                               auto metric,
+                               auto position) {
+        using TensorIndex = sil::tensor::Covariant<Mu2>;
+        using SourceHodgeInputIndices = sil::tensor::upper_t<
+                ddc::to_type_seq_t<sil::tensor::natural_domain_t<TensorIndex>>>;
+        using SourceHodgeOutputIndices = sil::exterior::codifferential_hodge_output_indices_t<
+                TensorIndex::size() - TensorIndex::rank(),
+                TensorIndex>;
+        using TargetHodgeInputIndices = ddc::
+                type_seq_merge_t<ddc::detail::TypeSeq<TensorIndex>, SourceHodgeOutputIndices>;
+        using TargetHodgeOutputIndices = ddc::type_seq_remove_t<
+                sil::tensor::lower_t<SourceHodgeInputIndices>,
+                ddc::detail::TypeSeq<TensorIndex>>;
+        using DualTensorIndex = sil::misc::convert_type_seq_to_t<
+                sil::tensor::TensorAntisymmetricIndex,
+                SourceHodgeOutputIndices>;
+
+        [[maybe_unused]] sil::tensor::tensor_accessor_for_domain_t<
+                sil::exterior::
+                        hodge_star_domain_t<SourceHodgeInputIndices, SourceHodgeOutputIndices>>
+                hodge_star_accessor;
+        ddc::cartesian_prod_t<
+                typename std::decay_t<decltype(metric)>::non_indices_domain_t,
+                sil::exterior::
+                        hodge_star_domain_t<SourceHodgeInputIndices, SourceHodgeOutputIndices>>
+                hodge_star_dom(metric.non_indices_domain(), hodge_star_accessor.domain());
+        ddc::Chunk hodge_star_alloc(hodge_star_dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor hodge_star(hodge_star_alloc);
+
+        [[maybe_unused]] sil::tensor::tensor_accessor_for_domain_t<
+                sil::exterior::hodge_star_domain_t<
+                        sil::tensor::upper_t<TargetHodgeInputIndices>,
+                        TargetHodgeOutputIndices>> dual_hodge_star_accessor;
+        ddc::cartesian_prod_t<
+                typename std::decay_t<decltype(metric)>::non_indices_domain_t,
+                sil::exterior::hodge_star_domain_t<
+                        sil::tensor::upper_t<TargetHodgeInputIndices>,
+                        TargetHodgeOutputIndices>>
+                dual_hodge_star_dom(metric.non_indices_domain(), dual_hodge_star_accessor.domain());
+        ddc::Chunk dual_hodge_star_alloc(dual_hodge_star_dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor dual_hodge_star(dual_hodge_star_alloc);
+
+        [[maybe_unused]] sil::tensor::TensorAccessor<DualTensorIndex> dual_tensor_accessor;
+        ddc::cartesian_prod_t<
+                typename std::decay_t<decltype(tensor)>::non_indices_domain_t,
+                ddc::DiscreteDomain<DualTensorIndex>>
+                dual_tensor_dom(tensor.non_indices_domain(), dual_tensor_accessor.domain());
+        ddc::Chunk dual_tensor_alloc(dual_tensor_dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor dual_tensor_buffer(dual_tensor_alloc);
+        ddc::Chunk other_dual_tensor_alloc(dual_tensor_dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor other_dual_tensor_buffer(other_dual_tensor_alloc);
+
+        sil::exterior::fill_discrete_hodge_star<SourceHodgeInputIndices, SourceHodgeOutputIndices>(
+                Kokkos::DefaultHostExecutionSpace(),
+                hodge_star,
+                metric,
+                position);
+        sil::exterior::fill_discrete_hodge_star<
+                sil::tensor::upper_t<TargetHodgeInputIndices>,
+                TargetHodgeOutputIndices>(
+                Kokkos::DefaultHostExecutionSpace(),
+                dual_hodge_star,
+                metric,
+                position);
+
+        // A second field, not proportional to the first one.
+        ddc::Chunk other_tensor_alloc(tensor.domain(), ddc::HostAllocator<double>());
+        sil::tensor::Tensor other_tensor(other_tensor_alloc);
+        std::size_t index = 0;
+        ddc::host_for_each(tensor.domain(), [&](auto elem) {
+            other_tensor(elem) = std::sin(0.1 * static_cast<double>(index++));
+        });
+        ddc::Chunk single_codifferential_alloc(
+                codifferential_tensor.domain(),
+                ddc::HostAllocator<double>());
+        sil::tensor::Tensor single_codifferential_tensor(single_codifferential_alloc);
+        sil::exterior::codifferential<MetricIndex<X, Y>, TensorIndex, TensorIndex>(
+                Kokkos::DefaultHostExecutionSpace(),
+                single_codifferential_tensor,
+                tensor,
+                hodge_star,
+                dual_hodge_star,
+                dual_tensor_buffer);
+        ddc::Chunk other_codifferential_alloc(
+                codifferential_tensor.domain(),
+                ddc::HostAllocator<double>());
+        sil::tensor::Tensor other_codifferential_tensor(other_codifferential_alloc);
+        sil::exterior::codifferential<MetricIndex<X, Y>, TensorIndex, TensorIndex>(
+                Kokkos::DefaultHostExecutionSpace(),
+                other_codifferential_tensor,
+                other_tensor,
+                hodge_star,
+                dual_hodge_star,
+                dual_tensor_buffer);
+
+        ddc::Chunk batched_other_codifferential_alloc(
+                codifferential_tensor.domain(),
+                ddc::HostAllocator<double>());
+        sil::tensor::Tensor batched_other_codifferential_tensor(
+                batched_other_codifferential_alloc);
+        sil::exterior::codifferential<MetricIndex<X, Y>, TensorIndex, TensorIndex>(
+                Kokkos::DefaultHostExecutionSpace(),
+                std::array {codifferential_tensor, batched_other_codifferential_tensor},
+                std::array {tensor, other_tensor},
+                hodge_star,
+                dual_hodge_star,
+                std::array {dual_tensor_buffer, other_dual_tensor_buffer});
+
+        ddc::host_for_each(codifferential_tensor.domain(), [&](auto elem) {
+            EXPECT_DOUBLE_EQ(codifferential_tensor(elem), single_codifferential_tensor(elem));
+            EXPECT_DOUBLE_EQ(
+                    batched_other_codifferential_tensor(elem),
+                    other_codifferential_tensor(elem));
+        });
+    });
+}
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2024 Baptiste Legouix
 // SPDX-License-Identifier: AGPL-3.0-or-later
 
+#include <array>
 #include <cmath>
 
 #include <ddc/ddc.hpp>
@@ -988,3 +989,135 @@ TEST(ExteriorDerivative, 2DRotationalWithSpects)
         }
     }
 }
+
+TEST(ExteriorDerivative, 3DTeamTiledRotational)
+{
+    using InIndex = sil::tensor::TensorAntisymmetricIndex<Mu3>;
+    using OutIndex = sil::tensor::TensorAntisymmetricIndex<Nu3, Mu3>;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ>
+            mesh(ddc::DiscreteElement<DDimX, DDimY, DDimZ>(0, 0, 0),
+                 ddc::DiscreteVector<DDimX, DDimY, DDimZ>(9, 7, 5));
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<InIndex> tensor_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, InIndex> dom(mesh, tensor_accessor.domain());
+    ddc::Chunk tensor_alloc(dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor tensor(tensor_alloc);
+    ddc::host_for_each(dom, [&](ddc::DiscreteElement<DDimX, DDimY, DDimZ, InIndex> elem) {
+        tensor(elem) = std::sin(
+                1. * elem.uid<DDimX>() + 2. * elem.uid<DDimY>() + 3. * elem.uid<DDimZ>()
+                + 4. * elem.uid<InIndex>());
+    });
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<OutIndex> derivative_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, OutIndex>
+            derivative_dom(mesh, derivative_accessor.domain());
+    ddc::Chunk reference_alloc(derivative_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor reference(reference_alloc);
+    ddc::Chunk derivative_alloc(derivative_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor derivative(derivative_alloc);
+
+    sil::exterior::coboundary<Nu3, InIndex>(Kokkos::DefaultHostExecutionSpace(), reference, tensor);
+    sil::exterior::team_tiled_coboundary<Nu3, InIndex>(
+            Kokkos::DefaultHostExecutionSpace(),
+            derivative,
+            tensor,
+            std::array<std::size_t, 3> {4, 3, 2});
+    ddc::host_for_each(derivative_dom, [&](auto elem) {
+        EXPECT_DOUBLE_EQ(derivative(elem), reference(elem));
+    });
+
+    sil::exterior::transposed_coboundary<
+            Nu3,
+            InIndex>(Kokkos::DefaultHostExecutionSpace(), reference, tensor);
+    sil::exterior::team_tiled_transposed_coboundary<
+            Nu3,
+            InIndex>(Kokkos::DefaultHostExecutionSpace(), derivative, tensor);
+    ddc::host_for_each(derivative_dom, [&](auto elem) {
+        EXPECT_DOUBLE_EQ(derivative(elem), reference(elem));
+    });
+}
+
+/*
+ * Applies an operator mapping 1-forms to 2-forms on a 3D mesh to two fields, once field by field
+ * and once as a batch, and compares the results.
+ */
+template <class SingleFieldOperator, class MultiFieldOperator>
+static void test_batched_3d_rotational(
+        SingleFieldOperator&& single_field_operator,
+        MultiFieldOperator&& multi_field_operator)
+{
+    using InIndex = sil::tensor::TensorAntisymmetricIndex<Mu3>;
+    using OutIndex = sil::tensor::TensorAntisymmetricIndex<Nu3, Mu3>;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ>
+            mesh(ddc::DiscreteElement<DDimX, DDimY, DDimZ>(0, 0, 0),
+                 ddc::DiscreteVector<DDimX, DDimY, DDimZ>(9, 7, 5));
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<InIndex> tensor_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, InIndex> dom(mesh, tensor_accessor.domain());
+    ddc::Chunk tensor_alloc(dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor tensor(tensor_alloc);
+    ddc::Chunk other_tensor_alloc(dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor other_tensor(other_tensor_alloc);
+    ddc::host_for_each(dom, [&](ddc::DiscreteElement<DDimX, DDimY, DDimZ, InIndex> elem) {
+        tensor(elem) = std::sin(
+                1. * elem.uid<DDimX>() + 2. * elem.uid<DDimY>() + 3. * elem.uid<DDimZ>()
+                + 4. * elem.uid<InIndex>());
+        other_tensor(elem) = std::cos(
+                3. * elem.uid<DDimX>() - 1. * elem.uid<DDimY>() + 2. * elem.uid<DDimZ>()
+                + 5. * elem.uid<InIndex>());
+    });
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<OutIndex> derivative_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, OutIndex>
+            derivative_dom(mesh, derivative_accessor.domain());
+    ddc::Chunk reference_alloc(derivative_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor reference(reference_alloc);
+    ddc::Chunk other_reference_alloc(derivative_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor other_reference(other_reference_alloc);
+    ddc::Chunk derivative_alloc(derivative_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor derivative(derivative_alloc);
+    ddc::Chunk other_derivative_alloc(derivative_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor other_derivative(other_derivative_alloc);
+
+    single_field_operator(reference, tensor);
+    single_field_operator(other_reference, other_tensor);
+    multi_field_operator(
+            std::array {derivative, other_derivative},
+            std::array {tensor, other_tensor});
+    ddc::host_for_each(derivative_dom, [&](auto elem) {
+        EXPECT_DOUBLE_EQ(derivative(elem), reference(elem));
+        EXPECT_DOUBLE_EQ(other_derivative(elem), other_reference(elem));
+    });
+}
+
+TEST(ExteriorDerivative, 3DBatchedRotational)
+{
+    using InIndex = sil::tensor::TensorAntisymmetricIndex<Mu3>;
+    test_batched_3d_rotational(
+            [](auto derivative, auto tensor) {
+                sil::exterior::coboundary<
+                        Nu3,
+                        InIndex>(Kokkos::DefaultHostExecutionSpace(), derivative, tensor);
+            },
+            [](auto derivatives, auto tensors) {
+                sil::exterior::coboundary<
+                        Nu3,
+                        InIndex>(Kokkos::DefaultHostExecutionSpace(), derivatives, tensors);
+            });
+}
+
+TEST(ExteriorDerivative, 3DBatchedTransposedRotational)
+{
+    using InIndex = sil::tensor::TensorAntisymmetricIndex<Mu3>;
+    test_batched_3d_rotational(
+            [](auto derivative, auto tensor) {
+                sil::exterior::transposed_coboundary<
+                        Nu3,
+                        InIndex>(Kokkos::DefaultHostExecutionSpace(), derivative, tensor);
+            },
+            [](auto derivatives, auto tensors) {
+                sil::exterior::transposed_coboundary<
+                        Nu3,
+                        InIndex>(Kokkos::DefaultHostExecutionSpace(), derivatives, tensors);
+            });
+}
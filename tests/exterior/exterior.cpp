@@ -2,6 +2,12 @@
 // SPDX-License-Identifier: AGPL-3.0-or-later
 
 #include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
 
 #include <ddc/ddc.hpp>
 
@@ -106,6 +112,32 @@ TEST(Chain, Optimization)
                                           true)));
 }
 
+TEST(Chain, ParallelOptimization)
+{
+    using SimplexType = sil::exterior::Simplex<1, DDimX, DDimY>;
+    std::size_t const n = 1000;
+    Kokkos::View<SimplexType*, Kokkos::LayoutRight, Kokkos::HostSpace> allocation("", 2 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        allocation(i) = SimplexType(
+                ddc::DiscreteElement<DDimX, DDimY> {i, i % 7},
+                ddc::DiscreteVector<DDimX> {1});
+    }
+    for (std::size_t i = 0; i < n; i += 2) {
+        allocation(n + i / 2) = -allocation(n - 1 - i);
+    }
+    sil::exterior::Chain chain(allocation, n + n / 2);
+    chain.optimize(Kokkos::DefaultHostExecutionSpace());
+    EXPECT_EQ(chain.size(), n / 2);
+    EXPECT_EQ(chain.check(Kokkos::DefaultHostExecutionSpace()), 0);
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        EXPECT_TRUE(
+                chain[i]
+                == SimplexType(
+                        ddc::DiscreteElement<DDimX, DDimY> {2 * i, (2 * i) % 7},
+                        ddc::DiscreteVector<DDimX> {1}));
+    }
+}
+
 TEST(Boundary, 1Simplex)
 {
     sil::exterior::Simplex
@@ -430,6 +462,64 @@ TEST(Boundary, Chain)
                                           ddc::DiscreteVector<DDimX> {-1})));
 }
 
+TEST(Boundary, ParallelChain)
+{
+    using SimplexType = sil::exterior::Simplex<2, DDimT, DDimX, DDimY, DDimZ>;
+    using BoundarySimplexType = sil::exterior::Simplex<1, DDimT, DDimX, DDimY, DDimZ>;
+    std::size_t const n = 40;
+    sil::exterior::Chain
+            chain(Kokkos::View<SimplexType*, Kokkos::LayoutRight, Kokkos::HostSpace>("", n * n),
+                  n * n);
+    for (std::size_t i = 0; i < n * n; ++i) {
+        chain[i] = SimplexType(
+                ddc::DiscreteElement<DDimT, DDimX, DDimY, DDimZ> {0, i % n, i / n, 0},
+                ddc::DiscreteVector<DDimX, DDimY> {1, 1});
+    }
+    Kokkos::View<BoundarySimplexType*, Kokkos::LayoutRight, Kokkos::HostSpace>
+            allocation("", 4 * n * n);
+    Kokkos::View<BoundarySimplexType*, Kokkos::LayoutRight, Kokkos::HostSpace>
+            serial_allocation("", 4 * n * n);
+    sil::exterior::Chain boundary_chain
+            = sil::exterior::boundary(Kokkos::DefaultHostExecutionSpace(), allocation, chain);
+    sil::exterior::Chain serial_boundary_chain = sil::exterior::boundary(serial_allocation, chain);
+    EXPECT_EQ(boundary_chain.size(), 4 * n);
+    EXPECT_EQ(serial_boundary_chain.size(), 4 * n);
+    EXPECT_TRUE(boundary_chain == serial_boundary_chain);
+
+    // The 4n distinct faces are the unit edges of the perimeter, oriented along a closed loop.
+    EXPECT_EQ(boundary_chain.check(Kokkos::DefaultHostExecutionSpace()), 0);
+    std::map<std::pair<std::size_t, std::size_t>, int> outflows;
+    for (std::size_t i = 0; i < boundary_chain.size(); ++i) {
+        BoundarySimplexType const face = boundary_chain[i];
+        auto const tail = face.discrete_element();
+        auto const head = tail + face.discrete_vector();
+        std::pair<std::size_t, std::size_t> const start(tail.uid<DDimX>(), tail.uid<DDimY>());
+        std::pair<std::size_t, std::size_t> const stop(head.uid<DDimX>(), head.uid<DDimY>());
+        EXPECT_EQ(
+                std::abs(ddc::get<DDimX>(face.discrete_vector()))
+                        + std::abs(ddc::get<DDimY>(face.discrete_vector())),
+                1);
+        EXPECT_TRUE(
+                start.second == stop.second ? start.second == 0 || start.second == n
+                                            : start.first == 0 || start.first == n);
+        outflows[face.negative() ? stop : start] += 1;
+        outflows[face.negative() ? start : stop] -= 1;
+    }
+    EXPECT_EQ(outflows.size(), 4 * n);
+    for (auto const& [vertex, outflow] : outflows) {
+        EXPECT_EQ(outflow, 0);
+    }
+
+    Kokkos::View<double*, Kokkos::LayoutRight, Kokkos::HostSpace> values("", 4 * n);
+    double expected = 0.;
+    for (std::size_t i = 0; i < 4 * n; ++i) {
+        values(i) = static_cast<double>(i);
+        expected += (boundary_chain[i].negative() ? -1. : 1.) * values(i);
+    }
+    sil::exterior::Cochain cochain(boundary_chain, values);
+    EXPECT_EQ(cochain.integrate(Kokkos::DefaultHostExecutionSpace()), expected);
+}
+
 TEST(Boundary, PoincarreLemma2)
 {
     sil::exterior::Simplex simplex = sil::exterior::
@@ -630,3 +720,57 @@ TEST(LocalCochain, Test)
                     2.);
     EXPECT_EQ(cochain.integrate(), 3.);
 }
+
+TEST(TunedParallelForEach, CacheRoundTrip)
+{
+    std::filesystem::path const path
+            = std::filesystem::temp_directory_path() / "similie_mdrange_tuning_test.txt";
+    std::filesystem::remove(path);
+
+    ddc::DiscreteDomain<DDimX, DDimY>
+            dom(ddc::DiscreteElement<DDimX, DDimY>(0, 0),
+                ddc::DiscreteVector<DDimX, DDimY>(64, 128));
+    ddc::Chunk alloc(dom, ddc::HostAllocator<double>());
+    ddc::ChunkSpan values = alloc.span_view();
+    auto const fill = [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        values(elem) = elem.uid<DDimX>() + 1000. * elem.uid<DDimY>();
+    };
+
+    sil::misc::MDRangeTuningCache cache(path.string());
+    sil::misc::tuned_parallel_for_each(
+            cache,
+            "similie_test_tuned_fill",
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            fill);
+    ddc::host_for_each(dom, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        EXPECT_EQ(values(elem), elem.uid<DDimX>() + 1000. * elem.uid<DDimY>());
+    });
+
+    // The winner is persisted and reloaded by another cache, which then skips the tuning.
+    std::ifstream file(path);
+    std::string line;
+    ASSERT_TRUE(std::getline(file, line));
+    EXPECT_EQ(line.rfind("similie_test_tuned_fill|", 0), 0);
+    EXPECT_FALSE(std::getline(file, line));
+    file.close();
+
+    ddc::host_for_each(dom, [&](ddc::DiscreteElement<DDimX, DDimY> elem) { values(elem) = 0.; });
+    sil::misc::MDRangeTuningCache reloaded_cache(path.string());
+    sil::misc::tuned_parallel_for_each(
+            reloaded_cache,
+            "similie_test_tuned_fill",
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            fill);
+    ddc::host_for_each(dom, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        EXPECT_EQ(values(elem), elem.uid<DDimX>() + 1000. * elem.uid<DDimY>());
+    });
+    std::ifstream reloaded_file(path);
+    std::size_t nb_lines = 0;
+    while (std::getline(reloaded_file, line)) {
+        ++nb_lines;
+    }
+    EXPECT_EQ(nb_lines, 1);
+    std::filesystem::remove(path);
+}
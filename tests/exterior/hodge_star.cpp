@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: 2024 Baptiste Legouix
 // SPDX-License-Identifier: AGPL-3.0-or-later
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 #include <ddc/ddc.hpp>
 
@@ -175,6 +177,33 @@ TEST(DiscreteHodgeStar, Metric3D)
                 EXPECT_DOUBLE_EQ(form(elem, form.accessor().access_element<X, Y>()), 3.);
             });
 
+    auto const volume_cache = sil::exterior::
+            make_simplex_volume_cache(Kokkos::DefaultHostExecutionSpace(), metric, position);
+    ddc::Chunk cached_hodge_star_alloc(hodge_star_dom2, ddc::HostAllocator<double>());
+    sil::tensor::Tensor cached_hodge_star(cached_hodge_star_alloc);
+    sil::exterior::fill_discrete_hodge_star<
+            ddc::detail::TypeSeq<RhoUp>,
+            ddc::detail::TypeSeq<MuLow, NuLow>>(
+            Kokkos::DefaultHostExecutionSpace(),
+            cached_hodge_star,
+            metric,
+            position,
+            volume_cache.volumes());
+
+    ddc::host_for_each(
+            metric.non_indices_domain(),
+            [&](ddc::DiscreteElement<DDimX, DDimY, DDimZ> elem) {
+                EXPECT_DOUBLE_EQ(
+                        volume_cache.volumes().primal(elem, std::array<std::size_t, 1> {0}),
+                        2.);
+                EXPECT_DOUBLE_EQ(
+                        volume_cache.volumes().primal(elem, std::array<std::size_t, 2> {1, 1}),
+                        0.);
+            });
+    ddc::host_for_each(hodge_star2.domain(), [&](auto elem) {
+        EXPECT_DOUBLE_EQ(cached_hodge_star.mem(elem), hodge_star2.mem(elem));
+    });
+
     ddc::detail::g_discrete_space_dual<DDimX>.reset();
     ddc::detail::g_discrete_space_dual<DDimY>.reset();
     ddc::detail::g_discrete_space_dual<DDimZ>.reset();
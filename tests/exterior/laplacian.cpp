@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <numbers>
 #include <vector>
 
 #include <ddc/ddc.hpp>
@@ -726,6 +727,115 @@ TEST(Laplacian, Staged2D1Form)
                 }
             });
 
+    ddc::Chunk fused_laplacian_alloc(laplacian_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor fused_laplacian(fused_laplacian_alloc);
+    auto staged_fused_laplacian
+            = sil::exterior::make_staged_laplacian<MetricIndex<X, Y>, InterestIndex, InterestIndex>(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    fused_laplacian,
+                    potential,
+                    metric,
+                    position,
+                    sil::exterior::LaplacianMode::FusedTiled);
+    staged_fused_laplacian.run(fused_laplacian, potential);
+
+    ddc::host_for_each(laplacian.domain(), [&](auto elem) {
+        EXPECT_NEAR(fused_laplacian.mem(elem), laplacian.mem(elem), 1e-12);
+    });
+
+    ddc::detail::g_discrete_space_dual<DDimX>.reset();
+    ddc::detail::g_discrete_space_dual<DDimY>.reset();
+    ddc::detail::g_discrete_space_dual<DDimZ>.reset();
+}
+
+TEST(Laplacian, Fourier2D1Form)
+{
+    using InterestIndex = sil::tensor::Covariant<Mu2>;
+    using PositionIndex = sil::tensor::Contravariant<sil::tensor::TensorNaturalIndex<X, Y>>;
+
+    // Uneven extents along X and Y exercise both the radix-2 and the Bluestein transforms.
+    ddc::Coordinate<X, Y> lower_bounds(-5., -5.);
+    ddc::Coordinate<X, Y> upper_bounds(5., 5.);
+    ddc::DiscreteVector<DDimX, DDimY> nb_cells(16, 12);
+    ddc::DiscreteDomain<DDimX> mesh_x = ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(
+            ddc::Coordinate<X>(lower_bounds),
+            ddc::Coordinate<X>(upper_bounds),
+            ddc::DiscreteVector<DDimX>(nb_cells)));
+    ddc::DiscreteDomain<DDimY> mesh_y = ddc::init_discrete_space<DDimY>(DDimY::init<DDimY>(
+            ddc::Coordinate<Y>(lower_bounds),
+            ddc::Coordinate<Y>(upper_bounds),
+            ddc::DiscreteVector<DDimY>(nb_cells)));
+    ddc::DiscreteDomain<DDimX, DDimY> mesh_xy(mesh_x, mesh_y);
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<InterestIndex> accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, InterestIndex> dom(mesh_xy, accessor.domain());
+    ddc::Chunk rhs_alloc(dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor rhs(rhs_alloc);
+    ddc::Chunk solution_alloc(dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor solution(solution_alloc);
+    ddc::Chunk laplacian_alloc(dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor laplacian(laplacian_alloc);
+
+    // Zero-mean right-hand side, periodic over the mesh points.
+    double const kx = 2. * std::numbers::pi / static_cast<double>(mesh_x.size());
+    double const ky = 2. * std::numbers::pi / static_cast<double>(mesh_y.size());
+    ddc::host_for_each(mesh_xy, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        double const i = static_cast<double>((elem - mesh_xy.front()).template get<DDimX>());
+        double const j = static_cast<double>((elem - mesh_xy.front()).template get<DDimY>());
+        rhs.mem(elem, accessor.access_element<X>()) = std::sin(kx * i) * std::cos(2. * ky * j);
+        rhs.mem(elem, accessor.access_element<Y>()) = std::cos(3. * kx * i) * std::sin(ky * j);
+    });
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<MetricIndex<X, Y>> metric_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, MetricIndex<X, Y>>
+            metric_dom(mesh_xy, metric_accessor.domain());
+    ddc::Chunk metric_alloc(metric_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor metric(metric_alloc);
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<PositionIndex> position_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, PositionIndex>
+            position_dom(mesh_xy, position_accessor.domain());
+    ddc::Chunk position_alloc(position_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor position(position_alloc);
+    ddc::host_for_each(mesh_xy, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        position(elem, position_accessor.access_element<X>())
+                = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimX>(elem)));
+        position(elem, position_accessor.access_element<Y>())
+                = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimY>(elem)));
+    });
+
+    auto fourier_solver = sil::exterior::
+            make_fourier_laplacian_solver<MetricIndex<X, Y>, InterestIndex, InterestIndex>(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    solution,
+                    metric,
+                    position);
+    fourier_solver.solve(solution, rhs);
+
+    auto staged_laplacian
+            = sil::exterior::make_staged_laplacian<MetricIndex<X, Y>, InterestIndex, InterestIndex>(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    laplacian,
+                    solution,
+                    metric,
+                    position);
+    staged_laplacian.run(laplacian, solution);
+
+    // Away from the boundary, the non-periodic Laplacian of the solution recovers the rhs.
+    ddc::DiscreteDomain<DDimX, DDimY> const interior
+            = mesh_xy.remove_first(ddc::DiscreteVector<DDimX, DDimY>(2, 2))
+                      .remove_last(ddc::DiscreteVector<DDimX, DDimY>(2, 2));
+    ddc::host_for_each(interior, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        EXPECT_NEAR(
+                laplacian.mem(elem, accessor.access_element<X>()),
+                rhs.mem(elem, accessor.access_element<X>()),
+                1e-10);
+        EXPECT_NEAR(
+                laplacian.mem(elem, accessor.access_element<Y>()),
+                rhs.mem(elem, accessor.access_element<Y>()),
+                1e-10);
+    });
+
     ddc::detail::g_discrete_space_dual<DDimX>.reset();
     ddc::detail::g_discrete_space_dual<DDimY>.reset();
     ddc::detail::g_discrete_space_dual<DDimZ>.reset();
@@ -834,6 +944,115 @@ TEST(Laplacian, 3D1Form)
     ddc::detail::g_discrete_space_dual<DDimZ>.reset();
 }
 
+// The fused tiled mode reproduces the staged one in 3D, uneven extents leaving partial tiles.
+TEST(Laplacian, FusedTiled3D1Form)
+{
+    using InterestIndex = sil::tensor::Covariant<Mu3>;
+    using PositionIndex = sil::tensor::Contravariant<sil::tensor::TensorNaturalIndex<X, Y, Z>>;
+
+    ddc::Coordinate<X, Y, Z> lower_bounds(-5., -5., -5.);
+    ddc::Coordinate<X, Y, Z> upper_bounds(5., 5., 5.);
+    ddc::DiscreteVector<DDimX, DDimY, DDimZ> nb_cells(17, 13, 11);
+    ddc::DiscreteDomain<DDimX> mesh_x = ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(
+            ddc::Coordinate<X>(lower_bounds),
+            ddc::Coordinate<X>(upper_bounds),
+            ddc::DiscreteVector<DDimX>(nb_cells)));
+    ddc::DiscreteDomain<DDimY> mesh_y = ddc::init_discrete_space<DDimY>(DDimY::init<DDimY>(
+            ddc::Coordinate<Y>(lower_bounds),
+            ddc::Coordinate<Y>(upper_bounds),
+            ddc::DiscreteVector<DDimY>(nb_cells)));
+    ddc::DiscreteDomain<DDimZ> mesh_z = ddc::init_discrete_space<DDimZ>(DDimZ::init<DDimZ>(
+            ddc::Coordinate<Z>(lower_bounds),
+            ddc::Coordinate<Z>(upper_bounds),
+            ddc::DiscreteVector<DDimZ>(nb_cells)));
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ> mesh_xyz(mesh_x, mesh_y, mesh_z);
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<InterestIndex> potential_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, InterestIndex>
+            potential_dom(mesh_xyz, potential_accessor.domain());
+    ddc::Chunk potential_alloc(potential_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor potential(potential_alloc);
+
+    double const R = 2.;
+    double const alpha = 0.2;
+    ddc::host_for_each(
+            potential.non_indices_domain(),
+            [&](ddc::DiscreteElement<DDimX, DDimY, DDimZ> elem) {
+                double const x_coord = ddc::coordinate(ddc::DiscreteElement<DDimX>(elem));
+                double const y_coord = ddc::coordinate(ddc::DiscreteElement<DDimY>(elem));
+                double const z_coord = ddc::coordinate(ddc::DiscreteElement<DDimZ>(elem));
+                double const r = Kokkos::sqrt(
+                        static_cast<double>(x_coord * x_coord)
+                        + static_cast<double>(y_coord * y_coord)
+                        + static_cast<double>(z_coord * z_coord));
+                double const theta = Kokkos::atan2(y_coord, x_coord);
+                double const amplitude = r <= R ? alpha * r * r : alpha * R * R * R * R / (r * r);
+                potential.mem(elem, potential_accessor.access_element<X>())
+                        = amplitude * Kokkos::sin(theta);
+                potential.mem(elem, potential_accessor.access_element<Y>())
+                        = -amplitude * Kokkos::cos(theta);
+                potential.mem(elem, potential_accessor.access_element<Z>()) = z_coord * y_coord;
+            });
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<MetricIndex<X, Y, Z>> metric_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, MetricIndex<X, Y, Z>>
+            metric_dom(potential.non_indices_domain(), metric_accessor.domain());
+    ddc::Chunk metric_alloc(metric_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor metric(metric_alloc);
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<PositionIndex> position_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, PositionIndex>
+            position_dom(potential.non_indices_domain(), position_accessor.domain());
+    ddc::Chunk position_alloc(position_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor position(position_alloc);
+    ddc::host_for_each(
+            potential.non_indices_domain(),
+            [&](ddc::DiscreteElement<DDimX, DDimY, DDimZ> elem) {
+                position(elem, position_accessor.access_element<X>())
+                        = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimX>(elem)));
+                position(elem, position_accessor.access_element<Y>())
+                        = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimY>(elem)));
+                position(elem, position_accessor.access_element<Z>())
+                        = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimZ>(elem)));
+            });
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<InterestIndex> laplacian_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, DDimZ, InterestIndex> laplacian_dom(
+            potential.non_indices_domain().remove_last(
+                    ddc::DiscreteVector<DDimX, DDimY, DDimZ>(1, 1, 1)),
+            laplacian_accessor.domain());
+    ddc::Chunk laplacian_alloc(laplacian_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor laplacian(laplacian_alloc);
+    auto staged_laplacian = sil::exterior::
+            make_staged_laplacian<MetricIndex<X, Y, Z>, InterestIndex, InterestIndex>(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    laplacian,
+                    potential,
+                    metric,
+                    position);
+    staged_laplacian.run(laplacian, potential);
+
+    ddc::Chunk fused_laplacian_alloc(laplacian_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor fused_laplacian(fused_laplacian_alloc);
+    auto staged_fused_laplacian = sil::exterior::
+            make_staged_laplacian<MetricIndex<X, Y, Z>, InterestIndex, InterestIndex>(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    fused_laplacian,
+                    potential,
+                    metric,
+                    position,
+                    sil::exterior::LaplacianMode::FusedTiled);
+    staged_fused_laplacian.run(fused_laplacian, potential);
+
+    ddc::host_for_each(laplacian.domain(), [&](auto elem) {
+        EXPECT_NEAR(fused_laplacian.mem(elem), laplacian.mem(elem), 1e-12);
+    });
+
+    ddc::detail::g_discrete_space_dual<DDimX>.reset();
+    ddc::detail::g_discrete_space_dual<DDimY>.reset();
+    ddc::detail::g_discrete_space_dual<DDimZ>.reset();
+}
+
 TEST(Laplacian, 3D2Form)
 {
     ddc::Coordinate<X, Y, Z> lower_bounds(-5., -5., -5.);
@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: 2026 Baptiste Legouix
 // SPDX-License-Identifier: AGPL-3.0-or-later
 
+#include <array>
+#include <cstddef>
+
 #include <ddc/ddc.hpp>
 
 #include <gtest/gtest.h>
@@ -327,3 +330,54 @@ TEST(Reconstruction, TwoForm)
                         4.);
             });
 }
+
+TEST(Reduction, CombinationTables)
+{
+    namespace detail = sil::exterior::detail;
+    EXPECT_EQ((detail::combination_rank<4>(std::array<std::size_t, 2> {1, 3})), 4);
+    EXPECT_EQ((detail::combination_rank<4>(std::array<std::size_t, 2> {3, 1})), 4);
+    EXPECT_EQ((detail::combination_from_rank<4, 2>(4)), (std::array<std::size_t, 2> {1, 3}));
+    EXPECT_EQ(
+            (detail::hodge_complement_ids<4>(std::array<std::size_t, 2> {1, 3})),
+            (std::array<std::size_t, 2> {0, 2}));
+}
+
+TEST(Reduction, HodgePermutationSign)
+{
+    namespace detail = sil::exterior::detail;
+    // (1, 3, 0, 2) has three inversions.
+    EXPECT_EQ(
+            (detail::hodge_permutation_sign<4>(
+                    std::array<std::size_t, 2> {1, 3},
+                    std::array<std::size_t, 2> {0, 2})),
+            -1);
+    // Non-increasing ids: (3, 1, 0, 2) has four inversions, (3, 1, 2, 0) has five.
+    EXPECT_EQ(
+            (detail::hodge_permutation_sign<4>(
+                    std::array<std::size_t, 2> {3, 1},
+                    std::array<std::size_t, 2> {0, 2})),
+            1);
+    EXPECT_EQ(
+            (detail::hodge_permutation_sign<4>(
+                    std::array<std::size_t, 2> {3, 1},
+                    std::array<std::size_t, 2> {2, 0})),
+            -1);
+}
+
+// Invalid ids are rejected once by the callers of the unchecked lookups above.
+TEST(Reduction, HodgeIsCompletePermutation)
+{
+    namespace detail = sil::exterior::detail;
+    EXPECT_TRUE((detail::hodge_is_complete_permutation<4>(
+            std::array<std::size_t, 2> {3, 1},
+            std::array<std::size_t, 2> {2, 0})));
+    EXPECT_FALSE((detail::hodge_is_complete_permutation<4>(
+            std::array<std::size_t, 2> {1, 1},
+            std::array<std::size_t, 2> {0, 2})));
+    EXPECT_FALSE((detail::hodge_is_complete_permutation<4>(
+            std::array<std::size_t, 2> {1, 7},
+            std::array<std::size_t, 2> {0, 2})));
+    EXPECT_FALSE((detail::hodge_is_complete_permutation<4>(
+            std::array<std::size_t, 1> {1},
+            std::array<std::size_t, 2> {0, 2})));
+}
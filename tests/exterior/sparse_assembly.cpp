@@ -0,0 +1,338 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <cstddef>
+#include <memory>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <similie/solvers/minimize_strong_formulation_residual.hpp>
+#include <similie/tensor/symmetric_tensor.hpp>
+
+#include "exterior.hpp"
+
+struct X
+{
+};
+
+struct Y
+{
+};
+
+struct DDimX : ddc::UniformPointSampling<X>
+{
+};
+
+struct DDimY : ddc::UniformPointSampling<Y>
+{
+};
+
+struct Mu2 : sil::tensor::TensorNaturalIndex<X, Y>
+{
+};
+
+struct Nu2 : sil::tensor::TensorNaturalIndex<X, Y>
+{
+};
+
+using InIndex = sil::tensor::TensorAntisymmetricIndex<Mu2>;
+using OutIndex = sil::tensor::TensorAntisymmetricIndex<Nu2, Mu2>;
+
+using MuUp = sil::tensor::Contravariant<Mu2>;
+using MuLow = sil::tensor::Covariant<Mu2>;
+using NuLow = sil::tensor::Covariant<Nu2>;
+
+using MetricIndex = sil::tensor::TensorSymmetricIndex<
+        sil::tensor::Covariant<sil::tensor::MetricIndex1<X, Y>>,
+        sil::tensor::Covariant<sil::tensor::MetricIndex2<X, Y>>>;
+
+using PositionIndex = sil::tensor::Contravariant<sil::tensor::TensorNaturalIndex<X, Y>>;
+
+// Uniform mesh of [0, 5]^2 with 6 x 6 nodes.
+static ddc::DiscreteDomain<DDimX, DDimY> init_mesh()
+{
+    ddc::Coordinate<X, Y> const lower_bounds(0., 0.);
+    ddc::Coordinate<X, Y> const upper_bounds(5., 5.);
+    ddc::DiscreteVector<DDimX, DDimY> const nb_nodes(6, 6);
+    ddc::DiscreteDomain<DDimX> const mesh_x = ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(
+            ddc::Coordinate<X>(lower_bounds),
+            ddc::Coordinate<X>(upper_bounds),
+            ddc::DiscreteVector<DDimX>(nb_nodes)));
+    ddc::DiscreteDomain<DDimY> const mesh_y = ddc::init_discrete_space<DDimY>(DDimY::init<DDimY>(
+            ddc::Coordinate<Y>(lower_bounds),
+            ddc::Coordinate<Y>(upper_bounds),
+            ddc::DiscreteVector<DDimY>(nb_nodes)));
+    return ddc::DiscreteDomain<DDimX, DDimY>(mesh_x, mesh_y);
+}
+
+static void reset_mesh()
+{
+    ddc::detail::g_discrete_space_dual<DDimX>.reset();
+    ddc::detail::g_discrete_space_dual<DDimY>.reset();
+}
+
+// Constant non-diagonal metric and node positions of the mesh.
+struct Geometry
+{
+    ddc::Chunk<double, ddc::DiscreteDomain<DDimX, DDimY, MetricIndex>, ddc::HostAllocator<double>>
+            metric_alloc;
+    ddc::Chunk<double, ddc::DiscreteDomain<DDimX, DDimY, PositionIndex>, ddc::HostAllocator<double>>
+            position_alloc;
+
+    explicit Geometry(ddc::DiscreteDomain<DDimX, DDimY> const& mesh_xy)
+        : metric_alloc(
+                  ddc::DiscreteDomain<DDimX, DDimY, MetricIndex>(
+                          mesh_xy,
+                          sil::tensor::TensorAccessor<MetricIndex>().domain()),
+                  ddc::HostAllocator<double>())
+        , position_alloc(
+                  ddc::DiscreteDomain<DDimX, DDimY, PositionIndex>(
+                          mesh_xy,
+                          sil::tensor::TensorAccessor<PositionIndex>().domain()),
+                  ddc::HostAllocator<double>())
+    {
+        sil::tensor::Tensor metric = this->metric();
+        sil::tensor::Tensor position = this->position();
+        ddc::host_for_each(mesh_xy, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+            metric(elem, metric.accessor().access_element<X, X>()) = 2.;
+            metric(elem, metric.accessor().access_element<X, Y>()) = 0.5;
+            metric(elem, metric.accessor().access_element<Y, Y>()) = 3.;
+            position(elem, position.accessor().access_element<X>())
+                    = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimX>(elem)));
+            position(elem, position.accessor().access_element<Y>())
+                    = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimY>(elem)));
+        });
+    }
+
+    auto metric()
+    {
+        return sil::tensor::Tensor(metric_alloc);
+    }
+
+    auto position()
+    {
+        return sil::tensor::Tensor(position_alloc);
+    }
+};
+
+/*
+ * Assembles apply_operator and checks that the assembled operator applies as apply_operator to a
+ * pseudo-random cochain.
+ */
+template <class InputDomain, class OutputDomain, class Operator>
+static sil::exterior::SparseOperator<Kokkos::HostSpace> assemble_and_compare(
+        InputDomain const& in_dom,
+        OutputDomain const& out_dom,
+        Operator const& apply_operator,
+        std::size_t stencil_radius)
+{
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    sil::exterior::SparseOperator<Kokkos::HostSpace> const sparse_operator
+            = sil::exterior::assemble_sparse_operator<ddc::detail::TypeSeq<
+                    DDimX,
+                    DDimY>>(exec_space, in_dom, out_dom, apply_operator, stencil_radius);
+    EXPECT_EQ(sparse_operator.nb_rows, out_dom.size());
+    EXPECT_EQ(sparse_operator.nb_columns, in_dom.size());
+
+    ddc::Chunk in_alloc(in_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor in(in_alloc);
+    std::size_t index = 0;
+    ddc::host_for_each(in_dom, [&](auto elem) {
+        in_alloc(elem) = static_cast<double>((7 * index++) % 11) - 5.;
+    });
+    ddc::Chunk direct_alloc(out_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor direct(direct_alloc);
+    apply_operator(in, direct);
+
+    ddc::Chunk assembled_alloc(out_dom, ddc::HostAllocator<double>());
+    sil::exterior::apply_sparse_operator(
+            exec_space,
+            sparse_operator,
+            Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                    in_alloc.data_handle(),
+                    in_dom.size()),
+            Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                    assembled_alloc.data_handle(),
+                    out_dom.size()));
+    exec_space.fence();
+    ddc::host_for_each(out_dom, [&](auto elem) {
+        EXPECT_NEAR(assembled_alloc(elem), direct_alloc(elem), 1e-12);
+    });
+    return sparse_operator;
+}
+
+TEST(SparseAssembly, 2DRotational)
+{
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    [[maybe_unused]] sil::tensor::TensorAccessor<InIndex> in_accessor;
+    [[maybe_unused]] sil::tensor::TensorAccessor<OutIndex> out_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, InIndex> const in_dom(
+            ddc::DiscreteDomain<DDimX, DDimY>(
+                    ddc::DiscreteElement<DDimX, DDimY>(0, 0),
+                    ddc::DiscreteVector<DDimX, DDimY>(5, 4)),
+            in_accessor.domain());
+    ddc::DiscreteDomain<DDimX, DDimY, OutIndex> const out_dom(
+            ddc::DiscreteDomain<DDimX, DDimY>(
+                    ddc::DiscreteElement<DDimX, DDimY>(0, 0),
+                    ddc::DiscreteVector<DDimX, DDimY>(4, 3)),
+            out_accessor.domain());
+
+    auto const apply_rotational = [&](auto input, auto output) {
+        sil::exterior::deriv<Nu2, InIndex>(exec_space, output, input);
+    };
+    sil::exterior::SparseOperator<Kokkos::HostSpace> const sparse_operator
+            = sil::exterior::assemble_sparse_operator<ddc::detail::TypeSeq<
+                    DDimX,
+                    DDimY>>(exec_space, in_dom, out_dom, apply_rotational);
+    EXPECT_EQ(sparse_operator.nb_rows, out_dom.size());
+    EXPECT_EQ(sparse_operator.nb_columns, in_dom.size());
+    // Every face is bounded by four edges.
+    EXPECT_EQ(sparse_operator.nnz(), 4 * out_dom.size());
+
+    ddc::Chunk in_alloc(in_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor in(in_alloc);
+    std::size_t index = 0;
+    ddc::host_for_each(in_dom, [&](auto elem) {
+        in_alloc(elem) = static_cast<double>((7 * index++) % 11) - 5.;
+    });
+    ddc::Chunk direct_alloc(out_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor direct(direct_alloc);
+    apply_rotational(in, direct);
+
+    ddc::Chunk assembled_alloc(out_dom, ddc::HostAllocator<double>());
+    sil::exterior::apply_sparse_operator(
+            exec_space,
+            sparse_operator,
+            Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                    in_alloc.data_handle(),
+                    in_dom.size()),
+            Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                    assembled_alloc.data_handle(),
+                    out_dom.size()));
+    exec_space.fence();
+    ddc::host_for_each(out_dom, [&](auto elem) {
+        EXPECT_DOUBLE_EQ(assembled_alloc(elem), direct_alloc(elem));
+    });
+}
+
+// The pointwise Hodge star of 1-forms only couples the components at the same node.
+TEST(SparseAssembly, 2DHodgeStar)
+{
+    ddc::DiscreteDomain<DDimX, DDimY> const mesh_xy = init_mesh();
+    Geometry geometry(mesh_xy);
+    using HodgeStarDomain = sil::exterior::
+            hodge_star_domain_t<ddc::detail::TypeSeq<MuUp>, ddc::detail::TypeSeq<NuLow>>;
+    [[maybe_unused]] sil::tensor::tensor_accessor_for_domain_t<HodgeStarDomain> hodge_star_accessor;
+    ddc::cartesian_prod_t<ddc::DiscreteDomain<DDimX, DDimY>, HodgeStarDomain>
+            hodge_star_dom(mesh_xy, hodge_star_accessor.domain());
+    ddc::Chunk hodge_star_alloc(hodge_star_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor hodge_star(hodge_star_alloc);
+    sil::exterior::fill_discrete_hodge_star<
+            ddc::detail::TypeSeq<MuUp>,
+            ddc::detail::TypeSeq<NuLow>>(
+            Kokkos::DefaultHostExecutionSpace(),
+            hodge_star,
+            geometry.metric(),
+            geometry.position());
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<MuLow> in_accessor;
+    [[maybe_unused]] sil::tensor::TensorAccessor<NuLow> out_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, MuLow> const in_dom(mesh_xy, in_accessor.domain());
+    ddc::DiscreteDomain<DDimX, DDimY, NuLow> const out_dom(mesh_xy, out_accessor.domain());
+    auto const apply_hodge_star = [&](auto input, auto output) {
+        ddc::host_for_each(mesh_xy, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+            sil::tensor::tensor_prod(output[elem], hodge_star[elem], input[elem]);
+        });
+    };
+    sil::exterior::SparseOperator<Kokkos::HostSpace> const sparse_operator
+            = assemble_and_compare(in_dom, out_dom, apply_hodge_star, 0);
+    EXPECT_LE(sparse_operator.nnz(), 2 * out_dom.size());
+
+    reset_mesh();
+}
+
+/*
+ * Staged codifferential of 1-forms. The stencil radius is taken larger than needed, which only
+ * adds colors.
+ */
+TEST(SparseAssembly, 2DCodifferential)
+{
+    ddc::DiscreteDomain<DDimX, DDimY> const mesh_xy = init_mesh();
+    Geometry geometry(mesh_xy);
+    using OutputIndex = sil::tensor::Covariant<sil::tensor::ScalarIndex>;
+    [[maybe_unused]] sil::tensor::TensorAccessor<MuLow> in_accessor;
+    [[maybe_unused]] sil::tensor::TensorAccessor<OutputIndex> out_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, MuLow> const in_dom(mesh_xy, in_accessor.domain());
+    ddc::DiscreteDomain<DDimX, DDimY, OutputIndex> const out_dom(mesh_xy, out_accessor.domain());
+    ddc::Chunk form_alloc(in_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor form(form_alloc);
+
+    auto staged_codifferential
+            = sil::exterior::make_staged_codifferential<MetricIndex, MuLow, MuLow>(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    form,
+                    geometry.metric(),
+                    geometry.position());
+    auto const apply_codifferential
+            = [&](auto input, auto output) { staged_codifferential.run(output, input); };
+    assemble_and_compare(in_dom, out_dom, apply_codifferential, 2);
+
+    reset_mesh();
+}
+
+/*
+ * csr_from_sparse_operator copies the arrays of the sparse operator into a Ginkgo CSR matrix, which
+ * applies as the sparse operator.
+ */
+TEST(SparseAssembly, CsrFromSparseOperator)
+{
+    ddc::DiscreteDomain<DDimX, DDimY> const mesh_xy = init_mesh();
+    [[maybe_unused]] sil::tensor::TensorAccessor<InIndex> in_accessor;
+    [[maybe_unused]] sil::tensor::TensorAccessor<OutIndex> out_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, InIndex> const in_dom(mesh_xy, in_accessor.domain());
+    ddc::DiscreteDomain<DDimX, DDimY, OutIndex> const out_dom(
+            mesh_xy.remove_last(ddc::DiscreteVector<DDimX, DDimY>(1, 1)),
+            out_accessor.domain());
+    auto const apply_rotational = [&](auto input, auto output) {
+        sil::exterior::deriv<Nu2, InIndex>(Kokkos::DefaultHostExecutionSpace(), output, input);
+    };
+    sil::exterior::SparseOperator<Kokkos::HostSpace> const sparse_operator
+            = assemble_and_compare(in_dom, out_dom, apply_rotational, 1);
+
+    auto const gko_exec = gko::ext::kokkos::create_executor(Kokkos::DefaultHostExecutionSpace());
+    std::shared_ptr<gko::matrix::Csr<double, gko::int32>> const csr
+            = similie::solvers::detail::
+                    csr_from_sparse_operator(gko_exec, gko_exec, sparse_operator);
+    EXPECT_EQ(csr->get_size(), gko::dim<2>(out_dom.size(), in_dom.size()));
+    ASSERT_EQ(csr->get_num_stored_elements(), sparse_operator.nnz());
+    for (std::size_t row = 0; row <= sparse_operator.nb_rows; ++row) {
+        EXPECT_EQ(csr->get_const_row_ptrs()[row], sparse_operator.row_ptrs(row));
+    }
+    for (std::size_t entry = 0; entry < sparse_operator.nnz(); ++entry) {
+        EXPECT_EQ(csr->get_const_col_idxs()[entry], sparse_operator.columns(entry));
+        EXPECT_EQ(csr->get_const_values()[entry], sparse_operator.values(entry));
+    }
+
+    auto const input = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(in_dom.size(), 1));
+    auto const output
+            = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(out_dom.size(), 1));
+    for (std::size_t column = 0; column < in_dom.size(); ++column) {
+        input->at(column, 0) = static_cast<double>((7 * column) % 11) - 5.;
+    }
+    csr->apply(input.get(), output.get());
+    Kokkos::View<double*, Kokkos::HostSpace> expected("expected", out_dom.size());
+    sil::exterior::apply_sparse_operator(
+            Kokkos::DefaultHostExecutionSpace(),
+            sparse_operator,
+            Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                    input->get_values(),
+                    in_dom.size()),
+            expected);
+    Kokkos::DefaultHostExecutionSpace().fence();
+    for (std::size_t row = 0; row < out_dom.size(); ++row) {
+        EXPECT_NEAR(output->at(row, 0), expected(row), 1e-12);
+    }
+
+    reset_mesh();
+}
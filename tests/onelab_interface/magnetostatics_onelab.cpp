@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include "magnetostatics_onelab.hpp"
+
+namespace local = similie::onelab_interface::magnetostatics_onelab::magnetostatics_local;
+
+using memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+using csr_type = gko::matrix::Csr<double, gko::int32>;
+
+static constexpr double s_mu0 = 4.0e-7 * std::numbers::pi;
+
+// Node coordinates 0, 1, ... stretched by a quadratic term so that the grid is not uniform.
+static Kokkos::View<double*> stretched_coords(std::size_t nb_nodes)
+{
+    Kokkos::View<double*> coords("coords", nb_nodes);
+    auto coords_host = Kokkos::create_mirror_view(coords);
+    for (std::size_t i = 0; i < nb_nodes; ++i) {
+        coords_host(i) = static_cast<double>(i) + 0.1 * static_cast<double>(i * i);
+    }
+    Kokkos::deep_copy(coords, coords_host);
+    return coords;
+}
+
+static Kokkos::View<double**>
+pseudo_random_state(std::size_t size, std::size_t seed, double amplitude)
+{
+    Kokkos::View<double**> state("state", size, 1);
+    auto state_host = Kokkos::create_mirror_view(state);
+    for (std::size_t row = 0; row < size; ++row) {
+        state_host(row, 0) = amplitude * (static_cast<double>((7 * (row + seed)) % 13) - 6.);
+    }
+    Kokkos::deep_copy(state, state_host);
+    return state;
+}
+
+// Permeability of the nodes of a 3D grid, the nodes with i < 2 being ferromagnetic.
+struct MaterialFields3D
+{
+    using domain_type = ddc::
+            DiscreteDomain<local::DDimX, local::DDimY, local::DDimZ, local::ScalarPotentialIndex>;
+
+    local::scalar_tensor_alloc_type_3d<memory_space> mu_alloc;
+    local::scalar_tensor_alloc_type_3d<memory_space> ferromagnetic_alloc;
+
+    MaterialFields3D(std::size_t nx, std::size_t ny, std::size_t nz)
+        : mu_alloc(domain(nx, ny, nz), ddc::KokkosAllocator<double, memory_space>())
+        , ferromagnetic_alloc(domain(nx, ny, nz), ddc::KokkosAllocator<double, memory_space>())
+    {
+        auto mu_host = Kokkos::create_mirror_view(mu_alloc.allocation_kokkos_view());
+        auto ferromagnetic_host
+                = Kokkos::create_mirror_view(ferromagnetic_alloc.allocation_kokkos_view());
+        for (std::size_t k = 0; k < nz; ++k) {
+            for (std::size_t j = 0; j < ny; ++j) {
+                for (std::size_t i = 0; i < nx; ++i) {
+                    mu_host(i, j, k, 0) = i < 2 ? 1000. * s_mu0 : s_mu0;
+                    ferromagnetic_host(i, j, k, 0) = i < 2 ? 1. : 0.;
+                }
+            }
+        }
+        Kokkos::deep_copy(mu_alloc.allocation_kokkos_view(), mu_host);
+        Kokkos::deep_copy(ferromagnetic_alloc.allocation_kokkos_view(), ferromagnetic_host);
+    }
+
+    static domain_type domain(std::size_t nx, std::size_t ny, std::size_t nz)
+    {
+        return domain_type(
+                ddc::DiscreteDomain<local::DDimX, local::DDimY, local::DDimZ>(
+                        ddc::DiscreteElement<local::DDimX, local::DDimY, local::DDimZ>(0, 0, 0),
+                        ddc::DiscreteVector<local::DDimX, local::DDimY, local::DDimZ>(nx, ny, nz)),
+                sil::tensor::TensorAccessor<local::ScalarPotentialIndex>().domain());
+    }
+};
+
+/*
+ * The matrices must hold the same entries row by row, the rows of actual being sorted by column.
+ * Repeated columns are kept by both assemblies, so the entries are compared as sorted lists.
+ */
+static void expect_same_csr(
+        std::shared_ptr<csr_type const> const& actual,
+        std::shared_ptr<csr_type const> const& expected)
+{
+    auto const host_exec = actual->get_executor()->get_master();
+    auto const actual_host = gko::clone(host_exec, actual);
+    auto const expected_host = gko::clone(host_exec, expected);
+    ASSERT_EQ(actual_host->get_size(), expected_host->get_size());
+    ASSERT_EQ(actual_host->get_num_stored_elements(), expected_host->get_num_stored_elements());
+    for (std::size_t row = 0; row < actual_host->get_size()[0]; ++row) {
+        std::vector<std::pair<gko::int32, double>> actual_entries;
+        std::vector<std::pair<gko::int32, double>> expected_entries;
+        for (gko::int32 entry = actual_host->get_const_row_ptrs()[row];
+             entry < actual_host->get_const_row_ptrs()[row + 1];
+             ++entry) {
+            actual_entries.emplace_back(
+                    actual_host->get_const_col_idxs()[entry],
+                    actual_host->get_const_values()[entry]);
+        }
+        for (gko::int32 entry = expected_host->get_const_row_ptrs()[row];
+             entry < expected_host->get_const_row_ptrs()[row + 1];
+             ++entry) {
+            expected_entries.emplace_back(
+                    expected_host->get_const_col_idxs()[entry],
+                    expected_host->get_const_values()[entry]);
+        }
+        EXPECT_TRUE(std::is_sorted(
+                actual_entries.begin(),
+                actual_entries.end(),
+                [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; }))
+                << "row " << row;
+        std::sort(actual_entries.begin(), actual_entries.end());
+        std::sort(expected_entries.begin(), expected_entries.end());
+        ASSERT_EQ(actual_entries.size(), expected_entries.size()) << "row " << row;
+        for (std::size_t i = 0; i < actual_entries.size(); ++i) {
+            EXPECT_EQ(actual_entries[i].first, expected_entries[i].first) << "row " << row;
+            EXPECT_DOUBLE_EQ(actual_entries[i].second, expected_entries[i].second)
+                    << "row " << row;
+        }
+    }
+}
+
+// The 2D operator drops the zero entries of its rows, whichever path assembles it.
+TEST(MagnetostaticsOnelab, DeviceCsrMatches2DMatrixData)
+{
+    std::size_t const nx = 7;
+    std::size_t const ny = 6;
+    local::scalar_tensor_alloc_type<memory_space> mu_alloc(
+            ddc::DiscreteDomain<local::DDimX, local::DDimY, local::ScalarPotentialIndex>(
+                    ddc::DiscreteDomain<local::DDimX, local::DDimY>(
+                            ddc::DiscreteElement<local::DDimX, local::DDimY>(0, 0),
+                            ddc::DiscreteVector<local::DDimX, local::DDimY>(nx, ny)),
+                    sil::tensor::TensorAccessor<local::ScalarPotentialIndex>().domain()),
+            ddc::KokkosAllocator<double, memory_space>());
+    auto mu_host = Kokkos::create_mirror_view(mu_alloc.allocation_kokkos_view());
+    for (std::size_t j = 0; j < ny; ++j) {
+        for (std::size_t i = 0; i < nx; ++i) {
+            mu_host(i, j, 0) = i < 2 ? 1000. * s_mu0 : s_mu0;
+        }
+    }
+    Kokkos::deep_copy(mu_alloc.allocation_kokkos_view(), mu_host);
+    local::ScalarPotentialTensor2D<memory_space> mu_tensor(mu_alloc);
+    similie::physics::HamiltonEquations equations {
+            local::LinearMagnetostaticsHamiltonian<decltype(mu_tensor)>(mu_tensor)};
+    auto const operator_model = local::MagnetostaticsOperator2D<
+            memory_space,
+            decltype(equations),
+            local::MagneticVectorPotentialToMagneticInduction2D>(
+            equations,
+            stretched_coords(nx),
+            stretched_coords(ny),
+            similie::solvers::Criterion::MomentsTemporalDerivative);
+
+    auto const gko_exec = gko::ext::kokkos::create_executor(Kokkos::DefaultExecutionSpace());
+    std::shared_ptr<csr_type const> const csr
+            = local::assemble_csr_matrix(gko_exec, operator_model);
+    gko::matrix_data<double, gko::int32> const matrix_data
+            = local::assemble_matrix_data(operator_model);
+    expect_same_csr(csr, similie::solvers::detail::csr_from_matrix_data(gko_exec, matrix_data));
+
+    auto const csr_host = gko::clone(gko_exec->get_master(), csr);
+    for (std::size_t entry = 0; entry < csr_host->get_num_stored_elements(); ++entry) {
+        EXPECT_NE(csr_host->get_const_values()[entry], 0.);
+    }
+}
+
+// The 3D operator keeps the zero entries of its stencils in the sparsity pattern.
+TEST(MagnetostaticsOnelab, DeviceCsrMatches3DMatrixData)
+{
+    std::size_t const nx = 5;
+    std::size_t const ny = 4;
+    std::size_t const nz = 4;
+    MaterialFields3D const fields(nx, ny, nz);
+    local::ScalarPotentialTensor3D<memory_space> mu_tensor(fields.mu_alloc);
+    similie::physics::HamiltonEquations equations {
+            local::LinearMagnetostaticsHamiltonian<decltype(mu_tensor)>(mu_tensor)};
+    auto const operator_model = local::MagnetostaticsOperator3D<
+            memory_space,
+            decltype(equations),
+            local::MagneticVectorPotentialToMagneticInduction3D>(
+            equations,
+            stretched_coords(nx),
+            stretched_coords(ny),
+            stretched_coords(nz),
+            1.);
+
+    auto const gko_exec = gko::ext::kokkos::create_executor(Kokkos::DefaultExecutionSpace());
+    std::shared_ptr<csr_type const> const csr
+            = local::assemble_csr_matrix(gko_exec, operator_model);
+    gko::matrix_data<double, gko::int32> const matrix_data
+            = local::assemble_matrix_data(operator_model);
+    EXPECT_EQ(csr->get_num_stored_elements(), matrix_data.nonzeros.size());
+    expect_same_csr(csr, similie::solvers::detail::csr_from_matrix_data(gko_exec, matrix_data));
+}
+
+/*
+ * Refilling in place the Jacobian assembled at one state with its values at another state gives
+ * the Jacobian assembled at that state, the material being nonlinear. Both states are nonzero so
+ * that the off-diagonal couplings of the material, which vanish at the zero state, are stored. A
+ * matrix whose pattern misses entries is reassembled instead.
+ */
+TEST(MagnetostaticsOnelab, RefillMatchesFreshAssembly)
+{
+    std::size_t const nx = 5;
+    std::size_t const ny = 4;
+    std::size_t const nz = 4;
+    MaterialFields3D const fields(nx, ny, nz);
+    local::ScalarPotentialTensor3D<memory_space> mu_tensor(fields.mu_alloc);
+    local::ScalarPotentialTensor3D<memory_space> ferromagnetic_tensor(fields.ferromagnetic_alloc);
+    similie::physics::magnetostatics::InterpolatedNonlinearBHCurve<64> const curve(
+            local::to_padded_std_array<64>({0., 0.5, 1., 1.5, 2.}),
+            local::to_padded_std_array<64>({0., 100., 250., 1500., 20000.}),
+            5);
+    local::MaterialMagnetostaticsHamiltonian equations(mu_tensor, ferromagnetic_tensor, curve);
+    auto const operator_model = local::MagnetostaticsOperator3D<
+            memory_space,
+            decltype(equations),
+            local::MagneticVectorPotentialToMagneticInduction3D>(
+            equations,
+            stretched_coords(nx),
+            stretched_coords(ny),
+            stretched_coords(nz),
+            1.);
+    std::size_t const size = operator_model.size();
+
+    auto const gko_exec = gko::ext::kokkos::create_executor(Kokkos::DefaultExecutionSpace());
+    Kokkos::View<double**> const initial_state = pseudo_random_state(size, 0, 0.1);
+    Kokkos::View<double**> const state = pseudo_random_state(size, 5, 0.2);
+    std::shared_ptr<csr_type> const matrix
+            = local::assemble_csr_matrix(gko_exec, operator_model, initial_state);
+    auto const initial_host = gko::clone(gko_exec->get_master(), matrix);
+    std::shared_ptr<csr_type> const expected
+            = similie::solvers::detail::build_matrix(gko_exec, operator_model, state);
+
+    std::shared_ptr<csr_type> const refilled
+            = similie::solvers::detail::update_matrix(gko_exec, operator_model, state, matrix);
+    EXPECT_EQ(refilled.get(), matrix.get());
+    expect_same_csr(refilled, expected);
+    auto const refilled_host = gko::clone(gko_exec->get_master(), refilled);
+    double max_change = 0.;
+    for (std::size_t entry = 0; entry < refilled_host->get_num_stored_elements(); ++entry) {
+        max_change = std::max(
+                max_change,
+                std::abs(
+                        refilled_host->get_const_values()[entry]
+                        - initial_host->get_const_values()[entry]));
+    }
+    EXPECT_GT(max_change, 0.);
+
+    std::vector<gko::int32> diagonal_row_ptrs(size + 1);
+    std::vector<gko::int32> diagonal_columns(size);
+    for (std::size_t row = 0; row < size; ++row) {
+        diagonal_row_ptrs[row + 1] = static_cast<gko::int32>(row + 1);
+        diagonal_columns[row] = static_cast<gko::int32>(row);
+    }
+    std::shared_ptr<csr_type> const diagonal = csr_type::
+            create(gko_exec,
+                   gko::dim<2>(size, size),
+                   gko::array<double>(gko_exec, size),
+                   gko::array<gko::int32>(
+                           gko_exec,
+                           diagonal_columns.begin(),
+                           diagonal_columns.end()),
+                   gko::array<gko::int32>(
+                           gko_exec,
+                           diagonal_row_ptrs.begin(),
+                           diagonal_row_ptrs.end()));
+    std::shared_ptr<csr_type> const reassembled
+            = similie::solvers::detail::update_matrix(gko_exec, operator_model, state, diagonal);
+    EXPECT_NE(reassembled.get(), diagonal.get());
+    expect_same_csr(reassembled, expected);
+}
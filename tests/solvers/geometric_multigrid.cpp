@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include <gtest/gtest.h>
+#include <similie/solvers/geometric_multigrid.hpp>
+#include <similie/solvers/minimize_strong_formulation_residual.hpp>
+
+#include <Kokkos_Core.hpp>
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+using ViewType = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+static void fill_pseudo_random(ViewType view, std::size_t seed)
+{
+    for (std::size_t row = 0; row < view.extent(0); ++row) {
+        view(row, 0) = static_cast<double>((7 * (row + seed)) % 13) - 6.;
+    }
+}
+
+template <class XView, class YView>
+static double dot(XView x, YView y)
+{
+    double result = 0.;
+    for (std::size_t row = 0; row < x.extent(0); ++row) {
+        result += x(row, 0) * y(row, 0);
+    }
+    return result;
+}
+
+/*
+ * Dirichlet Laplacian of 0-forms on a square grid of extent x extent nodes, rediscretized by
+ * coarsen. The operator maps cochains to dual cochains (integrated residuals), whose 5-point
+ * stencil does not depend on the grid spacing in 2D. Boundary rows are the identity and interior
+ * rows ignore the boundary values, so that the operator is symmetric.
+ */
+class PoissonModel
+{
+    similie::solvers::StructuredCochainLayout<2, 1> m_layout;
+
+public:
+    static constexpr bool IS_LINEAR = true;
+
+    explicit PoissonModel(std::size_t extent) : m_layout {{extent, extent}, {0U}} {}
+
+    ExecSpace execution_space() const
+    {
+        return ExecSpace();
+    }
+
+    std::size_t size() const
+    {
+        return m_layout.size();
+    }
+
+    similie::solvers::StructuredCochainLayout<2, 1> multigrid_layout() const
+    {
+        return m_layout;
+    }
+
+    std::optional<PoissonModel> coarsen(ExecSpace) const
+    {
+        if (!similie::solvers::can_coarsen(m_layout)) {
+            return std::nullopt;
+        }
+        return PoissonModel(similie::solvers::coarsened_extent(m_layout.extents[0]));
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace exec_space, InputView input, OutputView output) const
+    {
+        std::size_t const n = m_layout.extents[0];
+        Kokkos::parallel_for(
+                "poisson_model_apply",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, size()),
+                KOKKOS_LAMBDA(std::size_t row) {
+                    std::size_t const i = row % n;
+                    std::size_t const j = row / n;
+                    auto const on_boundary = [n](std::size_t i_, std::size_t j_) {
+                        return i_ == 0 || j_ == 0 || i_ == n - 1 || j_ == n - 1;
+                    };
+                    if (on_boundary(i, j)) {
+                        output(row, 0) = input(row, 0);
+                        return;
+                    }
+                    double value = 4. * input(row, 0);
+                    for (std::size_t const neighbour : {row - 1, row + 1, row - n, row + n}) {
+                        if (!on_boundary(neighbour % n, neighbour / n)) {
+                            value -= input(neighbour, 0);
+                        }
+                    }
+                    output(row, 0) = value;
+                });
+        exec_space.fence();
+    }
+};
+
+// restrict_to_coarse must be the transpose of prolongate_and_add, for every form degree.
+TEST(GeometricMultigrid, RestrictionIsTransposedProlongation)
+{
+    ExecSpace const exec_space;
+    // Odd and even extents, 0-form and 1-form components.
+    similie::solvers::StructuredCochainLayout<2, 3> const fine_layout {{9, 8}, {0U, 1U, 2U}};
+    similie::solvers::StructuredCochainLayout<2, 3> const coarse_layout
+            = similie::solvers::coarsen(fine_layout);
+
+    ViewType coarse("coarse", coarse_layout.size(), 1);
+    ViewType fine("fine", fine_layout.size(), 1);
+    fill_pseudo_random(coarse, 0);
+    fill_pseudo_random(fine, 5);
+    ViewType prolongated("prolongated", fine_layout.size(), 1);
+    similie::solvers::prolongate_and_add(exec_space, fine_layout, coarse, prolongated);
+    ViewType restricted("restricted", coarse_layout.size(), 1);
+    similie::solvers::restrict_to_coarse(exec_space, fine_layout, fine, restricted);
+
+    EXPECT_NEAR(dot(prolongated, fine), dot(coarse, restricted), 1e-12);
+}
+
+/*
+ * The prolongation commutes with the coboundary: prolongating the coboundary of a coarse 0-form
+ * gives the coboundary of its prolongation.
+ */
+TEST(GeometricMultigrid, ProlongationCommutesWithCoboundary)
+{
+    ExecSpace const exec_space;
+    for (std::size_t const extent : {9U, 10U}) {
+        similie::solvers::StructuredCochainLayout<1, 1> const nodes_layout {{extent}, {0U}};
+        similie::solvers::StructuredCochainLayout<1, 1> const edges_layout {{extent}, {1U}};
+        std::size_t const coarse_extent = similie::solvers::coarsened_extent(extent);
+
+        // The edge attached to the last node does not exist and holds zero.
+        auto const coboundary = [](ViewType nodes, ViewType edges) {
+            for (std::size_t i = 0; i + 1 < nodes.extent(0); ++i) {
+                edges(i, 0) = nodes(i + 1, 0) - nodes(i, 0);
+            }
+            edges(nodes.extent(0) - 1, 0) = 0.;
+        };
+
+        ViewType coarse_nodes("coarse_nodes", coarse_extent, 1);
+        fill_pseudo_random(coarse_nodes, 0);
+        ViewType coarse_edges("coarse_edges", coarse_extent, 1);
+        coboundary(coarse_nodes, coarse_edges);
+
+        ViewType fine_nodes("fine_nodes", extent, 1);
+        similie::solvers::prolongate_and_add(exec_space, nodes_layout, coarse_nodes, fine_nodes);
+        ViewType coboundary_of_prolongated("coboundary_of_prolongated", extent, 1);
+        coboundary(fine_nodes, coboundary_of_prolongated);
+        ViewType prolongated_coboundary("prolongated_coboundary", extent, 1);
+        similie::solvers::
+                prolongate_and_add(exec_space, edges_layout, coarse_edges, prolongated_coboundary);
+
+        for (std::size_t i = 0; i < extent; ++i) {
+            EXPECT_NEAR(prolongated_coboundary(i, 0), coboundary_of_prolongated(i, 0), 1e-12);
+        }
+    }
+}
+
+/*
+ * Stationary iteration x += M (b - A x) with M one V-cycle, on A x = 0. The residual must be
+ * reduced at every cycle by a factor bounded independently of the grid, where Jacobi iterations
+ * alone would stall.
+ */
+TEST(GeometricMultigrid, PoissonConvergenceFactor)
+{
+    ExecSpace const exec_space;
+    auto const gko_exec = gko::ext::kokkos::create_executor(exec_space);
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.multigrid_coarse_size = 16U;
+    for (std::size_t const extent : {33U, 65U}) {
+        PoissonModel const model(extent);
+        std::shared_ptr<gko::LinOp const> const multigrid = similie::solvers::detail::
+                build_geometric_multigrid_preconditioner(gko_exec, exec_space, model, settings);
+
+        auto const residual
+                = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(model.size(), 1));
+        auto const correction
+                = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(model.size(), 1));
+        auto const residual_view = gko::ext::kokkos::map_data<Kokkos::HostSpace>(*residual);
+        auto const correction_view = gko::ext::kokkos::map_data<Kokkos::HostSpace>(*correction);
+        ViewType solution("solution", model.size(), 1);
+        fill_pseudo_random(solution, 0);
+
+        double residual_norm = 0.;
+        double factor = 0.;
+        for (int iteration = 0; iteration < 8; ++iteration) {
+            model.apply(exec_space, solution, residual_view);
+            for (std::size_t row = 0; row < model.size(); ++row) {
+                residual_view(row, 0) = -residual_view(row, 0);
+            }
+            double const previous_residual_norm = residual_norm;
+            residual_norm = std::sqrt(dot(residual_view, residual_view));
+            if (iteration > 0) {
+                factor = residual_norm / previous_residual_norm;
+            }
+            multigrid->apply(residual.get(), correction.get());
+            for (std::size_t row = 0; row < model.size(); ++row) {
+                solution(row, 0) += correction_view(row, 0);
+            }
+        }
+        EXPECT_LT(factor, 0.5) << "extent " << extent;
+    }
+}
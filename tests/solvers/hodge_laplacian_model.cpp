@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <similie/exterior/exterior.hpp>
+#include <similie/solvers/hodge_laplacian_model.hpp>
+#include <similie/tensor/identity_tensor.hpp>
+
+struct X
+{
+};
+
+struct Y
+{
+};
+
+struct DDimX : ddc::UniformPointSampling<X>
+{
+};
+
+struct DDimY : ddc::UniformPointSampling<Y>
+{
+};
+
+struct Mu2 : sil::tensor::TensorNaturalIndex<X, Y>
+{
+};
+
+using MetricIndex = sil::tensor::TensorIdentityIndex<
+        sil::tensor::Covariant<sil::tensor::MetricIndex1<X, Y>>,
+        sil::tensor::Covariant<sil::tensor::MetricIndex2<X, Y>>>;
+using PositionIndex = sil::tensor::Contravariant<sil::tensor::TensorNaturalIndex<X, Y>>;
+using InterestIndex = sil::tensor::Covariant<Mu2>;
+
+/*
+ * Calls run(exec_space, mesh_xy, metric, position) on a 16x12 uniform mesh of [-5, 5]^2 with an
+ * identity metric.
+ */
+template <class Function>
+static void run_on_mesh(Function&& run)
+{
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    ddc::Coordinate<X, Y> lower_bounds(-5., -5.);
+    ddc::Coordinate<X, Y> upper_bounds(5., 5.);
+    ddc::DiscreteVector<DDimX, DDimY> nb_cells(16, 12);
+    ddc::DiscreteDomain<DDimX> mesh_x = ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(
+            ddc::Coordinate<X>(lower_bounds),
+            ddc::Coordinate<X>(upper_bounds),
+            ddc::DiscreteVector<DDimX>(nb_cells)));
+    ddc::DiscreteDomain<DDimY> mesh_y = ddc::init_discrete_space<DDimY>(DDimY::init<DDimY>(
+            ddc::Coordinate<Y>(lower_bounds),
+            ddc::Coordinate<Y>(upper_bounds),
+            ddc::DiscreteVector<DDimY>(nb_cells)));
+    ddc::DiscreteDomain<DDimX, DDimY> mesh_xy(mesh_x, mesh_y);
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<MetricIndex> metric_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, MetricIndex> metric_dom(mesh_xy, metric_accessor.domain());
+    ddc::Chunk metric_alloc(metric_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor metric(metric_alloc);
+
+    [[maybe_unused]] sil::tensor::TensorAccessor<PositionIndex> position_accessor;
+    ddc::DiscreteDomain<DDimX, DDimY, PositionIndex>
+            position_dom(mesh_xy, position_accessor.domain());
+    ddc::Chunk position_alloc(position_dom, ddc::HostAllocator<double>());
+    sil::tensor::Tensor position(position_alloc);
+    ddc::host_for_each(mesh_xy, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+        position(elem, position_accessor.access_element<X>())
+                = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimX>(elem)));
+        position(elem, position_accessor.access_element<Y>())
+                = static_cast<double>(ddc::coordinate(ddc::DiscreteElement<DDimY>(elem)));
+    });
+
+    run(exec_space, mesh_xy, metric, position);
+
+    ddc::detail::g_discrete_space_dual<DDimX>.reset();
+    ddc::detail::g_discrete_space_dual<DDimY>.reset();
+}
+
+/*
+ * Solves laplacian(u) = f for a 1-form with Dirichlet boundary conditions. f is the discrete
+ * Laplacian of a smooth 1-form u_exact and the boundary values are those of u_exact, so u_exact is
+ * the exact discrete solution. Returns the diagnostics of the solve and the largest deviation of
+ * the solution from u_exact.
+ */
+static std::pair<similie::solvers::StrongFormulationSolverDiagnostics, double>
+solve_manufactured_poisson(similie::solvers::StrongFormulationSolverSettings const& settings)
+{
+    similie::solvers::StrongFormulationSolverDiagnostics diagnostics;
+    double error = 0.;
+    run_on_mesh([&](auto exec_space, auto mesh_xy, auto metric, auto position) {
+        [[maybe_unused]] sil::tensor::TensorAccessor<InterestIndex> accessor;
+        ddc::DiscreteDomain<DDimX, DDimY, InterestIndex> dom(mesh_xy, accessor.domain());
+        ddc::Chunk exact_alloc(dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor exact(exact_alloc);
+        ddc::host_for_each(mesh_xy, [&](ddc::DiscreteElement<DDimX, DDimY> elem) {
+            double const x = ddc::coordinate(ddc::DiscreteElement<DDimX>(elem));
+            double const y = ddc::coordinate(ddc::DiscreteElement<DDimY>(elem));
+            exact.mem(elem, accessor.access_element<X>())
+                    = std::sin(0.3 * x + 0.2) * std::cos(0.4 * y);
+            exact.mem(elem, accessor.access_element<Y>())
+                    = std::cos(0.5 * x) * std::sin(0.35 * y + 0.1);
+        });
+        ddc::Chunk rhs_alloc(dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor rhs(rhs_alloc);
+        auto laplacian = sil::exterior::
+                make_staged_laplacian<MetricIndex, InterestIndex, InterestIndex>(
+                        exec_space,
+                        rhs,
+                        exact,
+                        metric,
+                        position);
+        laplacian.run(rhs, exact);
+        exec_space.fence();
+
+        // The boundary values are read from the solution, its interior is overwritten.
+        ddc::Chunk solution_alloc(dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor solution(solution_alloc);
+        ddc::parallel_deepcopy(solution, exact);
+
+        auto const model = similie::solvers::
+                make_hodge_laplacian_model<MetricIndex, InterestIndex, InterestIndex>(
+                        exec_space,
+                        solution,
+                        metric,
+                        position);
+        diagnostics = similie::solvers::
+                solve_hodge_laplacian(exec_space, model, solution, rhs, settings);
+
+        ddc::host_for_each(dom, [&](auto elem) {
+            error = std::max(error, std::abs(solution.mem(elem) - exact.mem(elem)));
+        });
+    });
+    return {diagnostics, error};
+}
+
+TEST(HodgeLaplacianModel, FourierPreconditionedPoisson)
+{
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.preconditioner = similie::solvers::PreconditionerType::Fourier;
+    auto const [diagnostics, error] = solve_manufactured_poisson(settings);
+    EXPECT_TRUE(diagnostics.converged);
+    EXPECT_LE(diagnostics.final_relative_residual, settings.relative_tolerance);
+    EXPECT_NEAR(error, 0., 1e-8);
+}
+
+TEST(HodgeLaplacianModel, DirichletPoisson)
+{
+    similie::solvers::StrongFormulationSolverSettings settings;
+    for (bool const use_matrix_free : {true, false}) {
+        settings.use_matrix_free = use_matrix_free;
+        auto const [diagnostics, error] = solve_manufactured_poisson(settings);
+        EXPECT_TRUE(diagnostics.converged);
+        EXPECT_LE(diagnostics.final_relative_residual, settings.relative_tolerance);
+        EXPECT_NEAR(error, 0., 1e-8);
+    }
+}
+
+TEST(HodgeLaplacianModel, AssembledOperatorMatchesApply)
+{
+    run_on_mesh([&](auto exec_space, auto mesh_xy, auto metric, auto position) {
+        using view_type = Kokkos::
+                View<double**, Kokkos::LayoutRight, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+        using flat_view_type = Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+        [[maybe_unused]] sil::tensor::TensorAccessor<InterestIndex> accessor;
+        ddc::DiscreteDomain<DDimX, DDimY, InterestIndex> dom(mesh_xy, accessor.domain());
+        ddc::Chunk input_alloc(dom, ddc::HostAllocator<double>());
+        sil::tensor::Tensor input(input_alloc);
+        std::size_t index = 0;
+        ddc::host_for_each(dom, [&](auto elem) {
+            input.mem(elem) = static_cast<double>((7 * index++) % 11) - 5.;
+        });
+        ddc::Chunk applied_alloc(dom, ddc::HostAllocator<double>());
+        ddc::Chunk assembled_alloc(dom, ddc::HostAllocator<double>());
+
+        for (similie::solvers::HodgeLaplacianBoundary const boundary :
+             {similie::solvers::HodgeLaplacianBoundary::Natural,
+              similie::solvers::HodgeLaplacianBoundary::Dirichlet}) {
+            auto const model = similie::solvers::
+                    make_hodge_laplacian_model<MetricIndex, InterestIndex, InterestIndex>(
+                            exec_space,
+                            input,
+                            metric,
+                            position,
+                            boundary);
+            model.apply(
+                    exec_space,
+                    view_type(input_alloc.data_handle(), dom.size(), 1),
+                    view_type(applied_alloc.data_handle(), dom.size(), 1));
+
+            sil::exterior::SparseOperator<Kokkos::HostSpace> const sparse_operator
+                    = model.assemble_sparse_operator();
+            EXPECT_EQ(sparse_operator.nb_rows, dom.size());
+            EXPECT_EQ(sparse_operator.nb_columns, dom.size());
+            sil::exterior::apply_sparse_operator(
+                    exec_space,
+                    sparse_operator,
+                    flat_view_type(input_alloc.data_handle(), dom.size()),
+                    flat_view_type(assembled_alloc.data_handle(), dom.size()));
+            exec_space.fence();
+
+            ddc::host_for_each(dom, [&](auto elem) {
+                EXPECT_NEAR(assembled_alloc(elem), applied_alloc(elem), 1e-12);
+            });
+        }
+    });
+}
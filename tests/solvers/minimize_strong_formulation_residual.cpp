@@ -0,0 +1,525 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <similie/solvers/minimize_strong_formulation_residual.hpp>
+
+#include <Kokkos_Core.hpp>
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+using ViewType = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+static void fill_pseudo_random(ViewType view, std::size_t seed)
+{
+    for (std::size_t row = 0; row < view.extent(0); ++row) {
+        view(row, 0) = static_cast<double>((7 * (row + seed)) % 13) - 6.;
+    }
+}
+
+static double norm(ViewType view)
+{
+    double result = 0.;
+    for (std::size_t row = 0; row < view.extent(0); ++row) {
+        result += view(row, 0) * view(row, 0);
+    }
+    return std::sqrt(result);
+}
+
+// ||rhs - model(solution)|| / ||rhs||.
+template <class OperatorModel>
+static double relative_residual(OperatorModel const& model, ViewType rhs, ViewType solution)
+{
+    ViewType residual("residual", rhs.extent(0), 1);
+    model.apply(ExecSpace(), solution, residual);
+    for (std::size_t row = 0; row < rhs.extent(0); ++row) {
+        residual(row, 0) = rhs(row, 0) - residual(row, 0);
+    }
+    return norm(residual) / norm(rhs);
+}
+
+/*
+ * Dirichlet Laplacian of 0-forms on a square grid of extent x extent nodes, whose boundary rows
+ * are the identity and whose interior rows ignore the boundary values, so that it is symmetric
+ * positive definite. It is assembled by the assemble_matrix_data hook below.
+ */
+class PoissonModel
+{
+    std::size_t m_extent;
+
+public:
+    static constexpr bool IS_LINEAR = true;
+
+    explicit PoissonModel(std::size_t extent) : m_extent(extent) {}
+
+    ExecSpace execution_space() const
+    {
+        return ExecSpace();
+    }
+
+    std::size_t extent() const
+    {
+        return m_extent;
+    }
+
+    std::size_t size() const
+    {
+        return m_extent * m_extent;
+    }
+
+    bool on_boundary(std::size_t row) const
+    {
+        std::size_t const i = row % m_extent;
+        std::size_t const j = row / m_extent;
+        return i == 0 || j == 0 || i == m_extent - 1 || j == m_extent - 1;
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace, InputView input, OutputView output) const
+    {
+        std::size_t const n = m_extent;
+        for (std::size_t row = 0; row < size(); ++row) {
+            if (on_boundary(row)) {
+                output(row, 0) = input(row, 0);
+                continue;
+            }
+            double value = 4. * input(row, 0);
+            for (std::size_t const neighbour : {row - n, row - 1, row + 1, row + n}) {
+                if (!on_boundary(neighbour)) {
+                    value -= input(neighbour, 0);
+                }
+            }
+            output(row, 0) = value;
+        }
+    }
+};
+
+static gko::matrix_data<double, gko::int32> assemble_matrix_data(PoissonModel const& model)
+{
+    gko::matrix_data<double, gko::int32> matrix_data(gko::dim<2>(model.size(), model.size()));
+    std::size_t const n = model.extent();
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        if (model.on_boundary(row)) {
+            matrix_data.nonzeros.emplace_back(row, row, 1.);
+            continue;
+        }
+        for (std::size_t const column : {row - n, row - 1, row, row + 1, row + n}) {
+            if (column == row) {
+                matrix_data.nonzeros.emplace_back(row, column, 4.);
+            } else if (!model.on_boundary(column)) {
+                matrix_data.nonzeros.emplace_back(row, column, -1.);
+            }
+        }
+    }
+    return matrix_data;
+}
+
+/*
+ * The iterative refinement in double precision around single-precision CG solves must reach the
+ * double-precision tolerance, well below the accuracy of a single-precision solve.
+ */
+TEST(MinimizeStrongFormulationResidual, MixedPrecisionSession)
+{
+    PoissonModel const model(24);
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.use_matrix_free = false;
+    settings.use_mixed_precision = true;
+    settings.relative_tolerance = 1e-10;
+    similie::solvers::StrongFormulationSolver<ExecSpace, PoissonModel>
+            solver(ExecSpace(), model, settings);
+
+    ViewType rhs("rhs", model.size(), 1);
+    fill_pseudo_random(rhs, 0);
+    ViewType solution("solution", model.size(), 1);
+    similie::solvers::StrongFormulationSolverDiagnostics const diagnostics
+            = solver.solve(rhs, solution);
+
+    EXPECT_TRUE(diagnostics.converged);
+    EXPECT_LE(diagnostics.final_relative_residual, settings.relative_tolerance);
+    EXPECT_LT(relative_residual(model, rhs, solution), 1e-9);
+}
+
+/*
+ * PoissonModel plus the cubic term u^3 on the interior rows, whose Jacobian A + 3 diag(u^2) is
+ * assembled and applied by the hooks below. The assemblies are counted, one per Newton iteration.
+ */
+class CubicPoissonModel
+{
+    PoissonModel m_linear_model;
+    mutable unsigned int m_nb_assemblies = 0U;
+
+public:
+    static constexpr bool IS_LINEAR = false;
+
+    explicit CubicPoissonModel(std::size_t extent) : m_linear_model(extent) {}
+
+    ExecSpace execution_space() const
+    {
+        return ExecSpace();
+    }
+
+    std::size_t size() const
+    {
+        return m_linear_model.size();
+    }
+
+    PoissonModel const& linear_model() const
+    {
+        return m_linear_model;
+    }
+
+    unsigned int nb_assemblies() const
+    {
+        return m_nb_assemblies;
+    }
+
+    void count_assembly() const
+    {
+        ++m_nb_assemblies;
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace exec_space, InputView input, OutputView output) const
+    {
+        m_linear_model.apply(exec_space, input, output);
+        for (std::size_t row = 0; row < size(); ++row) {
+            if (!m_linear_model.on_boundary(row)) {
+                output(row, 0) += input(row, 0) * input(row, 0) * input(row, 0);
+            }
+        }
+    }
+};
+
+template <class StateView>
+static gko::matrix_data<double, gko::int32> assemble_matrix_data(
+        CubicPoissonModel const& model,
+        StateView state)
+{
+    model.count_assembly();
+    gko::matrix_data<double, gko::int32> matrix_data = assemble_matrix_data(model.linear_model());
+    for (auto& entry : matrix_data.nonzeros) {
+        std::size_t const row = static_cast<std::size_t>(entry.row);
+        if (entry.row == entry.column && !model.linear_model().on_boundary(row)) {
+            entry.value += 3. * state(row, 0) * state(row, 0);
+        }
+    }
+    return matrix_data;
+}
+
+template <class StateView, class InputView, class OutputView>
+static void apply_jacobian(
+        ExecSpace exec_space,
+        CubicPoissonModel const& model,
+        StateView state,
+        InputView input,
+        OutputView output)
+{
+    model.linear_model().apply(exec_space, input, output);
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        if (!model.linear_model().on_boundary(row)) {
+            output(row, 0) += 3. * state(row, 0) * state(row, 0) * input(row, 0);
+        }
+    }
+}
+
+// CubicPoissonModel without the Jacobian hooks.
+class HooklessCubicPoissonModel
+{
+    CubicPoissonModel m_model;
+
+public:
+    static constexpr bool IS_LINEAR = false;
+
+    explicit HooklessCubicPoissonModel(std::size_t extent) : m_model(extent) {}
+
+    ExecSpace execution_space() const
+    {
+        return ExecSpace();
+    }
+
+    std::size_t size() const
+    {
+        return m_model.size();
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace exec_space, InputView input, OutputView output) const
+    {
+        m_model.apply(exec_space, input, output);
+    }
+};
+
+// Right-hand side whose solution by the cubic model is expected.
+static ViewType cubic_poisson_rhs(CubicPoissonModel const& model, ViewType expected)
+{
+    fill_pseudo_random(expected, 0);
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        expected(row, 0) *= 0.25;
+    }
+    ViewType rhs("rhs", model.size(), 1);
+    model.apply(ExecSpace(), expected, rhs);
+    return rhs;
+}
+
+/*
+ * Jacobian-free Newton-Krylov reaches the solution of the assembled Newton iterations. It is the
+ * only mode of a model without Jacobian hooks, whose preconditioner is then built once instead of
+ * at every Newton iteration.
+ */
+TEST(MinimizeStrongFormulationResidual, JacobianFreeNewtonKrylov)
+{
+    CubicPoissonModel const model(8);
+    ViewType expected("expected", model.size(), 1);
+    ViewType const rhs = cubic_poisson_rhs(model, expected);
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.relative_tolerance = 1e-10;
+
+    ViewType assembled("assembled", model.size(), 1);
+    similie::solvers::StrongFormulationSolverDiagnostics const assembled_diagnostics
+            = similie::solvers::minimize_strong_formulation_residual(
+                    ExecSpace(),
+                    model,
+                    rhs,
+                    assembled,
+                    settings);
+    EXPECT_TRUE(assembled_diagnostics.converged);
+    EXPECT_GT(assembled_diagnostics.preconditioner_rebuilds, 1U);
+
+    settings.use_jacobian_free = true;
+    ViewType jacobian_free("jacobian_free", model.size(), 1);
+    similie::solvers::StrongFormulationSolverDiagnostics const jacobian_free_diagnostics
+            = similie::solvers::minimize_strong_formulation_residual(
+                    ExecSpace(),
+                    model,
+                    rhs,
+                    jacobian_free,
+                    settings);
+    EXPECT_TRUE(jacobian_free_diagnostics.converged);
+    EXPECT_EQ(jacobian_free_diagnostics.preconditioner_rebuilds, 1U);
+
+    settings.use_jacobian_free = false;
+    HooklessCubicPoissonModel const hookless_model(8);
+    ViewType hookless("hookless", model.size(), 1);
+    similie::solvers::StrongFormulationSolverDiagnostics const hookless_diagnostics
+            = similie::solvers::minimize_strong_formulation_residual(
+                    ExecSpace(),
+                    hookless_model,
+                    rhs,
+                    hookless,
+                    settings);
+    EXPECT_TRUE(hookless_diagnostics.converged);
+    EXPECT_EQ(hookless_diagnostics.preconditioner_rebuilds, 1U);
+
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        EXPECT_NEAR(assembled(row, 0), expected(row, 0), 1e-8) << "row " << row;
+        EXPECT_NEAR(jacobian_free(row, 0), assembled(row, 0), 1e-8) << "row " << row;
+        EXPECT_NEAR(hookless(row, 0), assembled(row, 0), 1e-8) << "row " << row;
+    }
+}
+
+/*
+ * Eisenstat-Walker forcing terms, their safeguards against a sudden decrease, the floor avoiding
+ * to oversolve the last iteration and the clamp to [relative_tolerance, newton_forcing_max].
+ */
+TEST(MinimizeStrongFormulationResidual, NewtonForcingTerm)
+{
+    using similie::solvers::NewtonForcing;
+    using similie::solvers::detail::newton_forcing_term;
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.relative_tolerance = 1e-6;
+    settings.newton_forcing_initial = 0.3;
+    settings.newton_forcing_max = 0.9;
+
+    // Arguments: iteration, initial, current and previous residuals, previous linear residual and
+    // previous forcing term.
+    settings.newton_forcing = NewtonForcing::Constant;
+    EXPECT_EQ(newton_forcing_term(settings, 3, 1., 0.5, 1., 0.3, 0.1), 1e-6);
+
+    settings.newton_forcing = NewtonForcing::EisenstatWalker1;
+    EXPECT_NEAR(newton_forcing_term(settings, 0, 1., 1., 0., 0., 0.), 0.3, 1e-15);
+    // |0.5 - 0.3| / 1, the safeguard 0.1^phi being below the threshold 0.1.
+    EXPECT_NEAR(newton_forcing_term(settings, 1, 1., 0.5, 1., 0.3, 0.1), 0.2, 1e-15);
+    // The safeguard 0.5^phi exceeds both the threshold and the forcing term.
+    EXPECT_NEAR(
+            newton_forcing_term(settings, 1, 1., 0.5, 1., 0.3, 0.5),
+            std::pow(0.5, 1.618033988749895),
+            1e-15);
+
+    settings.newton_forcing = NewtonForcing::EisenstatWalker2;
+    EXPECT_NEAR(newton_forcing_term(settings, 0, 1., 1., 0., 0., 0.), 0.3, 1e-15);
+    // 0.9 (0.5 / 1)^2, the safeguard 0.9 0.3^2 being below the threshold 0.1.
+    EXPECT_NEAR(newton_forcing_term(settings, 1, 1., 0.5, 1., 0., 0.3), 0.225, 1e-15);
+    // The safeguard 0.9 0.6^2 exceeds both the threshold and the forcing term.
+    EXPECT_NEAR(newton_forcing_term(settings, 1, 1., 0.5, 1., 0., 0.6), 0.324, 1e-15);
+    // The floor 0.5 relative_tolerance initial / current exceeds 0.9 (1e-5 / 1e-2)^2.
+    EXPECT_NEAR(newton_forcing_term(settings, 1, 1., 1e-5, 1e-2, 0., 0.01), 0.05, 1e-15);
+    // Never below relative_tolerance.
+    EXPECT_EQ(newton_forcing_term(settings, 1, 1., 1., 1e6, 0., 1e-3), 1e-6);
+    // Never above newton_forcing_max, here below 0.9 (2 / 1)^2.
+    settings.newton_forcing_max = 0.5;
+    EXPECT_EQ(newton_forcing_term(settings, 1, 1., 2., 1., 0., 0.3), 0.5);
+    settings.newton_forcing_initial = 0.8;
+    EXPECT_EQ(newton_forcing_term(settings, 0, 1., 1., 0., 0., 0.), 0.5);
+}
+
+/*
+ * The preconditioner is rebuilt at every Newton iteration by default, and less often when it may
+ * be reused, the Newton correction still using the current Jacobian.
+ */
+TEST(MinimizeStrongFormulationResidual, LaggedPreconditioner)
+{
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.relative_tolerance = 1e-10;
+
+    CubicPoissonModel const model(8);
+    ViewType expected("expected", model.size(), 1);
+    ViewType const rhs = cubic_poisson_rhs(model, expected);
+    ViewType solution("solution", model.size(), 1);
+    similie::solvers::StrongFormulationSolverDiagnostics const diagnostics
+            = similie::solvers::minimize_strong_formulation_residual(
+                    ExecSpace(),
+                    model,
+                    rhs,
+                    solution,
+                    settings);
+    EXPECT_TRUE(diagnostics.converged);
+    EXPECT_GT(model.nb_assemblies(), 1U);
+    EXPECT_EQ(diagnostics.preconditioner_rebuilds, model.nb_assemblies());
+
+    // The growth of the inner iterations is ignored to only test the reuse count.
+    settings.preconditioner_reuse_iterations = 4U;
+    settings.preconditioner_reuse_iterations_growth = 1e6;
+    CubicPoissonModel const lagged_model(8);
+    ViewType lagged_solution("lagged_solution", model.size(), 1);
+    similie::solvers::StrongFormulationSolverDiagnostics const lagged_diagnostics
+            = similie::solvers::minimize_strong_formulation_residual(
+                    ExecSpace(),
+                    lagged_model,
+                    rhs,
+                    lagged_solution,
+                    settings);
+    EXPECT_TRUE(lagged_diagnostics.converged);
+    EXPECT_GT(lagged_model.nb_assemblies(), 1U);
+    EXPECT_LT(lagged_diagnostics.preconditioner_rebuilds, lagged_model.nb_assemblies());
+    EXPECT_EQ(
+            lagged_diagnostics.preconditioner_rebuilds,
+            (lagged_model.nb_assemblies() + 3U) / 4U);
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        EXPECT_NEAR(lagged_solution(row, 0), solution(row, 0), 1e-8) << "row " << row;
+    }
+}
+
+/*
+ * CG preconditioned by algebraic multigrid converges on two refinements of the Poisson problem,
+ * its iterations growing well below the doubling of the Jacobi-preconditioned ones.
+ */
+TEST(MinimizeStrongFormulationResidual, AlgebraicMultigridRefinement)
+{
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.use_matrix_free = false;
+    settings.relative_tolerance = 1e-8;
+    settings.preconditioner = similie::solvers::PreconditionerType::AlgebraicMultigrid;
+    settings.multigrid_coarse_size = 16U;
+
+    std::array<unsigned int, 2> iterations {};
+    std::array<std::size_t, 2> const extents {33U, 65U};
+    for (std::size_t refinement = 0; refinement < extents.size(); ++refinement) {
+        PoissonModel const model(extents[refinement]);
+        ViewType rhs("rhs", model.size(), 1);
+        fill_pseudo_random(rhs, 0);
+        ViewType solution("solution", model.size(), 1);
+        similie::solvers::StrongFormulationSolverDiagnostics const diagnostics
+                = similie::solvers::minimize_strong_formulation_residual(
+                        ExecSpace(),
+                        model,
+                        rhs,
+                        solution,
+                        settings);
+        EXPECT_TRUE(diagnostics.converged) << "extent " << extents[refinement];
+        EXPECT_LT(relative_residual(model, rhs, solution), 1e-7)
+                << "extent " << extents[refinement];
+        iterations[refinement] = diagnostics.iterations;
+    }
+    EXPECT_GT(iterations[0], 0U);
+    EXPECT_LT(static_cast<double>(iterations[1]), 1.5 * static_cast<double>(iterations[0]));
+}
+
+/*
+ * A session solving several right-hand sides, matrix-free or assembled, gives the solutions and
+ * iterations of a minimize_strong_formulation_residual call per right-hand side.
+ */
+TEST(MinimizeStrongFormulationResidual, SessionMatchesFreeFunction)
+{
+    PoissonModel const model(24);
+    for (bool const use_matrix_free : {true, false}) {
+        similie::solvers::StrongFormulationSolverSettings settings;
+        settings.use_matrix_free = use_matrix_free;
+        settings.relative_tolerance = 1e-10;
+        similie::solvers::StrongFormulationSolver<ExecSpace, PoissonModel>
+                solver(ExecSpace(), model, settings);
+        for (std::size_t const seed : {0U, 5U}) {
+            ViewType rhs("rhs", model.size(), 1);
+            fill_pseudo_random(rhs, seed);
+            ViewType session_solution("session_solution", model.size(), 1);
+            similie::solvers::StrongFormulationSolverDiagnostics const session_diagnostics
+                    = solver.solve(rhs, session_solution);
+            ViewType solution("solution", model.size(), 1);
+            similie::solvers::StrongFormulationSolverDiagnostics const diagnostics
+                    = similie::solvers::minimize_strong_formulation_residual(
+                            ExecSpace(),
+                            model,
+                            rhs,
+                            solution,
+                            settings);
+
+            EXPECT_TRUE(session_diagnostics.converged);
+            EXPECT_EQ(session_diagnostics.iterations, diagnostics.iterations);
+            for (std::size_t row = 0; row < model.size(); ++row) {
+                EXPECT_NEAR(session_solution(row, 0), solution(row, 0), 1e-10)
+                        << "matrix-free " << use_matrix_free << " seed " << seed << " row "
+                        << row;
+            }
+        }
+    }
+}
+
+// The Ell, Sellp and Hybrid conversions of the assembled matrix apply as the CSR matrix.
+TEST(MinimizeStrongFormulationResidual, MatrixFormatConversion)
+{
+    using similie::solvers::MatrixFormat;
+    PoissonModel const model(12);
+    auto const gko_exec = gko::ext::kokkos::create_executor(ExecSpace());
+    std::shared_ptr<gko::LinOp const> const csr = similie::solvers::detail::
+            csr_from_matrix_data(gko_exec, assemble_matrix_data(model));
+
+    auto const input = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(model.size(), 1));
+    auto const expected
+            = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(model.size(), 1));
+    auto const output = gko::matrix::Dense<double>::create(gko_exec, gko::dim<2>(model.size(), 1));
+    auto const input_view = gko::ext::kokkos::map_data<Kokkos::HostSpace>(*input);
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        input_view(row, 0) = static_cast<double>((7 * row) % 13) - 6.;
+    }
+    csr->apply(input.get(), expected.get());
+    auto const expected_view = gko::ext::kokkos::map_data<Kokkos::HostSpace>(*expected);
+    auto const output_view = gko::ext::kokkos::map_data<Kokkos::HostSpace>(*output);
+
+    similie::solvers::StrongFormulationSolverSettings settings;
+    EXPECT_EQ(similie::solvers::detail::convert_matrix_format(csr, settings).get(), csr.get());
+    for (MatrixFormat const matrix_format :
+         {MatrixFormat::Ell, MatrixFormat::Sellp, MatrixFormat::Hybrid}) {
+        settings.matrix_format = matrix_format;
+        std::shared_ptr<gko::LinOp const> const converted
+                = similie::solvers::detail::convert_matrix_format(csr, settings);
+        EXPECT_NE(converted.get(), csr.get());
+        converted->apply(input.get(), output.get());
+        for (std::size_t row = 0; row < model.size(); ++row) {
+            EXPECT_NEAR(output_view(row, 0), expected_view(row, 0), 1e-12)
+                    << similie::solvers::matrix_format_name(matrix_format) << " row " << row;
+        }
+    }
+}
@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+#include <similie/solvers/minimize_strong_formulation_residual.hpp>
+#include <similie/solvers/solution_extrapolation.hpp>
+
+#include <Kokkos_Core.hpp>
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+using ViewType = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+static constexpr std::size_t s_size = 10;
+
+// Snapshot a + parameter b + parameter^2 c, the coefficients being two-column vectors.
+static ViewType polynomial_snapshot(double parameter, bool quadratic)
+{
+    ViewType snapshot("snapshot", s_size, 2);
+    for (std::size_t row = 0; row < s_size; ++row) {
+        for (std::size_t column = 0; column < 2; ++column) {
+            double const a = static_cast<double>(row) - 3. * static_cast<double>(column);
+            double const b = static_cast<double>((5 * row + column) % 7) - 3.;
+            double const c = quadratic ? static_cast<double>((3 * row) % 4) - 1.5 : 0.;
+            snapshot(row, column) = a + parameter * b + parameter * parameter * c;
+        }
+    }
+    return snapshot;
+}
+
+// Diagonal operator with entries 1, 2, ..., 5, assembled by the assemble_matrix_data hook below.
+class DiagonalModel
+{
+public:
+    static constexpr bool IS_LINEAR = true;
+
+    static double diagonal(std::size_t row)
+    {
+        return static_cast<double>(1 + row % 5);
+    }
+
+    ExecSpace execution_space() const
+    {
+        return ExecSpace();
+    }
+
+    std::size_t size() const
+    {
+        return s_size;
+    }
+
+    template <class InputView, class OutputView>
+    void apply(ExecSpace, InputView input, OutputView output) const
+    {
+        for (std::size_t row = 0; row < input.extent(0); ++row) {
+            for (std::size_t column = 0; column < input.extent(1); ++column) {
+                output(row, column) = diagonal(row) * input(row, column);
+            }
+        }
+    }
+};
+
+static gko::matrix_data<double, gko::int32> assemble_matrix_data(DiagonalModel const& model)
+{
+    gko::matrix_data<double, gko::int32> matrix_data(gko::dim<2>(model.size(), model.size()));
+    for (std::size_t row = 0; row < model.size(); ++row) {
+        matrix_data.nonzeros.emplace_back(row, row, DiagonalModel::diagonal(row));
+    }
+    return matrix_data;
+}
+
+static void expect_near(ViewType actual, ViewType expected, double tolerance)
+{
+    for (std::size_t row = 0; row < expected.extent(0); ++row) {
+        for (std::size_t column = 0; column < expected.extent(1); ++column) {
+            EXPECT_NEAR(actual(row, column), expected(row, column), tolerance)
+                    << "row " << row << " column " << column;
+        }
+    }
+}
+
+// Lagrange extrapolation is exact on snapshots polynomial in the parameter, up to its degree.
+TEST(SolutionExtrapolation, PolynomialPredictions)
+{
+    ExecSpace const exec_space;
+    ViewType guess("guess", s_size, 2);
+
+    similie::solvers::SolutionExtrapolator<ExecSpace>
+            linear(exec_space, s_size, 2, similie::solvers::SolutionExtrapolation::Linear);
+    linear.predict(1., guess);
+    expect_near(guess, ViewType("zero", s_size, 2), 0.);
+    for (double const parameter : {0.5, 1.}) {
+        linear.record(parameter, polynomial_snapshot(parameter, false));
+    }
+    linear.predict(2.5, guess);
+    expect_near(guess, polynomial_snapshot(2.5, false), 1e-12);
+
+    similie::solvers::SolutionExtrapolator<ExecSpace>
+            quadratic(exec_space, s_size, 2, similie::solvers::SolutionExtrapolation::Quadratic);
+    for (double const parameter : {0., 1., 3.}) {
+        quadratic.record(parameter, polynomial_snapshot(parameter, true));
+    }
+    quadratic.predict(2., guess);
+    expect_near(guess, polynomial_snapshot(2., true), 1e-12);
+}
+
+// Once the ring is full, the oldest snapshot is evicted and no longer enters the prediction.
+TEST(SolutionExtrapolation, RecordEvictsOldest)
+{
+    similie::solvers::SolutionExtrapolator<ExecSpace> extrapolator(
+            ExecSpace(),
+            s_size,
+            2,
+            similie::solvers::SolutionExtrapolation::Quadratic,
+            3);
+    ViewType outlier("outlier", s_size, 2);
+    Kokkos::deep_copy(outlier, 100.);
+    extrapolator.record(-1., outlier);
+    for (double const parameter : {0., 1., 3.}) {
+        extrapolator.record(parameter, polynomial_snapshot(parameter, true));
+    }
+    EXPECT_EQ(extrapolator.nb_snapshots(), 3U);
+
+    ViewType guess("guess", s_size, 2);
+    extrapolator.predict(2., guess);
+    expect_near(guess, polynomial_snapshot(2., true), 1e-12);
+}
+
+/*
+ * The POD prediction is exact when the solution lies in the span of the snapshots, the dependent
+ * snapshots being dropped instead of making the reduced system singular. Used as initial guess, it
+ * leaves no iteration to the solver.
+ */
+TEST(SolutionExtrapolation, ProperOrthogonalDecomposition)
+{
+    ExecSpace const exec_space;
+    DiagonalModel const model;
+    similie::solvers::SolutionExtrapolator<ExecSpace> extrapolator(
+            exec_space,
+            s_size,
+            1,
+            similie::solvers::SolutionExtrapolation::ProperOrthogonalDecomposition,
+            4);
+    ViewType first("first", s_size, 1);
+    ViewType second("second", s_size, 1);
+    ViewType sum("sum", s_size, 1);
+    ViewType expected("expected", s_size, 1);
+    for (std::size_t row = 0; row < s_size; ++row) {
+        first(row, 0) = static_cast<double>(row);
+        second(row, 0) = static_cast<double>((3 * row) % 7) - 2.;
+        sum(row, 0) = first(row, 0) + second(row, 0);
+        expected(row, 0) = 2. * first(row, 0) - 3. * second(row, 0);
+    }
+    extrapolator.record(0., first);
+    extrapolator.record(1., second);
+    extrapolator.record(2., sum);
+    extrapolator.record(3., first);
+    ViewType rhs("rhs", s_size, 1);
+    model.apply(exec_space, expected, rhs);
+
+    ViewType guess("guess", s_size, 1);
+    extrapolator.predict(model, rhs, guess);
+    expect_near(guess, expected, 1e-12);
+
+    similie::solvers::StrongFormulationSolverSettings settings;
+    settings.use_initial_guess = true;
+    similie::solvers::StrongFormulationSolverDiagnostics const diagnostics
+            = similie::solvers::minimize_strong_formulation_residual(
+                    exec_space,
+                    model,
+                    rhs,
+                    guess,
+                    settings);
+    EXPECT_TRUE(diagnostics.converged);
+    EXPECT_EQ(diagnostics.iterations, 0U);
+    expect_near(guess, expected, 1e-12);
+}
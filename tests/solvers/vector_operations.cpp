@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 Baptiste Legouix
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include <gtest/gtest.h>
+#include <similie/solvers/vector_operations.hpp>
+
+#include <Kokkos_Core.hpp>
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+using ViewType = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+static constexpr std::size_t s_nb_rows = 37;
+static constexpr std::size_t s_nb_columns = 3;
+
+static ViewType pseudo_random_view(std::size_t seed)
+{
+    ViewType view("view", s_nb_rows, s_nb_columns);
+    for (std::size_t row = 0; row < s_nb_rows; ++row) {
+        for (std::size_t column = 0; column < s_nb_columns; ++column) {
+            view(row, column) = static_cast<double>((7 * (row + seed) + 5 * column) % 13) - 6.;
+        }
+    }
+    return view;
+}
+
+static ViewType clone(ViewType view)
+{
+    ViewType copy("copy", view.extent(0), view.extent(1));
+    Kokkos::deep_copy(copy, view);
+    return copy;
+}
+
+static void expect_near(ViewType actual, ViewType expected)
+{
+    for (std::size_t row = 0; row < s_nb_rows; ++row) {
+        for (std::size_t column = 0; column < s_nb_columns; ++column) {
+            EXPECT_NEAR(actual(row, column), expected(row, column), 1e-12)
+                    << "row " << row << " column " << column;
+        }
+    }
+}
+
+// The fused reduction gives the separate dot products, on multi-column views.
+TEST(VectorOperations, MultiDot)
+{
+    ExecSpace const exec_space;
+    Kokkos::Array<ViewType, 3> const lhs
+            = {pseudo_random_view(0), pseudo_random_view(1), pseudo_random_view(2)};
+    Kokkos::Array<ViewType, 3> const rhs = {pseudo_random_view(3), lhs[0], lhs[2]};
+    std::array<double, 3> const dots = similie::solvers::detail::multi_dot(exec_space, lhs, rhs);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(dots[i], similie::solvers::detail::dot(exec_space, lhs[i], rhs[i]), 1e-12);
+    }
+}
+
+// axpby_and_norm matches update_axpby followed by residual_norm_l2, also in place.
+TEST(VectorOperations, AxpbyAndNorm)
+{
+    ExecSpace const exec_space;
+    ViewType const x = pseudo_random_view(0);
+    ViewType const y = pseudo_random_view(1);
+    ViewType const expected("expected", s_nb_rows, s_nb_columns);
+    similie::solvers::detail::update_axpby(exec_space, expected, 2., x, -0.5, y);
+    double const expected_norm = similie::solvers::detail::residual_norm_l2(exec_space, expected);
+
+    ViewType const destination("destination", s_nb_rows, s_nb_columns);
+    EXPECT_NEAR(
+            similie::solvers::detail::axpby_and_norm(exec_space, destination, 2., x, -0.5, y),
+            expected_norm,
+            1e-12);
+    expect_near(destination, expected);
+
+    // The destination aliases the first and then the second operand.
+    ViewType const aliased_x = clone(x);
+    EXPECT_NEAR(
+            similie::solvers::detail::
+                    axpby_and_norm(exec_space, aliased_x, 2., aliased_x, -0.5, y),
+            expected_norm,
+            1e-12);
+    expect_near(aliased_x, expected);
+    ViewType const aliased_y = clone(y);
+    EXPECT_NEAR(
+            similie::solvers::detail::
+                    axpby_and_norm(exec_space, aliased_y, 2., x, -0.5, aliased_y),
+            expected_norm,
+            1e-12);
+    expect_near(aliased_y, expected);
+}
+
+// copy_axpy matches copy followed by axpy_inplace, also in place.
+TEST(VectorOperations, CopyAxpy)
+{
+    ExecSpace const exec_space;
+    ViewType const x = pseudo_random_view(0);
+    ViewType const y = pseudo_random_view(1);
+    ViewType const expected("expected", s_nb_rows, s_nb_columns);
+    similie::solvers::detail::copy(exec_space, expected, x);
+    similie::solvers::detail::axpy_inplace(exec_space, expected, 0.25, y);
+
+    ViewType const destination("destination", s_nb_rows, s_nb_columns);
+    similie::solvers::detail::copy_axpy(exec_space, destination, x, 0.25, y);
+    expect_near(destination, expected);
+
+    // The destination aliases the source x and then the source y.
+    ViewType const aliased_x = clone(x);
+    similie::solvers::detail::copy_axpy(exec_space, aliased_x, aliased_x, 0.25, y);
+    expect_near(aliased_x, expected);
+    ViewType const aliased_y = clone(y);
+    similie::solvers::detail::copy_axpy(exec_space, aliased_y, x, 0.25, aliased_y);
+    expect_near(aliased_y, expected);
+}